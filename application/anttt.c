@@ -1,10 +1,81 @@
 /**********************************************************************************************************************
-File: anttt.c                                                                
+File: anttt.c
 
 Description:
 Implements TIC-TAC-TOE using data input from ANT or BLE.
 
+The board is held as two 9-bit masks (one for HOME, one for AWAY) in AntttBoardType.  Bit n of each mask is
+cell n+1, which is the same order as HOME1..HOME9 and AWAY1..AWAY9 in LedNumberType so a mask maps straight onto
+the LEDs.  Win detection ANDs a side's mask with each of the 8 precomputed line masks in Anttt_au16WinLines.
 
+------------------------------------------------------------------------------------------------------------------------
+API:
+AntttSideType: ANTTT_HOME, ANTTT_AWAY
+AntttGameStatusType: ANTTT_GAME_ACTIVE, ANTTT_GAME_HOME_WIN, ANTTT_GAME_AWAY_WIN, ANTTT_GAME_DRAW
+
+Public:
+void AntttNewGame(AntttSideType eFirstSide_)
+Clears the board and starts a new game with eFirstSide_ to move.
+
+bool AntttPlayMove(u8 u8Cell_)
+Plays cell u8Cell_ (0-8) for the side to move.  Returns false if the move is not legal.
+
+AntttGameStatusType AntttGetStatus(void)
+Returns the status of the current game.
+
+bool AntttUndoMove(void)
+bool AntttRedoMove(void)
+Take back or replay the last move of a classic game from the journal in anttt_journal.c.  With the on-board opponent
+playing, its reply is taken back or replayed too so the player is to move again.  Any search in progress is dropped.
+
+bool AntttShowHistory(u8 u8Age_, u8 u8Ply_)
+Shows the position after u8Ply_ moves of a completed game (age 0 is the most recent) on the LEDs.  Meant for
+between games: the current game is redrawn on its next change.  Successive calls on the same game only step
+through the plies in between, so the display can scrub back and forth.
+
+bool AntttIsLegalMove(const AntttBoardType* psBoard_, u8 u8Cell_)
+bool AntttMakeMove(AntttBoardType* psBoard_, AntttSideType eSide_, u8 u8Cell_)
+u16 AntttWinningLine(u16 u16Cells_)
+u8 AntttOpenLines(u16 u16Own_, u16 u16Opponent_)
+AntttGameStatusType AntttGameStatus(const AntttBoardType* psBoard_)
+Bitboard helpers that work on any AntttBoardType.  They do not touch the LEDs or the current game.
+
+void AntttSetComputer(AntttSideType eSide_, bool bEnabled_)
+Selects whether the on-board opponent plays eSide_.  The computer replies from the state machine.
+
+void AntttSetLevel(AntttLevelType eLevel_)
+Sets the strength of the on-board opponent.  Below ANTTT_LEVEL_PERFECT the reply comes from the time-sliced search
+in anttt_search.c, which runs for ANTTT_SEARCH_BUDGET_US per pass of the main loop until it finishes.  Ultimate
+games use their own opponents (see below).
+
+u16 AntttTableKey(u16 u16Own_, u16 u16Opponent_)
+u8 AntttTableLookup(u16 u16Own_, u16 u16Opponent_)
+u8 AntttBestMove(const AntttBoardType* psBoard_, AntttSideType eSide_)
+Perfect-play lookups into the flash table in anttt_table.c.  By default only symmetry-canonical positions are
+stored and a lookup canonicalizes the position (anttt_symmetry.c), binary searches the sorted key list and maps the
+stored cell back onto the physical board.  Define ANTTT_TABLE_FULL for the O(1) table of all 3^9 keys at 8x the
+flash.  The table is generated and checked on the host by host/anttt_table_gen.c and host/anttt_table_verify.c.
+
+void AntttNewUltimateGame(AntttSideType eFirstSide_)
+bool AntttPlayUltimateMove(u8 u8Board_, u8 u8Cell_)
+Ultimate tic-tac-toe on 9 sub-boards.  A move in cell n sends the opponent to sub-board n, or to any open
+sub-board if n is won or full.  Winning 3 sub-boards in a line wins the game.  The single LED board alternates
+between the active sub-board (STATUS_GRN on) and the meta-board, where won sub-boards are solid, drawn ones are
+dimmed with LedPWM() and the sub-board(s) that can be played next blink.
+
+void AntttUltimateClear(AntttUltimateBoardType* psBoard_)
+bool AntttUltimateIsLegalMove(const AntttUltimateBoardType* psBoard_, u8 u8Board_, u8 u8Cell_)
+bool AntttUltimateMakeMove(AntttUltimateBoardType* psBoard_, AntttSideType eSide_, u8 u8Board_, u8 u8Cell_)
+u8 AntttUltimateLegalMoves(const AntttUltimateBoardType* psBoard_, u8* pu8Moves_)
+u8 AntttUltimateChooseMove(const AntttUltimateBoardType* psBoard_, AntttSideType eSide_)
+Ultimate helpers that work on any AntttUltimateBoardType.  Moves are packed with ANTTT_ULTIMATE_MOVE().
+At EASY and MEDIUM the on-board opponent picks the best move by a one-ply score (AntttUltimateScoreMove()).  At
+HARD and PERFECT it thinks for ANTTT_MCTS_MOVE_MS with the Monte Carlo tree search in anttt_mcts.c, which is told
+every move so the tree carries over from one move to the next.
+
+Protected:
+void AntttInitialize(void)
+void AntttRunActiveState(void)
 
 **********************************************************************************************************************/
 
@@ -25,15 +96,69 @@ extern volatile u32 G_u32SystemFlags;                  /* From main.c */
 extern volatile u32 G_u32SystemTime1ms;                /* From board-specific source file */
 extern volatile u32 G_u32SystemTime1s;                 /* From board-specific source file */
 
+#ifdef ANTTT_TABLE_FULL
+extern const u8 G_au8AntttTable[ANTTT_TABLE_SIZE];     /* From anttt_table.c */
+#else
+extern const u16 G_au16AntttCanonicalKeys[ANTTT_CANONICAL_SIZE];  /* From anttt_table.c */
+extern const u8 G_au8AntttCanonicalTable[ANTTT_CANONICAL_SIZE];   /* From anttt_table.c */
+#endif /* ANTTT_TABLE_FULL */
+
+extern const AntttMctsGameType G_sAntttMctsUltimate;   /* From anttt_mcts.c */
+
+extern const LedTimelineType G_sLedTimelineWinLine;    /* From leds_anttt.c */
+extern const LedTimelineType G_sLedTimelineDraw;       /* From leds_anttt.c */
+extern const LedTimelineType G_sLedTimelineWaiting;    /* From leds_anttt.c */
+
 
 /***********************************************************************************************************************
 Global variable definitions with scope limited to this local application.
 Variable names shall start with "Anttt_" and be declared as static.
 ***********************************************************************************************************************/
+static fnCode_type Anttt_pfnStateMachine;                /* The state machine function pointer */
+
 static u32 Anttt_u32Timeout;                             /* Timeout counter used across states */
+static u32 Anttt_u32LastRunMs;                           /* G_u32SystemTime1ms at the last AntttRunActiveState() */
+static u32 Anttt_u32PassMs;                              /* ms since the pass before (several after a sleep) */
 
 static u32 Anttt_u32CyclePeriod;                         /* Current base time for Anttt modulation */
 
+static AntttBoardType Anttt_sBoard;                      /* The current game */
+static AntttSideType Anttt_eSideToMove;                  /* Side that plays the next move */
+static AntttGameStatusType Anttt_eStatus;                /* Status of the current game */
+static AntttSideType Anttt_eComputerSide = ANTTT_AWAY;   /* Side played by the on-board opponent */
+static bool Anttt_bComputerEnabled = true;               /* true if the on-board opponent is playing */
+static AntttLevelType Anttt_eLevel = ANTTT_LEVEL_HARD;   /* Strength of the on-board opponent */
+static AntttUltimateBoardType Anttt_sUltimate;           /* The current game in ultimate mode */
+static bool Anttt_bSubBoardView;                         /* true while the ultimate display shows the sub-board */
+static AntttJournalCursorType Anttt_sReview;             /* Replay of a completed game for AntttShowHistory() */
+static u8 Anttt_u8ReviewAge;                             /* History age of the game in Anttt_sReview */
+static bool Anttt_bReviewOpen;                           /* false until Anttt_sReview holds Anttt_u8ReviewAge */
+
+/* Rows, columns then diagonals as cell masks (BIT0 = cell 1) */
+static const u16 Anttt_au16WinLines[ANTTT_WIN_LINES] =
+{
+  0x0007, 0x0038, 0x01C0,                                /* 1-2-3, 4-5-6, 7-8-9 */
+  0x0049, 0x0092, 0x0124,                                /* 1-4-7, 2-5-8, 3-6-9 */
+  0x0111, 0x0054                                         /* 1-5-9, 3-5-7 */
+};
+
+/* Base-3 weight of a cell mask: sum of 3^n for each set bit n, split into bits 0-4 and bits 5-8 */
+static const u16 Anttt_au16Pow3Low[32] =
+{
+     0,    1,    3,    4,    9,   10,   12,   13,   27,   28,   30,   31,   36,   37,   39,   40,
+    81,   82,   84,   85,   90,   91,   93,   94,  108,  109,  111,  112,  117,  118,  120,  121
+};
+
+static const u16 Anttt_au16Pow3High[16] =
+{
+     0,  243,  729,  972, 2187, 2430, 2916, 3159, 6561, 6804, 7290, 7533, 8748, 8991, 9477, 9720
+};
+
+#ifdef ANTTT_BENCHMARK
+static AntttBenchmarkType Anttt_sBenchmark;              /* Results of AntttBenchmark() for the debugger */
+#endif /* ANTTT_BENCHMARK */
+
+
 /**********************************************************************************************************************
 Function Definitions
 **********************************************************************************************************************/
@@ -42,53 +167,1513 @@ Function Definitions
 /* Public functions                                                                                                   */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttNewGame
+
+Description:
+Clears the board and starts a new game.
+
+Requires:
+  - eFirstSide_ is the side that moves first
+
+Promises:
+  - Board is empty, game is active and the LEDs will be redrawn on the next pass of the state machine
+  - The last game is filed in the journal history if it finished
+*/
+void AntttNewGame(AntttSideType eFirstSide_)
+{
+  Anttt_sBoard.u16Home = 0;
+  Anttt_sBoard.u16Away = 0;
+  Anttt_eSideToMove = eFirstSide_;
+  Anttt_eStatus = ANTTT_GAME_ACTIVE;
+  AntttJournalNewGame(eFirstSide_);
+  Anttt_bReviewOpen = false;
+
+  G_u32AntttFlags &= ~(_ANTTT_GAME_OVER | _ANTTT_ULTIMATE);
+  G_u32AntttFlags |= _ANTTT_BOARD_CHANGED;
+  LedOff(STATUS_RED);
+  LedLayerClear(LED_LAYER_STATUS);
+  LedLayerClear(LED_LAYER_OVERLAY);
+  Anttt_pfnStateMachine = AntttSM_Idle;
+
+} /* end AntttNewGame() */
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* Protected functions                                                                                                */
-/*--------------------------------------------------------------------------------------------------------------------*/
 
 /*--------------------------------------------------------------------------------------------------------------------
-Function: AntttInitialize
+Function: AntttPlayMove
 
 Description:
-Initializes the State Machine and its variables.
+Plays a move for the side to move in the current game.
+
+Requires:
+  - u8Cell_ is the cell index 0-8
+
+Promises:
+  - If a classic game is active and the cell is empty, the move is made, the game status is updated, the side to
+    move changes and returns true
+  - Otherwise the game is unchanged and returns false
+*/
+bool AntttPlayMove(u8 u8Cell_)
+{
+  if( (Anttt_eStatus != ANTTT_GAME_ACTIVE) || (G_u32AntttFlags & _ANTTT_ULTIMATE) )
+  {
+    return(false);
+  }
+
+  if( !AntttMakeMove(&Anttt_sBoard, Anttt_eSideToMove, u8Cell_) )
+  {
+    return(false);
+  }
+
+  Anttt_eSideToMove = (AntttSideType)(Anttt_eSideToMove ^ ANTTT_AWAY);
+  Anttt_eStatus = AntttGameStatus(&Anttt_sBoard);
+  AntttJournalRecord(u8Cell_, Anttt_eStatus);
+
+  G_u32AntttFlags |= _ANTTT_BOARD_CHANGED;
+  if(Anttt_eStatus != ANTTT_GAME_ACTIVE)
+  {
+    G_u32AntttFlags |= _ANTTT_GAME_OVER;
+  }
+
+  return(true);
+
+} /* end AntttPlayMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttGetStatus
+
+Description:
+Reports the status of the current game.
 
 Requires:
   -
 
 Promises:
-  - 
+  - Returns the AntttGameStatusType of the current game
 */
-void AntttInitialize(void)
+AntttGameStatusType AntttGetStatus(void)
 {
-  
-  /* Fire up the LEDs */
-  
+  return(Anttt_eStatus);
 
-} /* end AntttInitialize() */
+} /* end AntttGetStatus() */
 
 
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUndoMove
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* Private functions                                                                                                  */
-/*--------------------------------------------------------------------------------------------------------------------*/
+Description:
+Takes back the last move of the current classic game.
+
+Requires:
+  -
+
+Promises:
+  - If a classic game has a move to take back, it is taken back along with the on-board opponent's reply before
+    it (if the opponent is playing), the game is active, the state machine is back in Idle and returns true
+  - Otherwise the game is unchanged and returns false
+*/
+bool AntttUndoMove(void)
+{
+  if( (G_u32AntttFlags & _ANTTT_ULTIMATE) || (AntttJournalUndo(&Anttt_sBoard) == ANTTT_NO_CELL) )
+  {
+    return(false);
+  }
 
+  Anttt_eSideToMove = (AntttSideType)(Anttt_eSideToMove ^ ANTTT_AWAY);
+  if( Anttt_bComputerEnabled && (Anttt_eSideToMove == Anttt_eComputerSide) &&
+      (AntttJournalUndo(&Anttt_sBoard) != ANTTT_NO_CELL) )
+  {
+    Anttt_eSideToMove = (AntttSideType)(Anttt_eSideToMove ^ ANTTT_AWAY);
+  }
 
+  Anttt_eStatus = ANTTT_GAME_ACTIVE;
+  G_u32AntttFlags &= ~_ANTTT_GAME_OVER;
+  G_u32AntttFlags |= _ANTTT_BOARD_CHANGED;
+  Anttt_pfnStateMachine = AntttSM_Idle;
 
+  /* The win line and a heartbeat from an abandoned search run forever in their layers */
+  LedLayerClear(LED_LAYER_STATUS);
+  LedLayerClear(LED_LAYER_OVERLAY);
+
+  return(true);
+
+} /* end AntttUndoMove() */
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* State Machine definitions                                                                                          */
-/*--------------------------------------------------------------------------------------------------------------------*/
 
 /*--------------------------------------------------------------------------------------------------------------------
-Function: AntttSM_Idle
+Function: AntttRedoMove
+
+Description:
+Replays the move taken back by the last AntttUndoMove().
+
+Requires:
+  -
+
+Promises:
+  - If a classic game has a move to replay, it is replayed along with the on-board opponent's recorded reply (if
+    the opponent is playing), the status is updated, the state machine is back in Idle and returns true
+  - Otherwise the game is unchanged and returns false
 */
-void AntttSM_Idle(void)
+bool AntttRedoMove(void)
 {
+  if( (G_u32AntttFlags & _ANTTT_ULTIMATE) || (AntttJournalRedo(&Anttt_sBoard) == ANTTT_NO_CELL) )
+  {
+    return(false);
+  }
 
-} /* end AntttInitialize() */
+  Anttt_eSideToMove = (AntttSideType)(Anttt_eSideToMove ^ ANTTT_AWAY);
+  if( Anttt_bComputerEnabled && (Anttt_eSideToMove == Anttt_eComputerSide) &&
+      (AntttJournalRedo(&Anttt_sBoard) != ANTTT_NO_CELL) )
+  {
+    Anttt_eSideToMove = (AntttSideType)(Anttt_eSideToMove ^ ANTTT_AWAY);
+  }
+
+  Anttt_eStatus = AntttGameStatus(&Anttt_sBoard);
+  G_u32AntttFlags |= _ANTTT_BOARD_CHANGED;
+  if(Anttt_eStatus != ANTTT_GAME_ACTIVE)
+  {
+    G_u32AntttFlags |= _ANTTT_GAME_OVER;
+  }
+  Anttt_pfnStateMachine = AntttSM_Idle;
+
+  /* The win line and a heartbeat from an abandoned search run forever in their layers */
+  LedLayerClear(LED_LAYER_STATUS);
+  LedLayerClear(LED_LAYER_OVERLAY);
+
+  return(true);
+
+} /* end AntttRedoMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttShowHistory
+
+Description:
+Shows a position from a completed game on the HOME and AWAY LEDs.
+
+Requires:
+  - u8Age_ is 0 for the most recent completed game, 1 for the one before, ...
+  - u8Ply_ is the number of moves to show
+
+Promises:
+  - If the game and ply exist, the LEDs show the position (with any win line or draw flash taken down) and
+    returns true.  Only the plies between the last position shown and this one are replayed.
+  - Otherwise the LEDs are unchanged and returns false
+*/
+bool AntttShowHistory(u8 u8Age_, u8 u8Ply_)
+{
+  const AntttJournalGameType* psGame = AntttJournalHistory(u8Age_);
+
+  if(psGame == NULL)
+  {
+    return(false);
+  }
+
+  if( !Anttt_bReviewOpen || (u8Age_ != Anttt_u8ReviewAge) )
+  {
+    AntttJournalOpen(&Anttt_sReview, psGame);
+    Anttt_u8ReviewAge = u8Age_;
+    Anttt_bReviewOpen = true;
+  }
+
+  if( !AntttJournalSeek(&Anttt_sReview, u8Ply_) )
+  {
+    return(false);
+  }
+
+  LedLayerClear(LED_LAYER_OVERLAY);
+  AntttShowCells(Anttt_sReview.sBoard.u16Home, Anttt_sReview.sBoard.u16Away);
+  return(true);
+
+} /* end AntttShowHistory() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttIsLegalMove
+
+Description:
+Checks if a cell can be played on a board.
+
+Requires:
+  - psBoard_ points to a valid board
+
+Promises:
+  - Returns true if u8Cell_ is 0-8 and the cell is empty
+*/
+bool AntttIsLegalMove(const AntttBoardType* psBoard_, u8 u8Cell_)
+{
+  if(u8Cell_ >= ANTTT_CELLS)
+  {
+    return(false);
+  }
+
+  return( ((psBoard_->u16Home | psBoard_->u16Away) & (1 << u8Cell_)) == 0 );
+
+} /* end AntttIsLegalMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMakeMove
+
+Description:
+Places a piece on a board.  The game status is not checked.
+
+Requires:
+  - psBoard_ points to a valid board
+
+Promises:
+  - If u8Cell_ is legal, the cell is added to eSide_'s mask and returns true
+  - Otherwise the board is unchanged and returns false
+*/
+bool AntttMakeMove(AntttBoardType* psBoard_, AntttSideType eSide_, u8 u8Cell_)
+{
+  if( !AntttIsLegalMove(psBoard_, u8Cell_) )
+  {
+    return(false);
+  }
+
+  if(eSide_ == ANTTT_HOME)
+  {
+    psBoard_->u16Home |= (u16)(1 << u8Cell_);
+  }
+  else
+  {
+    psBoard_->u16Away |= (u16)(1 << u8Cell_);
+  }
+
+  return(true);
+
+} /* end AntttMakeMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttWinningLine
+
+Description:
+Checks a side's cell mask against the 8 win lines.
+
+Requires:
+  - u16Cells_ is one side's cell mask
+
+Promises:
+  - Returns the mask of the first complete line found, or 0 if there is none
+*/
+u16 AntttWinningLine(u16 u16Cells_)
+{
+  for(u8 i = 0; i < ANTTT_WIN_LINES; i++)
+  {
+    if( (u16Cells_ & Anttt_au16WinLines[i]) == Anttt_au16WinLines[i] )
+    {
+      return(Anttt_au16WinLines[i]);
+    }
+  }
+
+  return(0);
+
+} /* end AntttWinningLine() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttOpenLines
+
+Description:
+Counts the win lines a side has started that the other side has not blocked.
+
+Requires:
+  - u16Own_ and u16Opponent_ are non-overlapping 9-bit cell masks
+
+Promises:
+  - Returns 0 to ANTTT_WIN_LINES
+*/
+u8 AntttOpenLines(u16 u16Own_, u16 u16Opponent_)
+{
+  u8 u8Count = 0;
+
+  for(u8 i = 0; i < ANTTT_WIN_LINES; i++)
+  {
+    if( (u16Own_ & Anttt_au16WinLines[i]) && !(u16Opponent_ & Anttt_au16WinLines[i]) )
+    {
+      u8Count++;
+    }
+  }
+
+  return(u8Count);
+
+} /* end AntttOpenLines() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttGameStatus
+
+Description:
+Determines if a board is won, drawn or still in play.
+
+Requires:
+  - psBoard_ points to a valid board with at most one side holding a line
+
+Promises:
+  - Returns the AntttGameStatusType for the board
+*/
+AntttGameStatusType AntttGameStatus(const AntttBoardType* psBoard_)
+{
+  if( AntttWinningLine(psBoard_->u16Home) )
+  {
+    return(ANTTT_GAME_HOME_WIN);
+  }
+
+  if( AntttWinningLine(psBoard_->u16Away) )
+  {
+    return(ANTTT_GAME_AWAY_WIN);
+  }
+
+  if( (psBoard_->u16Home | psBoard_->u16Away) == ANTTT_BOARD_MASK )
+  {
+    return(ANTTT_GAME_DRAW);
+  }
+
+  return(ANTTT_GAME_ACTIVE);
+
+} /* end AntttGameStatus() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSetComputer
+
+Description:
+Selects the side played by the on-board opponent.
+
+Requires:
+  -
+
+Promises:
+  - If bEnabled_ is true, the state machine plays eSide_ at the level set by AntttSetLevel() whenever it is that
+    side's turn
+  - If bEnabled_ is false, both sides are played with AntttPlayMove()
+*/
+void AntttSetComputer(AntttSideType eSide_, bool bEnabled_)
+{
+  Anttt_eComputerSide = eSide_;
+  Anttt_bComputerEnabled = bEnabled_;
+
+} /* end AntttSetComputer() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSetLevel
+
+Description:
+Sets the strength of the on-board opponent.  A move already being searched finishes at the old level.
+
+Requires:
+  - eLevel_ is an AntttLevelType
+
+Promises:
+  - The computer's next move is chosen at eLevel_
+*/
+void AntttSetLevel(AntttLevelType eLevel_)
+{
+  Anttt_eLevel = eLevel_;
+
+} /* end AntttSetLevel() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttTableKey
+
+Description:
+Computes the base-3 key of a position: digit n is 0 for an empty cell, 1 if the side to move holds it and
+2 if the opponent holds it.
+
+Requires:
+  - u16Own_ and u16Opponent_ are 9-bit cell masks that do not overlap
+
+Promises:
+  - Returns the key 0 to ANTTT_TABLE_SIZE - 1
+*/
+u16 AntttTableKey(u16 u16Own_, u16 u16Opponent_)
+{
+  return( Anttt_au16Pow3Low[u16Own_ & 0x1F] + Anttt_au16Pow3High[u16Own_ >> 5] +
+          2 * (Anttt_au16Pow3Low[u16Opponent_ & 0x1F] + Anttt_au16Pow3High[u16Opponent_ >> 5]) );
+
+} /* end AntttTableKey() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttTableLookup
+
+Description:
+Looks up a position in the perfect-play table.  In the canonical table the position is first reduced to its
+canonical form; the stored cell is then mapped back through the inverse transform so the result is always
+a cell on the physical board.
+
+Requires:
+  - u16Own_ is the side to move and u16Opponent_ the other side, as non-overlapping 9-bit cell masks
+
+Promises:
+  - Returns the table entry: use ANTTT_TABLE_CELL() for the best cell and ANTTT_TABLE_VALUE() for the value
+    of the position to the side to move
+*/
+u8 AntttTableLookup(u16 u16Own_, u16 u16Opponent_)
+{
+#ifdef ANTTT_TABLE_FULL
+  return( G_au8AntttTable[AntttTableKey(u16Own_, u16Opponent_)] );
+
+#else
+  u16 u16Key;
+  u16 u16Low = 0;
+  u16 u16High = ANTTT_CANONICAL_SIZE;
+  u16 u16Middle;
+  u8 u8Transform;
+  u8 u8Entry;
+
+  u8Transform = AntttSymCanonicalize(&u16Own_, &u16Opponent_);
+  u16Key = AntttTableKey(u16Own_, u16Opponent_);
+
+  /* Binary search of the sorted keys: at most 10 probes for 765 entries */
+  while(u16Low < u16High)
+  {
+    u16Middle = (u16)((u16Low + u16High) >> 1);
+    if(G_au16AntttCanonicalKeys[u16Middle] < u16Key)
+    {
+      u16Low = u16Middle + 1;
+    }
+    else
+    {
+      u16High = u16Middle;
+    }
+  }
+
+  if( (u16Low == ANTTT_CANONICAL_SIZE) || (G_au16AntttCanonicalKeys[u16Low] != u16Key) )
+  {
+    return( (u8)((ANTTT_VALUE_INVALID << ANTTT_TABLE_VALUE_SHIFT) | ANTTT_TABLE_NO_CELL) );
+  }
+
+  u8Entry = G_au8AntttCanonicalTable[u16Low];
+  if(ANTTT_TABLE_CELL(u8Entry) != ANTTT_TABLE_NO_CELL)
+  {
+    u8Entry = (u8)( (u8Entry & ANTTT_TABLE_VALUE_MASK) | AntttSymUnmapCell(u8Transform, ANTTT_TABLE_CELL(u8Entry)) );
+  }
+
+  return(u8Entry);
+
+#endif /* ANTTT_TABLE_FULL */
+} /* end AntttTableLookup() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttBestMove
+
+Description:
+Returns the perfect-play reply for a side.  Among moves of equal value the table prefers the fastest win or
+the slowest loss.
+
+Requires:
+  - psBoard_ points to a valid board with eSide_ to move
+
+Promises:
+  - Returns the best cell 0-8, or ANTTT_NO_CELL if the game is over or the position is not reachable
+*/
+u8 AntttBestMove(const AntttBoardType* psBoard_, AntttSideType eSide_)
+{
+  u8 u8Entry;
+
+  if(eSide_ == ANTTT_HOME)
+  {
+    u8Entry = AntttTableLookup(psBoard_->u16Home, psBoard_->u16Away);
+  }
+  else
+  {
+    u8Entry = AntttTableLookup(psBoard_->u16Away, psBoard_->u16Home);
+  }
+
+  if(ANTTT_TABLE_CELL(u8Entry) == ANTTT_TABLE_NO_CELL)
+  {
+    return(ANTTT_NO_CELL);
+  }
+
+  return( ANTTT_TABLE_CELL(u8Entry) );
+
+} /* end AntttBestMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttNewUltimateGame
+
+Description:
+Clears all 9 sub-boards and starts a new ultimate game.
+
+Requires:
+  - eFirstSide_ is the side that moves first
+
+Promises:
+  - The ultimate board is empty with any sub-board open, the game is active and the LEDs will be redrawn on the
+    next pass of the state machine
+  - The tree search starts a new tree for the empty board
+  - AntttPlayMove() is refused until the next AntttNewGame()
+  - The last classic game is filed in the journal history if it finished
+*/
+void AntttNewUltimateGame(AntttSideType eFirstSide_)
+{
+  AntttMctsStateType sState;
+
+  AntttUltimateClear(&Anttt_sUltimate);
+  AntttJournalNewGame(eFirstSide_);
+  Anttt_bReviewOpen = false;
+  sState.sUltimate = Anttt_sUltimate;
+  AntttMctsNewGame(&G_sAntttMctsUltimate, &sState, eFirstSide_);
+
+  Anttt_eSideToMove = eFirstSide_;
+  Anttt_eStatus = ANTTT_GAME_ACTIVE;
+  Anttt_bSubBoardView = false;
+  Anttt_u32Timeout = ANTTT_ULTIMATE_META_VIEW_MS;
+
+  G_u32AntttFlags &= ~_ANTTT_GAME_OVER;
+  G_u32AntttFlags |= (_ANTTT_BOARD_CHANGED | _ANTTT_ULTIMATE);
+  LedOff(STATUS_RED);
+  LedLayerClear(LED_LAYER_STATUS);
+  LedLayerClear(LED_LAYER_OVERLAY);
+  Anttt_pfnStateMachine = AntttSM_UltimateIdle;
+
+} /* end AntttNewUltimateGame() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttPlayUltimateMove
+
+Description:
+Plays a move for the side to move in the current ultimate game.
+
+Requires:
+  - u8Board_ is the sub-board 0-8 and u8Cell_ the cell 0-8 within it
+
+Promises:
+  - If an ultimate game is active and the move is legal, the move is made (and passed on to the tree search), the
+    game status is updated, the side to move changes and returns true
+  - Otherwise the game is unchanged and returns false
+*/
+bool AntttPlayUltimateMove(u8 u8Board_, u8 u8Cell_)
+{
+  if( !(G_u32AntttFlags & _ANTTT_ULTIMATE) )
+  {
+    return(false);
+  }
+
+  if( !AntttUltimateMakeMove(&Anttt_sUltimate, Anttt_eSideToMove, u8Board_, u8Cell_) )
+  {
+    return(false);
+  }
+
+  AntttMctsAdvance( ANTTT_ULTIMATE_MOVE(u8Board_, u8Cell_) );
+  Anttt_eSideToMove = (AntttSideType)(Anttt_eSideToMove ^ ANTTT_AWAY);
+  Anttt_eStatus = (AntttGameStatusType)Anttt_sUltimate.u8Status;
+
+  G_u32AntttFlags |= _ANTTT_BOARD_CHANGED;
+  if(Anttt_eStatus != ANTTT_GAME_ACTIVE)
+  {
+    G_u32AntttFlags |= _ANTTT_GAME_OVER;
+  }
+
+  return(true);
+
+} /* end AntttPlayUltimateMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUltimateClear
+
+Description:
+Empties an ultimate board.
+
+Requires:
+  - psBoard_ points to an ultimate board
+
+Promises:
+  - All sub-boards are empty and open, any sub-board may be played and the status is ANTTT_GAME_ACTIVE
+*/
+void AntttUltimateClear(AntttUltimateBoardType* psBoard_)
+{
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    psBoard_->au16Home[i] = 0;
+    psBoard_->au16Away[i] = 0;
+  }
+
+  psBoard_->u16HomeWon = 0;
+  psBoard_->u16AwayWon = 0;
+  psBoard_->u16Closed = 0;
+  psBoard_->u8ActiveBoard = ANTTT_NO_CELL;
+  psBoard_->u8Status = ANTTT_GAME_ACTIVE;
+
+} /* end AntttUltimateClear() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUltimateIsLegalMove
+
+Description:
+Checks a move against the ultimate rules using only the summary masks and the one sub-board.
+
+Requires:
+  - psBoard_ points to a valid ultimate board
+
+Promises:
+  - Returns true if the game is active, u8Board_ is open and is the active sub-board (or any sub-board may be
+    played), and u8Cell_ is empty in it
+*/
+bool AntttUltimateIsLegalMove(const AntttUltimateBoardType* psBoard_, u8 u8Board_, u8 u8Cell_)
+{
+  if( (psBoard_->u8Status != ANTTT_GAME_ACTIVE) || (u8Board_ >= ANTTT_CELLS) || (u8Cell_ >= ANTTT_CELLS) )
+  {
+    return(false);
+  }
+
+  if( (psBoard_->u16Closed & (1 << u8Board_)) ||
+      ((psBoard_->u8ActiveBoard != ANTTT_NO_CELL) && (psBoard_->u8ActiveBoard != u8Board_)) )
+  {
+    return(false);
+  }
+
+  return( !((psBoard_->au16Home[u8Board_] | psBoard_->au16Away[u8Board_]) & (1 << u8Cell_)) );
+
+} /* end AntttUltimateIsLegalMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUltimateMakeMove
+
+Description:
+Places a piece and updates the summary incrementally: only the sub-board that was played is checked for a line,
+and the meta-board is only checked when that sub-board was won.
+
+Requires:
+  - psBoard_ points to a valid ultimate board
+
+Promises:
+  - If the move is legal it is made, the won/closed summaries, active sub-board and status are updated and
+    returns true
+  - Otherwise the board is unchanged and returns false
+*/
+bool AntttUltimateMakeMove(AntttUltimateBoardType* psBoard_, AntttSideType eSide_, u8 u8Board_, u8 u8Cell_)
+{
+  u16* pu16Cells = &psBoard_->au16Home[u8Board_];
+  u16* pu16Won = &psBoard_->u16HomeWon;
+  u16 u16Board = (u16)(1 << u8Board_);
+
+  if( !AntttUltimateIsLegalMove(psBoard_, u8Board_, u8Cell_) )
+  {
+    return(false);
+  }
+
+  if(eSide_ == ANTTT_AWAY)
+  {
+    pu16Cells = &psBoard_->au16Away[u8Board_];
+    pu16Won = &psBoard_->u16AwayWon;
+  }
+
+  *pu16Cells |= (u16)(1 << u8Cell_);
+
+  if( AntttWinningLine(*pu16Cells) )
+  {
+    *pu16Won |= u16Board;
+    psBoard_->u16Closed |= u16Board;
+    if( AntttWinningLine(*pu16Won) )
+    {
+      psBoard_->u8Status = (eSide_ == ANTTT_HOME) ? ANTTT_GAME_HOME_WIN : ANTTT_GAME_AWAY_WIN;
+    }
+  }
+  else if( (psBoard_->au16Home[u8Board_] | psBoard_->au16Away[u8Board_]) == ANTTT_BOARD_MASK )
+  {
+    psBoard_->u16Closed |= u16Board;
+  }
+
+  if( (psBoard_->u8Status == ANTTT_GAME_ACTIVE) && (psBoard_->u16Closed == ANTTT_BOARD_MASK) )
+  {
+    psBoard_->u8Status = ANTTT_GAME_DRAW;
+  }
+
+  /* The cell played selects the opponent's sub-board unless that one is closed */
+  psBoard_->u8ActiveBoard = u8Cell_;
+  if(psBoard_->u16Closed & (1 << u8Cell_))
+  {
+    psBoard_->u8ActiveBoard = ANTTT_NO_CELL;
+  }
+
+  return(true);
+
+} /* end AntttUltimateMakeMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUltimateLegalMoves
+
+Description:
+Lists the legal moves.
+
+Requires:
+  - pu8Moves_ points to space for ANTTT_ULTIMATE_MOVES moves
+
+Promises:
+  - pu8Moves_ holds the legal moves packed with ANTTT_ULTIMATE_MOVE(), sub-board by sub-board
+  - Returns the number of moves (0 if the game is over)
+*/
+u8 AntttUltimateLegalMoves(const AntttUltimateBoardType* psBoard_, u8* pu8Moves_)
+{
+  u16 u16Empty;
+  u8 u8Count = 0;
+  u8 u8First = 0;
+  u8 u8Last = ANTTT_CELLS - 1;
+
+  if(psBoard_->u8Status != ANTTT_GAME_ACTIVE)
+  {
+    return(0);
+  }
+
+  if(psBoard_->u8ActiveBoard != ANTTT_NO_CELL)
+  {
+    u8First = psBoard_->u8ActiveBoard;
+    u8Last = psBoard_->u8ActiveBoard;
+  }
+
+  for(u8 u8Board = u8First; u8Board <= u8Last; u8Board++)
+  {
+    if( !(psBoard_->u16Closed & (1 << u8Board)) )
+    {
+      u16Empty = (u16)(~(psBoard_->au16Home[u8Board] | psBoard_->au16Away[u8Board]) & ANTTT_BOARD_MASK);
+      for(u8 i = 0; i < ANTTT_CELLS; i++)
+      {
+        if(u16Empty & (1 << i))
+        {
+          pu8Moves_[u8Count++] = ANTTT_ULTIMATE_MOVE(u8Board, i);
+        }
+      }
+    }
+  }
+
+  return(u8Count);
+
+} /* end AntttUltimateLegalMoves() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUltimateChooseMove
+
+Description:
+Picks a move for the on-board opponent: the legal move with the best AntttUltimateScoreMove(), earliest first on
+a tie.  At most 81 moves are scored so the reply is made in one pass of the state machine.
+
+Requires:
+  - psBoard_ points to a valid ultimate board with eSide_ to move
+
+Promises:
+  - Returns the move packed with ANTTT_ULTIMATE_MOVE(), or ANTTT_NO_CELL if the game is over
+*/
+u8 AntttUltimateChooseMove(const AntttUltimateBoardType* psBoard_, AntttSideType eSide_)
+{
+  u8 au8Moves[ANTTT_ULTIMATE_MOVES];
+  u8 u8Count;
+  u8 u8Best = ANTTT_NO_CELL;
+  s16 s16Best = -ANTTT_SEARCH_INFINITY;
+  s16 s16Score;
+
+  u8Count = AntttUltimateLegalMoves(psBoard_, au8Moves);
+  for(u8 i = 0; i < u8Count; i++)
+  {
+    s16Score = AntttUltimateScoreMove(psBoard_, eSide_, au8Moves[i]);
+    if(s16Score > s16Best)
+    {
+      s16Best = s16Score;
+      u8Best = au8Moves[i];
+    }
+  }
+
+  return(u8Best);
+
+} /* end AntttUltimateChooseMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttInitialize
+
+Description:
+Initializes the State Machine and its variables.
+
+Requires:
+  -
+
+Promises:
+  - An empty board is shown with HOME to move first
+  - The state machine is set to Idle
+*/
+void AntttInitialize(void)
+{
+  G_u32AntttFlags = 0;
+  Anttt_u32LastRunMs = G_u32SystemTime1ms;
+  AntttJournalInitialize();
+  AntttHashInitialize();
+  AntttSearchInitialize();
+  AntttMctsInitialize();
+
+#ifdef ANTTT_BENCHMARK
+  AntttBenchmark();
+#endif /* ANTTT_BENCHMARK */
+
+  /* Fire up the LEDs once the boot chase is over */
+  AntttNewGame(ANTTT_HOME);
+  Anttt_pfnStateMachine = AntttSM_Boot;
+
+} /* end AntttInitialize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttRunActiveState
+
+Description:
+Selects and runs one iteration of the current state in the state machine.
+All state machines have a TOTAL maximum execution time of 1ms.
+
+Requires:
+  - State machine function pointer points at current state
+
+Promises:
+  - Calls the function to pointed by the state machine function pointer
+  - Anttt_u32PassMs is the ms since the last call (the scheduler can sleep through ticks, see AntttMsToNextRun())
+  - The current classic game's duration counts those ms
+*/
+void AntttRunActiveState(void)
+{
+  Anttt_u32PassMs = G_u32SystemTime1ms - Anttt_u32LastRunMs;
+  Anttt_u32LastRunMs += Anttt_u32PassMs;
+
+  if( !(G_u32AntttFlags & _ANTTT_ULTIMATE) )
+  {
+    AntttJournalTick(Anttt_u32PassMs);
+  }
+
+  Anttt_pfnStateMachine();
+
+} /* end AntttRunActiveState */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMsToNextRun
+
+Description:
+Reports how long the game can go without AntttRunActiveState(), so the scheduler can sleep through the ticks
+between moves.  Searches, a redraw and the end-of-game states step on every pass; an ultimate game needs the pass at
+which its view switches; otherwise nothing happens until a move or a new game changes the board.  The boot chase
+ends on an LED edge, and the LED task wakes for that and runs before this one.
+
+Requires:
+  - Called after AntttRunActiveState() in the same pass
+
+Promises:
+  - Returns 0 while a state needs the next tick, the ms before the ultimate view switches, or ANTTT_NO_DEADLINE
+*/
+u32 AntttMsToNextRun(void)
+{
+  if(Anttt_pfnStateMachine == AntttSM_Boot)
+  {
+    return(ANTTT_NO_DEADLINE);
+  }
+
+  if( ((Anttt_pfnStateMachine != AntttSM_Idle) && (Anttt_pfnStateMachine != AntttSM_UltimateIdle)) ||
+      (G_u32AntttFlags & _ANTTT_BOARD_CHANGED) )
+  {
+    return(0);
+  }
+
+  /* Idle starts the on-board opponent's search on its turn */
+  if( Anttt_bComputerEnabled && (Anttt_eStatus == ANTTT_GAME_ACTIVE) && (Anttt_eSideToMove == Anttt_eComputerSide) )
+  {
+    return(0);
+  }
+
+  if( (Anttt_pfnStateMachine == AntttSM_UltimateIdle) && (Anttt_eStatus == ANTTT_GAME_ACTIVE) )
+  {
+    return(Anttt_u32Timeout - 1);
+  }
+
+  return(ANTTT_NO_DEADLINE);
+
+} /* end AntttMsToNextRun() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttShowBoard
+
+Description:
+Displays the current board on the HOME and AWAY LEDs.
+
+Requires:
+  - LEDs are initialized
+
+Promises:
+  - HOMEn is on if HOME holds cell n and AWAYn is on if AWAY holds cell n; all other board LEDs are off
+  - STATUS_YLW is on only if the game is drawn
+  - STATUS_RED and the win line or draw flash are left alone: they play in the LED_LAYER_STATUS and
+    LED_LAYER_OVERLAY compositor layers, which show over the board until the think or the game ends
+*/
+void AntttShowBoard(void)
+{
+  AntttShowCells(Anttt_sBoard.u16Home, Anttt_sBoard.u16Away);
+
+  if(Anttt_eStatus == ANTTT_GAME_DRAW)
+  {
+    LedOn(STATUS_YLW);
+  }
+  else
+  {
+    LedOff(STATUS_YLW);
+  }
+
+} /* end AntttShowBoard() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttShowCells
+
+Description:
+Drives the HOME and AWAY LEDs from a pair of cell masks.
+
+Requires:
+  - LEDs are initialized
+
+Promises:
+  - HOMEn is on if bit n-1 of u16Home_ is set and AWAYn is on if bit n-1 of u16Away_ is set; the rest are off
+*/
+void AntttShowCells(u16 u16Home_, u16 u16Away_)
+{
+  LedShowBoard(u16Home_, u16Away_);
+
+} /* end AntttShowCells() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttShowUltimateBoard
+
+Description:
+Displays the ultimate game on the single 3x3 LED board.  The sub-board view shows the pieces in the sub-board
+that must be played next with STATUS_GRN on.  The meta-board view shows each sub-board on the LED of the same
+number: solid for the side that won it, both colors dimmed for a drawn sub-board, and both colors blinking for
+the sub-board(s) that can be played next.
+
+Requires:
+  - LEDs are initialized
+  - bSubBoardView_ selects the view; the meta-board is shown if any sub-board may be played
+
+Promises:
+  - The HOME, AWAY, STATUS_GRN and STATUS_YLW LEDs show the requested view; the heartbeat and win line in the
+    compositor layers show over it, so view changes during a think or after the game do not stop them
+*/
+void AntttShowUltimateBoard(bool bSubBoardView_)
+{
+  u8 u8Active = Anttt_sUltimate.u8ActiveBoard;
+  u16 u16Board;
+
+  if(Anttt_eStatus == ANTTT_GAME_DRAW)
+  {
+    LedOn(STATUS_YLW);
+  }
+  else
+  {
+    LedOff(STATUS_YLW);
+  }
+
+  if( bSubBoardView_ && (u8Active != ANTTT_NO_CELL) )
+  {
+    AntttShowCells(Anttt_sUltimate.au16Home[u8Active], Anttt_sUltimate.au16Away[u8Active]);
+    LedOn(STATUS_GRN);
+    return;
+  }
+
+  LedOff(STATUS_GRN);
+  AntttShowCells(Anttt_sUltimate.u16HomeWon, Anttt_sUltimate.u16AwayWon);
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    u16Board = (u16)(1 << i);
+    if( (Anttt_sUltimate.u16HomeWon | Anttt_sUltimate.u16AwayWon) & u16Board )
+    {
+      continue;
+    }
+
+    if(Anttt_sUltimate.u16Closed & u16Board)
+    {
+      LedPWM( (LedNumberType)(HOME1 + i), LED_PWM_10 );
+      LedPWM( (LedNumberType)(AWAY1 + i), LED_PWM_10 );
+    }
+    else if( (Anttt_eStatus == ANTTT_GAME_ACTIVE) && ((u8Active == ANTTT_NO_CELL) || (u8Active == i)) )
+    {
+      LedBlink( (LedNumberType)(HOME1 + i), LED_4HZ );
+      LedBlink( (LedNumberType)(AWAY1 + i), LED_4HZ );
+    }
+  }
+
+} /* end AntttShowUltimateBoard() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUltimateScoreMove
+
+Description:
+One-ply score of an ultimate move for the on-board opponent:
+  winning the game beats everything, then winning a sub-board (+20), blocking an opponent line in the
+  sub-board (+15) and the center cell (+2).  Sending the opponent to a sub-board where it can complete a line
+  costs 12, and giving it a free choice of sub-board costs 10.
+
+Requires:
+  - u8Move_ is a legal move for eSide_ on psBoard_
+
+Promises:
+  - Returns the score; higher is better for eSide_
+*/
+s16 AntttUltimateScoreMove(const AntttUltimateBoardType* psBoard_, AntttSideType eSide_, u8 u8Move_)
+{
+  AntttUltimateBoardType sNext = *psBoard_;
+  const u16* pu16Opponent = psBoard_->au16Away;
+  u8 u8Board = ANTTT_ULTIMATE_MOVE_BOARD(u8Move_);
+  u8 u8Cell = ANTTT_ULTIMATE_MOVE_CELL(u8Move_);
+  u8 u8Next;
+  u16 u16Empty;
+  s16 s16Score = 0;
+
+  if(eSide_ == ANTTT_AWAY)
+  {
+    pu16Opponent = psBoard_->au16Home;
+  }
+
+  AntttUltimateMakeMove(&sNext, eSide_, u8Board, u8Cell);
+  if( (sNext.u8Status == ANTTT_GAME_HOME_WIN) || (sNext.u8Status == ANTTT_GAME_AWAY_WIN) )
+  {
+    return(ANTTT_SEARCH_WIN);
+  }
+
+  if( (sNext.u16HomeWon | sNext.u16AwayWon) != (psBoard_->u16HomeWon | psBoard_->u16AwayWon) )
+  {
+    s16Score += 20;
+  }
+
+  if( AntttWinningLine(pu16Opponent[u8Board] | (1 << u8Cell)) )
+  {
+    s16Score += 15;
+  }
+
+  if(u8Cell == 4)
+  {
+    s16Score += 2;
+  }
+
+  /* Where the opponent has to play next */
+  u8Next = sNext.u8ActiveBoard;
+  if(u8Next == ANTTT_NO_CELL)
+  {
+    s16Score -= 10;
+  }
+  else
+  {
+    u16Empty = (u16)(~(sNext.au16Home[u8Next] | sNext.au16Away[u8Next]) & ANTTT_BOARD_MASK);
+    for(u8 i = 0; i < ANTTT_CELLS; i++)
+    {
+      if( (u16Empty & (1 << i)) && AntttWinningLine(pu16Opponent[u8Next] | (1 << i)) )
+      {
+        s16Score -= 12;
+        break;
+      }
+    }
+  }
+
+  return(s16Score);
+
+} /* end AntttUltimateScoreMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttUltimateViewTick
+
+Description:
+Counts down the current ultimate view by the ms since the last pass and switches between the sub-board and
+meta-board views when it expires.  Called once per pass while an ultimate game is active.
+
+Requires:
+  - Anttt_u32Timeout is the time left on the current view (1 or more)
+  - Anttt_u32PassMs is the time since the last pass
+
+Promises:
+  - On expiry the other view is shown (the meta-board only while any sub-board is open) and its time is loaded
+*/
+void AntttUltimateViewTick(void)
+{
+  if(Anttt_u32Timeout > Anttt_u32PassMs)
+  {
+    Anttt_u32Timeout -= Anttt_u32PassMs;
+  }
+  else
+  {
+    Anttt_bSubBoardView = !Anttt_bSubBoardView && (Anttt_sUltimate.u8ActiveBoard != ANTTT_NO_CELL);
+    Anttt_u32Timeout = Anttt_bSubBoardView ? ANTTT_ULTIMATE_SUB_VIEW_MS : ANTTT_ULTIMATE_META_VIEW_MS;
+    AntttShowUltimateBoard(Anttt_bSubBoardView);
+  }
+
+} /* end AntttUltimateViewTick() */
+
+
+#ifdef ANTTT_BENCHMARK
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttBenchmark
+
+Description:
+Times AntttGameStatus(), AntttSymCanonicalize() and AntttTableLookup() on every position of the 3^9 cell
+combinations, and AntttMakeMove() + AntttGameStatus() for every empty cell of every position, using TIMER1
+captures.  Then runs ANTTT_BENCHMARK_PLAYOUTS tree search iterations from the empty ultimate board in slices, as
+in play, for the playout rate.  Results are left in Anttt_sBenchmark for inspection with the debugger.
+
+Requires:
+  - SysTickSetup() has started TIMER1
+
+Promises:
+  - Anttt_sBenchmark holds average and worst case cycle counts
+*/
+void AntttBenchmark(void)
+{
+  u8 au8Digits[ANTTT_CELLS] = {0};
+  AntttBoardType sBoard;
+  AntttBoardType sMove;
+  u32 u32Start;
+  u32 u32Cycles;
+  u32 u32Overhead;
+  u32 u32StatusTotal = 0;
+  u32 u32MoveTotal = 0;
+  u32 u32CanonicalTotal = 0;
+  u32 u32LookupTotal = 0;
+  u32 u32Moves = 0;
+  u16 u16Own;
+  u16 u16Opponent;
+  AntttMctsStateType sUltimate;
+  const AntttMctsStatsType* psMctsStats = AntttMctsGetStats();
+  volatile AntttGameStatusType eResult;
+  volatile u8 u8Result;
+
+  /* Cost of the capture itself so it can be removed from every measurement */
+  u32Start = SystemCycleCapture();
+  u32Overhead = SystemCyclesElapsed(u32Start);
+
+  Anttt_sBenchmark.u32PositionsTested = 0;
+  Anttt_sBenchmark.u32WorstCyclesPerStatus = 0;
+  Anttt_sBenchmark.u32WorstCyclesPerMove = 0;
+  Anttt_sBenchmark.u32WorstCyclesPerCanonicalize = 0;
+  Anttt_sBenchmark.u32WorstCyclesPerLookup = 0;
+
+  /* Count through all 3^9 combinations: 0 = empty, 1 = HOME, 2 = AWAY */
+  do
+  {
+    sBoard.u16Home = 0;
+    sBoard.u16Away = 0;
+    for(u8 i = 0; i < ANTTT_CELLS; i++)
+    {
+      if(au8Digits[i] == 1)
+      {
+        sBoard.u16Home |= (1 << i);
+      }
+      else if(au8Digits[i] == 2)
+      {
+        sBoard.u16Away |= (1 << i);
+      }
+    }
+
+    u32Start = SystemCycleCapture();
+    eResult = AntttGameStatus(&sBoard);
+    u32Cycles = SystemCyclesElapsed(u32Start) - u32Overhead;
+
+    u32StatusTotal += u32Cycles;
+    Anttt_sBenchmark.u32PositionsTested++;
+    if(u32Cycles > Anttt_sBenchmark.u32WorstCyclesPerStatus)
+    {
+      Anttt_sBenchmark.u32WorstCyclesPerStatus = u32Cycles;
+    }
+
+    u16Own = sBoard.u16Home;
+    u16Opponent = sBoard.u16Away;
+    u32Start = SystemCycleCapture();
+    u8Result = AntttSymCanonicalize(&u16Own, &u16Opponent);
+    u32Cycles = SystemCyclesElapsed(u32Start) - u32Overhead;
+
+    u32CanonicalTotal += u32Cycles;
+    if(u32Cycles > Anttt_sBenchmark.u32WorstCyclesPerCanonicalize)
+    {
+      Anttt_sBenchmark.u32WorstCyclesPerCanonicalize = u32Cycles;
+    }
+
+    u32Start = SystemCycleCapture();
+    u8Result = AntttTableLookup(sBoard.u16Home, sBoard.u16Away);
+    u32Cycles = SystemCyclesElapsed(u32Start) - u32Overhead;
+
+    u32LookupTotal += u32Cycles;
+    if(u32Cycles > Anttt_sBenchmark.u32WorstCyclesPerLookup)
+    {
+      Anttt_sBenchmark.u32WorstCyclesPerLookup = u32Cycles;
+    }
+
+    /* Time a move into each empty cell */
+    for(u8 i = 0; i < ANTTT_CELLS; i++)
+    {
+      if(au8Digits[i] == 0)
+      {
+        sMove = sBoard;
+        u32Start = SystemCycleCapture();
+        AntttMakeMove(&sMove, ANTTT_HOME, i);
+        eResult = AntttGameStatus(&sMove);
+        u32Cycles = SystemCyclesElapsed(u32Start) - u32Overhead;
+
+        u32MoveTotal += u32Cycles;
+        u32Moves++;
+        if(u32Cycles > Anttt_sBenchmark.u32WorstCyclesPerMove)
+        {
+          Anttt_sBenchmark.u32WorstCyclesPerMove = u32Cycles;
+        }
+      }
+    }
+
+    /* Next combination */
+    for(u8 i = 0; i < ANTTT_CELLS; i++)
+    {
+      if(++au8Digits[i] < 3)
+      {
+        break;
+      }
+      au8Digits[i] = 0;
+    }
+  } while( (au8Digits[0] | au8Digits[1] | au8Digits[2] | au8Digits[3] | au8Digits[4] |
+            au8Digits[5] | au8Digits[6] | au8Digits[7] | au8Digits[8]) != 0 );
+
+  (void)eResult;
+  (void)u8Result;
+  Anttt_sBenchmark.u32CyclesPerStatus = u32StatusTotal / Anttt_sBenchmark.u32PositionsTested;
+  Anttt_sBenchmark.u32CyclesPerMove = u32MoveTotal / u32Moves;
+  Anttt_sBenchmark.u32PositionsPerSecond = HFCLK_FREQ / Anttt_sBenchmark.u32CyclesPerStatus;
+  Anttt_sBenchmark.u32CyclesPerCanonicalize = u32CanonicalTotal / Anttt_sBenchmark.u32PositionsTested;
+  Anttt_sBenchmark.u32CanonicalizationsPerSecond = HFCLK_FREQ / Anttt_sBenchmark.u32CyclesPerCanonicalize;
+  Anttt_sBenchmark.u32CyclesPerLookup = u32LookupTotal / Anttt_sBenchmark.u32PositionsTested;
+
+  /* Tree search playouts from the empty ultimate board */
+  AntttUltimateClear(&sUltimate.sUltimate);
+  AntttMctsNewGame(&G_sAntttMctsUltimate, &sUltimate, ANTTT_HOME);
+  AntttMctsStart(ANTTT_BENCHMARK_PLAYOUTS, 0);
+  while( !AntttMctsRun(ANTTT_SEARCH_MAX_BUDGET_US) );
+
+  Anttt_sBenchmark.u32CyclesPerPlayout = psMctsStats->u32LastCycles / psMctsStats->u32LastPlayouts;
+  Anttt_sBenchmark.u32PlayoutsPerSecond = psMctsStats->u32PlayoutsPerSecond;
+
+} /* end AntttBenchmark() */
+#endif /* ANTTT_BENCHMARK */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* State Machine definitions                                                                                          */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSM_Idle
+Game in progress: redraw the board whenever it changes and let the on-board opponent reply on its turn.
+*/
+void AntttSM_Idle(void)
+{
+  if(G_u32AntttFlags & _ANTTT_BOARD_CHANGED)
+  {
+    G_u32AntttFlags &= ~_ANTTT_BOARD_CHANGED;
+    AntttShowBoard();
+
+    if(G_u32AntttFlags & _ANTTT_GAME_OVER)
+    {
+      Anttt_pfnStateMachine = AntttSM_GameOver;
+    }
+  }
+  
+  else if( Anttt_bComputerEnabled && (Anttt_eStatus == ANTTT_GAME_ACTIVE) && 
+           (Anttt_eSideToMove == Anttt_eComputerSide) )
+  {
+    /* The table lookup is fast enough to reply in the same pass */
+    if(Anttt_eLevel == ANTTT_LEVEL_PERFECT)
+    {
+      AntttPlayMove( AntttBestMove(&Anttt_sBoard, Anttt_eSideToMove) );
+    }
+    else
+    {
+      AntttSearchSeed( SystemCycleCapture() );
+      AntttSearchStart(&Anttt_sBoard, Anttt_eSideToMove, Anttt_eLevel);
+      LedPlayLayer( &G_sLedTimelineWaiting, LED_LAYER_STATUS, LED_BIT(STATUS_RED) );
+      Anttt_pfnStateMachine = AntttSM_ComputerMove;
+    }
+  }
+
+} /* end AntttSM_Idle() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSM_Boot
+Wait for the LED driver's boot timeline to finish on the board LEDs, then draw the new game from Idle.
+*/
+void AntttSM_Boot(void)
+{
+  if( !LedIsPlaying(LED_HOME_MASK | LED_AWAY_MASK) )
+  {
+    Anttt_pfnStateMachine = AntttSM_Idle;
+  }
+
+} /* end AntttSM_Boot() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSM_ComputerMove
+Run the search one time slice per pass so LedUpdate() keeps its 1ms cadence, then play the move it found.
+AntttNewGame() returns to Idle and the unfinished search is dropped.
+*/
+void AntttSM_ComputerMove(void)
+{
+  if( AntttSearchRun(ANTTT_SEARCH_BUDGET_US) )
+  {
+    LedLayerClear(LED_LAYER_STATUS);
+    AntttPlayMove( AntttSearchResult() );
+    Anttt_pfnStateMachine = AntttSM_Idle;
+  }
+
+} /* end AntttSM_ComputerMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSM_UltimateIdle
+Ultimate game in progress: redraw on every move, alternate the sub-board and meta-board views while a sub-board is
+active, and let the on-board opponent reply on its turn.
+*/
+void AntttSM_UltimateIdle(void)
+{
+  u8 u8Move;
+
+  if(G_u32AntttFlags & _ANTTT_BOARD_CHANGED)
+  {
+    G_u32AntttFlags &= ~_ANTTT_BOARD_CHANGED;
+
+    if(G_u32AntttFlags & _ANTTT_GAME_OVER)
+    {
+      AntttShowUltimateBoard(false);
+      Anttt_pfnStateMachine = AntttSM_UltimateGameOver;
+      return;
+    }
+
+    /* Start on the sub-board that has to be played */
+    Anttt_bSubBoardView = (Anttt_sUltimate.u8ActiveBoard != ANTTT_NO_CELL);
+    Anttt_u32Timeout = Anttt_bSubBoardView ? ANTTT_ULTIMATE_SUB_VIEW_MS : ANTTT_ULTIMATE_META_VIEW_MS;
+    AntttShowUltimateBoard(Anttt_bSubBoardView);
+  }
+
+  else if( Anttt_bComputerEnabled && (Anttt_eStatus == ANTTT_GAME_ACTIVE) &&
+           (Anttt_eSideToMove == Anttt_eComputerSide) )
+  {
+    /* Scoring at most 81 moves fits in one pass; the tree search thinks over many */
+    if(Anttt_eLevel >= ANTTT_LEVEL_HARD)
+    {
+      AntttMctsSeed( SystemCycleCapture() );
+      AntttMctsStart(0, ANTTT_MCTS_MOVE_MS);
+      LedPlayLayer( &G_sLedTimelineWaiting, LED_LAYER_STATUS, LED_BIT(STATUS_RED) );
+      Anttt_pfnStateMachine = AntttSM_UltimateComputerMove;
+    }
+    else
+    {
+      u8Move = AntttUltimateChooseMove(&Anttt_sUltimate, Anttt_eSideToMove);
+      AntttPlayUltimateMove( ANTTT_ULTIMATE_MOVE_BOARD(u8Move), ANTTT_ULTIMATE_MOVE_CELL(u8Move) );
+    }
+  }
+
+  else if(Anttt_eStatus == ANTTT_GAME_ACTIVE)
+  {
+    AntttUltimateViewTick();
+  }
+
+} /* end AntttSM_UltimateIdle() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSM_UltimateComputerMove
+Run the tree search one time slice per pass, keeping the views alternating, then play the move it found.
+AntttNewUltimateGame() or AntttNewGame() drops the unfinished search.
+*/
+void AntttSM_UltimateComputerMove(void)
+{
+  u8 u8Move;
+
+  if( AntttMctsRun(ANTTT_SEARCH_BUDGET_US) )
+  {
+    u8Move = AntttMctsResult();
+    LedLayerClear(LED_LAYER_STATUS);
+    AntttPlayUltimateMove( ANTTT_ULTIMATE_MOVE_BOARD(u8Move), ANTTT_ULTIMATE_MOVE_CELL(u8Move) );
+    Anttt_pfnStateMachine = AntttSM_UltimateIdle;
+  }
+  else
+  {
+    AntttUltimateViewTick();
+  }
+
+} /* end AntttSM_UltimateComputerMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSM_UltimateGameOver
+Blink the winning line of sub-boards on the meta-board (or flash STATUS_YLW for a draw), then wait in
+AntttSM_UltimateIdle for a new game.
+*/
+void AntttSM_UltimateGameOver(void)
+{
+  if(Anttt_eStatus == ANTTT_GAME_HOME_WIN)
+  {
+    LedPlayLayer( &G_sLedTimelineWinLine, LED_LAYER_OVERLAY,
+                  (u32)AntttWinningLine(Anttt_sUltimate.u16HomeWon) << HOME1 );
+  }
+  else if(Anttt_eStatus == ANTTT_GAME_AWAY_WIN)
+  {
+    LedPlayLayer( &G_sLedTimelineWinLine, LED_LAYER_OVERLAY,
+                  (u32)AntttWinningLine(Anttt_sUltimate.u16AwayWon) << AWAY1 );
+  }
+  else
+  {
+    LedPlayLayer( &G_sLedTimelineDraw, LED_LAYER_OVERLAY, LED_BIT(STATUS_YLW) );
+  }
+
+  Anttt_pfnStateMachine = AntttSM_UltimateIdle;
+
+} /* end AntttSM_UltimateGameOver() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSM_GameOver
+Blink the winning line (or flash STATUS_YLW for a draw) then wait in Idle for AntttNewGame().
+*/
+void AntttSM_GameOver(void)
+{
+  if(Anttt_eStatus == ANTTT_GAME_HOME_WIN)
+  {
+    LedPlayLayer( &G_sLedTimelineWinLine, LED_LAYER_OVERLAY, (u32)AntttWinningLine(Anttt_sBoard.u16Home) << HOME1 );
+  }
+  else if(Anttt_eStatus == ANTTT_GAME_AWAY_WIN)
+  {
+    LedPlayLayer( &G_sLedTimelineWinLine, LED_LAYER_OVERLAY, (u32)AntttWinningLine(Anttt_sBoard.u16Away) << AWAY1 );
+  }
+  else
+  {
+    LedPlayLayer( &G_sLedTimelineDraw, LED_LAYER_OVERLAY, LED_BIT(STATUS_YLW) );
+  }
 
+  /* Nothing else to do until a new game is started */
+  Anttt_pfnStateMachine = AntttSM_Idle;
+  G_u32AntttFlags &= ~_ANTTT_GAME_OVER;
 
+} /* end AntttSM_GameOver() */
 
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -1,5 +1,5 @@
 /**********************************************************************************************************************
-File: anttt.h                                                                
+File: anttt.h
 **********************************************************************************************************************/
 
 #ifndef __ANTTT_H
@@ -8,6 +8,56 @@ File: anttt.h
 /**********************************************************************************************************************
 Type Definitions
 **********************************************************************************************************************/
+typedef enum {ANTTT_HOME = 0, ANTTT_AWAY = 1} AntttSideType;
+
+typedef enum {ANTTT_GAME_ACTIVE = 0, ANTTT_GAME_HOME_WIN, ANTTT_GAME_AWAY_WIN, ANTTT_GAME_DRAW} AntttGameStatusType;
+
+/* Board position held as two 9-bit cell masks.  Bit n is cell n+1 which matches the LedNumberType order,
+so BIT0 is HOME1/AWAY1 and BIT8 is HOME9/AWAY9. Cells are numbered left to right, top to bottom. */
+#define ANTTT_CELLS             (u8)9             /* Cells on the board */
+
+typedef struct
+{
+  u16 u16Home;                                      /* Cells occupied by HOME */
+  u16 u16Away;                                      /* Cells occupied by AWAY */
+} AntttBoardType;
+
+/* Ultimate tic-tac-toe: 9 sub-boards of 9 cells.  Each side's 81 cells are 9 sub-board masks in the same cell
+order as AntttBoardType, and the summary masks (bit n = sub-board n) are updated by each move so legality and the
+meta-board win check never rescan the sub-boards. */
+typedef struct
+{
+  u16 au16Home[ANTTT_CELLS];                        /* Cells occupied by HOME in each sub-board */
+  u16 au16Away[ANTTT_CELLS];                        /* Cells occupied by AWAY in each sub-board */
+  u16 u16HomeWon;                                   /* Sub-boards won by HOME */
+  u16 u16AwayWon;                                   /* Sub-boards won by AWAY */
+  u16 u16Closed;                                    /* Sub-boards won or full: no more moves there */
+  u8 u8ActiveBoard;                                 /* Sub-board for the next move, ANTTT_NO_CELL = any open one */
+  u8 u8Status;                                      /* AntttGameStatusType of the whole game */
+} AntttUltimateBoardType;
+
+/* Strength of the on-board opponent.  EASY to HARD use the time-sliced search in anttt_search.c with the depth limit
+and evaluation noise set by the level; PERFECT replies from the perfect-play table in the same pass. */
+typedef enum {ANTTT_LEVEL_EASY = 0, ANTTT_LEVEL_MEDIUM, ANTTT_LEVEL_HARD, ANTTT_LEVEL_PERFECT} AntttLevelType;
+
+#ifdef ANTTT_BENCHMARK
+typedef struct
+{
+  u32 u32PositionsTested;                           /* Number of positions timed */
+  u32 u32CyclesPerStatus;                           /* Average cycles for AntttGameStatus() */
+  u32 u32WorstCyclesPerStatus;                      /* Worst case cycles for AntttGameStatus() */
+  u32 u32CyclesPerMove;                             /* Average cycles for AntttMakeMove() + AntttGameStatus() */
+  u32 u32WorstCyclesPerMove;                        /* Worst case cycles for AntttMakeMove() + AntttGameStatus() */
+  u32 u32PositionsPerSecond;                        /* Status checks per second at the average cost */
+  u32 u32CyclesPerCanonicalize;                     /* Average cycles for AntttSymCanonicalize() */
+  u32 u32WorstCyclesPerCanonicalize;                /* Worst case cycles for AntttSymCanonicalize() */
+  u32 u32CanonicalizationsPerSecond;                /* Canonicalizations per second at the average cost */
+  u32 u32CyclesPerLookup;                           /* Average cycles for AntttTableLookup() */
+  u32 u32WorstCyclesPerLookup;                      /* Worst case cycles for AntttTableLookup() */
+  u32 u32CyclesPerPlayout;                          /* Average cycles per tree search iteration (ultimate) */
+  u32 u32PlayoutsPerSecond;                         /* Tree search playouts per second from the empty board */
+} AntttBenchmarkType;
+#endif /* ANTTT_BENCHMARK */
 
 
 /**********************************************************************************************************************
@@ -15,6 +65,50 @@ Constants / Definitions
 **********************************************************************************************************************/
 #define ANTTT_DEVICE_TYPE       (u8)20
 
+#define ANTTT_BOARD_MASK        (u16)0x01FF       /* All 9 cells */
+#define ANTTT_WIN_LINES         (u8)8             /* Rows, columns and diagonals */
+#define ANTTT_NO_CELL           (u8)0xFF          /* Returned when there is no cell to report */
+#define ANTTT_LEVELS            (u8)4             /* Number of AntttLevelType values */
+
+/* Perfect-play table (anttt_table.c): one byte per base-3 position key.  Key digit n is 0 for an empty cell,
+1 for the side to move and 2 for the opponent, so the key is Pow3(own) + 2 * Pow3(opponent). */
+#define ANTTT_TABLE_SIZE        (u16)19683        /* 3^9 */
+#define ANTTT_TABLE_CELL_MASK   (u8)0x0F          /* Best cell 0-8, or ANTTT_TABLE_NO_CELL for game over / invalid */
+#define ANTTT_TABLE_NO_CELL     (u8)0x0F
+#define ANTTT_TABLE_VALUE_SHIFT (u8)4             /* Game-theoretic value for the side to move */
+#define ANTTT_TABLE_VALUE_MASK  (u8)0x30
+
+#define ANTTT_VALUE_LOSS        (u8)0
+#define ANTTT_VALUE_DRAW        (u8)1
+#define ANTTT_VALUE_WIN         (u8)2
+#define ANTTT_VALUE_INVALID     (u8)3             /* Position cannot be reached in a legal game */
+
+/* Canonical table (default, see ANTTT_TABLE_FULL): only positions that are their own symmetry-canonical form
+(anttt_symmetry.c) are stored, as a sorted list of keys with one entry byte each.  Cells are stored in the
+canonical frame and are mapped back onto the physical board by AntttTableLookup(). */
+#define ANTTT_CANONICAL_SIZE    (u16)765          /* Reachable canonical positions */
+
+#define ANTTT_TABLE_CELL(u8Entry)   (u8)((u8Entry) & ANTTT_TABLE_CELL_MASK)
+#define ANTTT_TABLE_VALUE(u8Entry)  (u8)(((u8Entry) & ANTTT_TABLE_VALUE_MASK) >> ANTTT_TABLE_VALUE_SHIFT)
+
+/* Ultimate moves are packed as sub-board in the high nibble and cell in the low nibble */
+#define ANTTT_ULTIMATE_MOVES                (u8)81
+#define ANTTT_ULTIMATE_MOVE(u8Board, u8Cell) (u8)(((u8Board) << 4) | (u8Cell))
+#define ANTTT_ULTIMATE_MOVE_BOARD(u8Move)    (u8)((u8Move) >> 4)
+#define ANTTT_ULTIMATE_MOVE_CELL(u8Move)     (u8)((u8Move) & 0x0F)
+
+#define ANTTT_ULTIMATE_SUB_VIEW_MS          (u32)1500 /* Time the active sub-board is shown */
+#define ANTTT_ULTIMATE_META_VIEW_MS         (u32)500  /* Time the meta-board is shown between sub-board views */
+#define ANTTT_NO_DEADLINE                   (u32)0xFFFFFFFF /* AntttMsToNextRun(): idle until the game is changed */
+
+#define ANTTT_BENCHMARK_PLAYOUTS            (u32)200  /* Tree search playouts timed by AntttBenchmark() */
+
+/* G_u32AntttFlags */
+#define _ANTTT_BOARD_CHANGED    0x00000001        /* Set when the board has changed and the LEDs need to be redrawn */
+#define _ANTTT_GAME_OVER        0x00000002        /* Set when the current game has been won or drawn */
+#define _ANTTT_ULTIMATE         0x00000004        /* Set when the current game is ultimate tic-tac-toe */
+
+
 /**********************************************************************************************************************
 Function Declarations
 **********************************************************************************************************************/
@@ -22,18 +116,65 @@ Function Declarations
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Public functions                                                                                                   */
 /*--------------------------------------------------------------------------------------------------------------------*/
+void AntttNewGame(AntttSideType eFirstSide_);
+bool AntttPlayMove(u8 u8Cell_);
+AntttGameStatusType AntttGetStatus(void);
+bool AntttUndoMove(void);
+bool AntttRedoMove(void);
+bool AntttShowHistory(u8 u8Age_, u8 u8Ply_);
+
+bool AntttIsLegalMove(const AntttBoardType* psBoard_, u8 u8Cell_);
+bool AntttMakeMove(AntttBoardType* psBoard_, AntttSideType eSide_, u8 u8Cell_);
+u16 AntttWinningLine(u16 u16Cells_);
+u8 AntttOpenLines(u16 u16Own_, u16 u16Opponent_);
+AntttGameStatusType AntttGameStatus(const AntttBoardType* psBoard_);
+
+void AntttSetComputer(AntttSideType eSide_, bool bEnabled_);
+void AntttSetLevel(AntttLevelType eLevel_);
+u16 AntttTableKey(u16 u16Own_, u16 u16Opponent_);
+u8 AntttTableLookup(u16 u16Own_, u16 u16Opponent_);
+u8 AntttBestMove(const AntttBoardType* psBoard_, AntttSideType eSide_);
+
+void AntttNewUltimateGame(AntttSideType eFirstSide_);
+bool AntttPlayUltimateMove(u8 u8Board_, u8 u8Cell_);
+void AntttUltimateClear(AntttUltimateBoardType* psBoard_);
+bool AntttUltimateIsLegalMove(const AntttUltimateBoardType* psBoard_, u8 u8Board_, u8 u8Cell_);
+bool AntttUltimateMakeMove(AntttUltimateBoardType* psBoard_, AntttSideType eSide_, u8 u8Board_, u8 u8Cell_);
+u8 AntttUltimateLegalMoves(const AntttUltimateBoardType* psBoard_, u8* pu8Moves_);
+u8 AntttUltimateChooseMove(const AntttUltimateBoardType* psBoard_, AntttSideType eSide_);
 
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Protected functions                                                                                                */
 /*--------------------------------------------------------------------------------------------------------------------*/
 void AntttInitialize(void);
+void AntttRunActiveState(void);
+u32 AntttMsToNextRun(void);
 
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Private functions                                                                                                  */
 /*--------------------------------------------------------------------------------------------------------------------*/
+void AntttShowBoard(void);
+void AntttShowCells(u16 u16Home_, u16 u16Away_);
+void AntttShowUltimateBoard(bool bSubBoardView_);
+s16 AntttUltimateScoreMove(const AntttUltimateBoardType* psBoard_, AntttSideType eSide_, u8 u8Move_);
+void AntttUltimateViewTick(void);
+#ifdef ANTTT_BENCHMARK
+void AntttBenchmark(void);
+#endif /* ANTTT_BENCHMARK */
+
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* State Machine declarations                                                                                         */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttSM_Boot(void);
+void AntttSM_Idle(void);
+void AntttSM_ComputerMove(void);
+void AntttSM_UltimateIdle(void);
+void AntttSM_UltimateComputerMove(void);
+void AntttSM_UltimateGameOver(void);
+void AntttSM_GameOver(void);
 
 
 #endif /* __ANTTT_H */
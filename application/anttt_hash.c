@@ -0,0 +1,329 @@
+/**********************************************************************************************************************
+File: anttt_hash.c
+
+Description:
+Zobrist hashing and a fixed-size transposition table for the searches.
+
+A position's key is the XOR of one random 32-bit value per occupied square and side (AntttHash_au32Square), plus
+AntttHash_u32SideKey when AWAY is to move.  Playing or taking back a move is then a single AntttHashMove(): XOR in
+the square's value and flip the side key.  Squares are numbered up to ANTTT_HASH_SQUARES so ultimate positions
+(sub-board * 9 + cell) can be hashed the same way.  The values are fixed in flash so keys are the same on every
+build and on the host.
+
+The table is ANTTT_HASH_TABLE_BYTES of RAM (set in configuration.h), one 8-byte entry per slot, indexed by the low
+bits of the key with the upper 16 bits kept as a check.  Replacement is depth-preferred: a slot is overwritten by
+the same position, by any store if its entry is from an earlier search (AntttHashNewSearch()), or by a store
+searched at least as deep.  A shallower result for a different position is dropped.  Generation 0 marks an empty
+slot.
+
+Probe, hit and replacement counters are kept in AntttHash_sStats so the RAM split between the table and the LED
+and ANT buffers can be tuned from the hit rate.  host/anttt_search_bench.c reports them for each level.
+
+------------------------------------------------------------------------------------------------------------------------
+API:
+u32 AntttHashMove(u32 u32Key_, AntttSideType eSide_, u8 u8Square_)
+Returns the key after eSide_ plays (or takes back) u8Square_.
+
+u32 AntttHashBoard(const AntttBoardType* psBoard_, AntttSideType eSideToMove_)
+Returns the key of a 3x3 position from scratch.
+
+const AntttHashEntryType* AntttHashProbe(u32 u32Key_)
+Returns the stored entry for the position, or NULL.
+
+void AntttHashStore(u32 u32Key_, u8 u8Depth_, s16 s16Score_, AntttHashBoundType eBound_, u8 u8Move_)
+Stores a search result subject to the replacement policy.
+
+void AntttHashNewSearch(void)
+Starts a new generation: entries from earlier searches are kept but may be replaced by anything.
+
+void AntttHashClear(void)
+Empties the table.
+
+const AntttHashStatsType* AntttHashGetStats(void)
+Probe and store counters.
+
+Protected:
+void AntttHashInitialize(void)
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "AntttHash_" and be declared as static.
+***********************************************************************************************************************/
+static AntttHashEntryType AntttHash_asTable[ANTTT_HASH_ENTRIES];  /* The transposition table */
+static u8 AntttHash_u8Generation = 1;                    /* Stamp for entries of the current search, never 0 */
+
+static AntttHashStatsType AntttHash_sStats;              /* Counters for the debugger */
+
+/* Zobrist values: [AntttSideType][square].  xorshift32 from 0x9E3779B9. */
+static const u32 AntttHash_au32Square[2][ANTTT_HASH_SQUARES] =
+{
+  {
+    0x510C4619, 0xE02E553E, 0x7BB98F3A, 0x0183A8B5, 0xE6336D1F, 0xF989D237, 0xBA2529D0, 0xFCFBEDBF,
+    0xA8C5EE39, 0xB55A53B8, 0x1A88A9EE, 0xF918A8B4, 0x6DC588D3, 0x472F513C, 0x0C1870B8, 0x43E1465F,
+    0x0E78EA8A, 0x761DC0DE, 0x0ECA9C7D, 0xF5E7493F, 0x84D44CBF, 0xA536E9DE, 0x79AFAED8, 0x02E9F4A2,
+    0xB3C8F91C, 0x318EC249, 0xD13543EA, 0x504FD68E, 0xF9563BE1, 0xFB6A9A74, 0xACAD82A6, 0x83D0D79A,
+    0xBD58BA6B, 0xE8A46341, 0xFD4255C7, 0x48A7297A, 0x1C8FC87E, 0x558F2D7E, 0xB43618AE, 0x935F84DF,
+    0x1B4EF29D, 0x66BB3273, 0x1E5F1329, 0x7B73EBB4, 0xC6A87E76, 0xE5BD8265, 0xEBD01B3D, 0xFE4E23A6,
+    0x7D6529DB, 0xD39A9B74, 0x9E7F3ACE, 0x5DFE0DFD, 0x147D987D, 0x493F1344, 0xC1AF1B0F, 0x7B13A768,
+    0xF02AB277, 0x6AE429E5, 0x14C73F29, 0x976EB1B8, 0x6A6BB394, 0x9F3E8E98, 0x9358942E, 0xBA7F8CC0,
+    0x37128F53, 0xB9E359CF, 0x8980C4E2, 0xB28541EC, 0x4DA15AB0, 0xB81A50AB, 0xB3E67C2C, 0xF01B81BD,
+    0x85A054CB, 0x681719B7, 0xEF1638C7, 0x29D754C0, 0xAAA99987, 0xAABF9C2B, 0x7E60C676, 0xB3689101,
+    0x8854D505
+  },
+  {
+    0x4C7BF39F, 0x730959FB, 0x5EF4A9E0, 0xB2D14C84, 0xF371A5A4, 0x3F6D8E86, 0x591C32D8, 0x37ACF21B,
+    0x94171B6C, 0x982EBAF1, 0xA1671469, 0x3EA8A61C, 0x670D5609, 0x744E0D0F, 0x081948F8, 0x01CD571B,
+    0xCEE2330C, 0x98FD1EED, 0x5F34CCDD, 0x134EFECA, 0x5E6CC8A1, 0x2869E8BD, 0xBAB60242, 0x2531989D,
+    0xD264420C, 0x1E980CDE, 0xFF7BA8BF, 0xC7EDBCA9, 0x7F6C3635, 0xCCF7B6E0, 0x7F5ED555, 0x1B70D24F,
+    0x261F68B3, 0xAA24CBD7, 0x58987D78, 0xB1DD8A83, 0x1130B265, 0xE8FE2ABB, 0x9882D18F, 0x94D94A16,
+    0x0EE14FBB, 0xC5D1BA30, 0xA06FAC1B, 0xE8703B4D, 0x0C2474E1, 0xD5BAA21D, 0xBED11EC1, 0x3C2778E5,
+    0xB44D9E78, 0xF7D12A99, 0x82CE18D8, 0x7B723E72, 0xAB3065AC, 0x57337BAE, 0x3092562D, 0x30AEABC6,
+    0x5F153C8D, 0xE818F92F, 0x10913491, 0xF662FD90, 0x93C58678, 0x4258685D, 0xA52E1174, 0x8714FC74,
+    0x0BD47719, 0x23D5A5C2, 0x7AD860F4, 0xAE1DA977, 0x7D5BD92E, 0xC9BD5831, 0x35D264EC, 0x50B4D12B,
+    0x98AB5803, 0x86C37B16, 0xDD983706, 0xB46BCDFA, 0x77498910, 0x8B1EEE85, 0x8F02D9A2, 0x52E88499,
+    0x0D0B3124
+  }
+};
+
+static const u32 AntttHash_u32SideKey = 0x0EDF12D3;     /* XORed in while AWAY is to move */
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashMove
+
+Description:
+Updates a key for one move.  XOR is its own inverse, so the same call with the same arguments takes the move back.
+
+Requires:
+  - u32Key_ is the key of the position before the move (after it, to take the move back)
+  - u8Square_ is below ANTTT_HASH_SQUARES
+
+Promises:
+  - Returns u32Key_ with eSide_ on u8Square_ toggled and the side to move flipped
+*/
+u32 AntttHashMove(u32 u32Key_, AntttSideType eSide_, u8 u8Square_)
+{
+  return( u32Key_ ^ AntttHash_au32Square[eSide_][u8Square_] ^ AntttHash_u32SideKey );
+
+} /* end AntttHashMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashBoard
+
+Description:
+Computes the key of a 3x3 position from its masks.  Searches do this once at the root and use AntttHashMove()
+below it.
+
+Requires:
+  - psBoard_ points to a valid board with eSideToMove_ to move
+
+Promises:
+  - Returns the Zobrist key
+*/
+u32 AntttHashBoard(const AntttBoardType* psBoard_, AntttSideType eSideToMove_)
+{
+  u32 u32Key = (eSideToMove_ == ANTTT_AWAY) ? AntttHash_u32SideKey : 0;
+
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    if(psBoard_->u16Home & (1 << i))
+    {
+      u32Key ^= AntttHash_au32Square[ANTTT_HOME][i];
+    }
+    else if(psBoard_->u16Away & (1 << i))
+    {
+      u32Key ^= AntttHash_au32Square[ANTTT_AWAY][i];
+    }
+  }
+
+  return(u32Key);
+
+} /* end AntttHashBoard() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashProbe
+
+Description:
+Looks a position up in the table.
+
+Requires:
+  - u32Key_ is the position's Zobrist key
+
+Promises:
+  - Returns the entry if its check bits match (any generation), otherwise NULL
+  - AntttHash_sStats probe and hit counters are updated
+*/
+const AntttHashEntryType* AntttHashProbe(u32 u32Key_)
+{
+  const AntttHashEntryType* psEntry = &AntttHash_asTable[u32Key_ & ANTTT_HASH_INDEX_MASK];
+
+  AntttHash_sStats.u32Probes++;
+  if( (psEntry->u8Generation == 0) || (psEntry->u16Check != (u16)(u32Key_ >> 16)) )
+  {
+    return(NULL);
+  }
+
+  AntttHash_sStats.u32Hits++;
+  return(psEntry);
+
+} /* end AntttHashProbe() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashStore
+
+Description:
+Stores a search result, preferring deeper results of the current search when two positions share a slot.
+
+Requires:
+  - u8Depth_ is the number of plies searched below the position
+  - s16Score_ is for the side to move, with win and loss scores made relative to this position
+  - eBound_ says whether s16Score_ is exact or a bound from an alpha-beta cutoff
+
+Promises:
+  - The slot holds the new result if it was empty, held this position, is from an earlier search, or held a result
+    no deeper than u8Depth_; otherwise it is unchanged
+*/
+void AntttHashStore(u32 u32Key_, u8 u8Depth_, s16 s16Score_, AntttHashBoundType eBound_, u8 u8Move_)
+{
+  AntttHashEntryType* psEntry = &AntttHash_asTable[u32Key_ & ANTTT_HASH_INDEX_MASK];
+  u16 u16Check = (u16)(u32Key_ >> 16);
+
+  AntttHash_sStats.u32Stores++;
+  if( (psEntry->u8Generation != 0) && (psEntry->u16Check != u16Check) )
+  {
+    if( (psEntry->u8Generation == AntttHash_u8Generation) && (psEntry->u8Depth > u8Depth_) )
+    {
+      AntttHash_sStats.u32Kept++;
+      return;
+    }
+    AntttHash_sStats.u32Replacements++;
+  }
+
+  psEntry->u16Check = u16Check;
+  psEntry->s16Score = s16Score_;
+  psEntry->u8Depth = u8Depth_;
+  psEntry->u8Bound = (u8)eBound_;
+  psEntry->u8Move = u8Move_;
+  psEntry->u8Generation = AntttHash_u8Generation;
+
+} /* end AntttHashStore() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashNewSearch
+
+Description:
+Starts a new generation.  Results from earlier searches can still be probed but no longer protect their slots.
+
+Requires:
+  -
+
+Promises:
+  - AntttHash_u8Generation moves on, skipping 0
+*/
+void AntttHashNewSearch(void)
+{
+  if(++AntttHash_u8Generation == 0)
+  {
+    AntttHash_u8Generation = 1;
+  }
+
+} /* end AntttHashNewSearch() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashClear
+
+Description:
+Empties the table.  Needed when stored scores no longer apply, e.g. the evaluation changes.
+
+Requires:
+  -
+
+Promises:
+  - Every slot is empty
+*/
+void AntttHashClear(void)
+{
+  memset(AntttHash_asTable, 0, sizeof(AntttHash_asTable));
+
+} /* end AntttHashClear() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashGetStats
+
+Description:
+Returns the table counters.  The hit rate is u32Hits / u32Probes.
+
+Requires:
+  -
+
+Promises:
+  - Returns a pointer to the counters, which are updated by every probe and store
+*/
+const AntttHashStatsType* AntttHashGetStats(void)
+{
+  return(&AntttHash_sStats);
+
+} /* end AntttHashGetStats() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttHashInitialize
+
+Description:
+Empties the table and zeroes the counters.
+
+Requires:
+  -
+
+Promises:
+  - Every slot is empty and AntttHash_sStats is zeroed
+*/
+void AntttHashInitialize(void)
+{
+  AntttHashClear();
+  AntttHash_u8Generation = 1;
+  memset(&AntttHash_sStats, 0, sizeof(AntttHash_sStats));
+
+} /* end AntttHashInitialize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,85 @@
+/**********************************************************************************************************************
+File: anttt_hash.h
+
+Description:
+Header file for anttt_hash.c
+**********************************************************************************************************************/
+
+#ifndef __ANTTT_HASH_H
+#define __ANTTT_HASH_H
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+/* What a stored score says about the position's true score */
+typedef enum {ANTTT_HASH_EXACT = 0, ANTTT_HASH_LOWER, ANTTT_HASH_UPPER} AntttHashBoundType;
+
+/* One transposition table entry (8 bytes) */
+typedef struct
+{
+  u16 u16Check;                                     /* Upper 16 bits of the Zobrist key */
+  s16 s16Score;                                     /* Score for the side to move, wins/losses relative to this node */
+  u8 u8Depth;                                       /* Plies searched below this node */
+  u8 u8Bound;                                       /* AntttHashBoundType */
+  u8 u8Move;                                        /* Best move found, ANTTT_NO_CELL if none */
+  u8 u8Generation;                                  /* Search that stored it (AntttHashNewSearch()) */
+} AntttHashEntryType;
+
+typedef struct
+{
+  u32 u32Probes;                                    /* AntttHashProbe() calls */
+  u32 u32Hits;                                      /* Probes that found the position */
+  u32 u32Stores;                                    /* AntttHashStore() calls */
+  u32 u32Replacements;                              /* Stores that overwrote a different position */
+  u32 u32Kept;                                      /* Stores dropped to keep a deeper entry of this search */
+} AntttHashStatsType;
+
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+/* ANTTT_HASH_TABLE_BYTES is set in configuration.h */
+#define ANTTT_HASH_ENTRY_BYTES  8                 /* sizeof(AntttHashEntryType) */
+#define ANTTT_HASH_ENTRIES      (ANTTT_HASH_TABLE_BYTES / ANTTT_HASH_ENTRY_BYTES)
+#define ANTTT_HASH_INDEX_MASK   (u32)(ANTTT_HASH_ENTRIES - 1)
+
+#if (ANTTT_HASH_ENTRIES < 16) || (ANTTT_HASH_ENTRIES > 0x10000) || (ANTTT_HASH_ENTRIES & (ANTTT_HASH_ENTRIES - 1))
+#error "ANTTT_HASH_TABLE_BYTES must be 8 times a power of 2 from 16 to 65536 entries"
+#endif
+
+#define ANTTT_HASH_SQUARES      (u8)81            /* Squares with keys: enough for ultimate (sub-board * 9 + cell) */
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+u32 AntttHashMove(u32 u32Key_, AntttSideType eSide_, u8 u8Square_);
+u32 AntttHashBoard(const AntttBoardType* psBoard_, AntttSideType eSideToMove_);
+const AntttHashEntryType* AntttHashProbe(u32 u32Key_);
+void AntttHashStore(u32 u32Key_, u8 u8Depth_, s16 s16Score_, AntttHashBoundType eBound_, u8 u8Move_);
+void AntttHashNewSearch(void);
+void AntttHashClear(void);
+const AntttHashStatsType* AntttHashGetStats(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttHashInitialize(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+#endif /* __ANTTT_HASH_H */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,494 @@
+/**********************************************************************************************************************
+File: anttt_journal.c
+
+Description:
+Move journal for classic games: the current game with undo/redo, and a ring of the last ANTTT_JOURNAL_GAMES
+completed games with their result and duration.
+
+A game is at most 9 moves of cells 0-8, so each move is a 4-bit cell index packed two per byte and a whole game
+with its first side, result and duration is 12 bytes.  The side that played ply n is the first side for even n and
+the other side for odd n, so it is never stored.
+
+Undo, redo and replay all use AntttJournalToggle(): XOR the cell of one ply into its side's mask.  The same call
+makes the move or takes it back, so each step is O(1) on the bitboard and replay to any ply from the current one
+(AntttJournalSeek()) costs one step per ply crossed.  The LED display can scrub through a game that way without
+rebuilding the position from the empty board.
+
+The journal does not own a board: the caller passes the board it keeps in step with the journal.  A move recorded
+after an undo drops the moves that could have been redone.  A game goes into the history ring when the next game
+is started, as it stood then, if it was won or drawn; abandoned games are not kept.
+
+------------------------------------------------------------------------------------------------------------------------
+API:
+void AntttJournalNewGame(AntttSideType eFirstSide_)
+Files the current game in the history if it finished, and starts an empty one with eFirstSide_ to move.
+
+void AntttJournalRecord(u8 u8Cell_, AntttGameStatusType eResult_)
+Records a move played in the current game and the game status after it.
+
+u8 AntttJournalUndo(AntttBoardType* psBoard_)
+u8 AntttJournalRedo(AntttBoardType* psBoard_)
+Take back or replay one move of the current game on psBoard_.  Return the cell, or ANTTT_NO_CELL if there is none.
+
+void AntttJournalTick(u32 u32Ms_)
+Call on every pass of the game task with the ms since the last: adds to the duration of the current game while it is
+active.
+
+const AntttJournalGameType* AntttJournalCurrent(void)
+u8 AntttJournalPly(void)
+The current game and the number of its moves on the board (less than u8Plies after an undo).
+
+const AntttJournalGameType* AntttJournalHistory(u8 u8Age_)
+u8 AntttJournalHistoryCount(void)
+Completed games: age 0 is the most recent.  Returns NULL past the oldest kept.
+
+u8 AntttJournalGetMove(const AntttJournalGameType* psGame_, u8 u8Ply_)
+The cell played at u8Ply_.
+
+void AntttJournalOpen(AntttJournalCursorType* psCursor_, const AntttJournalGameType* psGame_)
+bool AntttJournalSeek(AntttJournalCursorType* psCursor_, u8 u8Ply_)
+Replay any recorded game: open a cursor on the empty board, then seek back and forth to show the position after
+any number of moves.
+
+Protected:
+void AntttJournalInitialize(void)
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "AntttJournal_" and be declared as static.
+***********************************************************************************************************************/
+static AntttJournalGameType AntttJournal_sGame;          /* The current game */
+static u8 AntttJournal_u8Ply;                            /* Moves of the current game on the board */
+
+static AntttJournalGameType AntttJournal_asHistory[ANTTT_JOURNAL_GAMES];  /* Ring of completed games */
+static u8 AntttJournal_u8Newest;                         /* Ring index of the most recent completed game */
+static u8 AntttJournal_u8Count;                          /* Completed games in the ring */
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalNewGame
+
+Description:
+Ends the current game record and starts a new one.
+
+Requires:
+  - eFirstSide_ is the side that moves first in the new game
+
+Promises:
+  - If the current game was won or drawn at its current ply it is copied to the history ring (oldest game dropped
+    when full), truncated to that ply
+  - The current game is empty with no duration
+*/
+void AntttJournalNewGame(AntttSideType eFirstSide_)
+{
+  if(AntttJournal_sGame.u8Result != ANTTT_GAME_ACTIVE)
+  {
+    AntttJournal_sGame.u8Plies = AntttJournal_u8Ply;
+
+    AntttJournal_u8Newest++;
+    if(AntttJournal_u8Newest >= ANTTT_JOURNAL_GAMES)
+    {
+      AntttJournal_u8Newest = 0;
+    }
+    AntttJournal_asHistory[AntttJournal_u8Newest] = AntttJournal_sGame;
+
+    if(AntttJournal_u8Count < ANTTT_JOURNAL_GAMES)
+    {
+      AntttJournal_u8Count++;
+    }
+  }
+
+  memset(&AntttJournal_sGame, 0, sizeof(AntttJournal_sGame));
+  AntttJournal_sGame.u8FirstSide = (u8)eFirstSide_;
+  AntttJournal_sGame.u8Result = ANTTT_GAME_ACTIVE;
+  AntttJournal_u8Ply = 0;
+
+} /* end AntttJournalNewGame() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalRecord
+
+Description:
+Records a move of the current game.
+
+Requires:
+  - u8Cell_ (0-8) has just been played by the side to move at AntttJournalPly()
+  - eResult_ is the game status after the move
+
+Promises:
+  - The move is stored at the current ply, which moves on by one
+  - Moves that could have been redone are dropped
+*/
+void AntttJournalRecord(u8 u8Cell_, AntttGameStatusType eResult_)
+{
+  u8* pu8Byte;
+
+  if(AntttJournal_u8Ply >= ANTTT_CELLS)
+  {
+    return;
+  }
+
+  pu8Byte = &AntttJournal_sGame.au8Moves[AntttJournal_u8Ply >> 1];
+  if(AntttJournal_u8Ply & 1)
+  {
+    *pu8Byte = (u8)((*pu8Byte & ANTTT_JOURNAL_CELL_MASK) | (u8Cell_ << 4));
+  }
+  else
+  {
+    *pu8Byte = (u8)((*pu8Byte & ~ANTTT_JOURNAL_CELL_MASK) | (u8Cell_ & ANTTT_JOURNAL_CELL_MASK));
+  }
+
+  AntttJournal_u8Ply++;
+  AntttJournal_sGame.u8Plies = AntttJournal_u8Ply;
+  AntttJournal_sGame.u8Result = (u8)eResult_;
+
+} /* end AntttJournalRecord() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalUndo
+
+Description:
+Takes back the last move on the board.
+
+Requires:
+  - psBoard_ is the position after AntttJournalPly() moves of the current game
+
+Promises:
+  - If there is a move to take back, it is removed from psBoard_, the ply steps back, the game is active again
+    and returns its cell
+  - Otherwise returns ANTTT_NO_CELL and nothing changes
+*/
+u8 AntttJournalUndo(AntttBoardType* psBoard_)
+{
+  if(AntttJournal_u8Ply == 0)
+  {
+    return(ANTTT_NO_CELL);
+  }
+
+  AntttJournal_u8Ply--;
+  AntttJournalToggle(psBoard_, &AntttJournal_sGame, AntttJournal_u8Ply);
+  AntttJournal_sGame.u8Result = ANTTT_GAME_ACTIVE;
+
+  return( AntttJournalGetMove(&AntttJournal_sGame, AntttJournal_u8Ply) );
+
+} /* end AntttJournalUndo() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalRedo
+
+Description:
+Replays the next recorded move after an undo.
+
+Requires:
+  - psBoard_ is the position after AntttJournalPly() moves of the current game
+
+Promises:
+  - If a move was taken back, it is made on psBoard_, the ply moves on, the result is updated and returns its cell
+  - Otherwise returns ANTTT_NO_CELL and nothing changes
+*/
+u8 AntttJournalRedo(AntttBoardType* psBoard_)
+{
+  u8 u8Cell;
+
+  if(AntttJournal_u8Ply >= AntttJournal_sGame.u8Plies)
+  {
+    return(ANTTT_NO_CELL);
+  }
+
+  u8Cell = AntttJournalGetMove(&AntttJournal_sGame, AntttJournal_u8Ply);
+  AntttJournalToggle(psBoard_, &AntttJournal_sGame, AntttJournal_u8Ply);
+  AntttJournal_u8Ply++;
+  AntttJournal_sGame.u8Result = (u8)AntttGameStatus(psBoard_);
+
+  return(u8Cell);
+
+} /* end AntttJournalRedo() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalTick
+
+Description:
+Times the current game.
+
+Requires:
+  - Called on every pass of the game task; u32Ms_ is the time since the last call
+
+Promises:
+  - The current game's duration goes up by u32Ms_ while it is active
+*/
+void AntttJournalTick(u32 u32Ms_)
+{
+  if(AntttJournal_sGame.u8Result == ANTTT_GAME_ACTIVE)
+  {
+    AntttJournal_sGame.u32DurationMs += u32Ms_;
+  }
+
+} /* end AntttJournalTick() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalCurrent
+
+Description:
+Returns the record of the current game.
+
+Requires:
+  -
+
+Promises:
+  - Returns a pointer to the current game, including moves that can be redone
+*/
+const AntttJournalGameType* AntttJournalCurrent(void)
+{
+  return(&AntttJournal_sGame);
+
+} /* end AntttJournalCurrent() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalPly
+
+Description:
+Returns how many moves of the current game are on the board.
+
+Requires:
+  -
+
+Promises:
+  - Returns 0 to AntttJournalCurrent()->u8Plies
+*/
+u8 AntttJournalPly(void)
+{
+  return(AntttJournal_u8Ply);
+
+} /* end AntttJournalPly() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalHistory
+
+Description:
+Returns a completed game from the history ring.
+
+Requires:
+  - u8Age_ is 0 for the most recent game, 1 for the one before, ...
+
+Promises:
+  - Returns a pointer to the game, or NULL if fewer than u8Age_ + 1 games are kept.  The game is overwritten once
+    ANTTT_JOURNAL_GAMES more have been filed; copy it (AntttJournalOpen()) to keep it.
+*/
+const AntttJournalGameType* AntttJournalHistory(u8 u8Age_)
+{
+  u8 u8Index;
+
+  if(u8Age_ >= AntttJournal_u8Count)
+  {
+    return(NULL);
+  }
+
+  u8Index = AntttJournal_u8Newest;
+  if(u8Index < u8Age_)
+  {
+    u8Index += ANTTT_JOURNAL_GAMES;
+  }
+
+  return( &AntttJournal_asHistory[u8Index - u8Age_] );
+
+} /* end AntttJournalHistory() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalHistoryCount
+
+Description:
+Returns the number of completed games kept.
+
+Requires:
+  -
+
+Promises:
+  - Returns 0 to ANTTT_JOURNAL_GAMES
+*/
+u8 AntttJournalHistoryCount(void)
+{
+  return(AntttJournal_u8Count);
+
+} /* end AntttJournalHistoryCount() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalGetMove
+
+Description:
+Unpacks one move of a game.
+
+Requires:
+  - u8Ply_ is less than psGame_->u8Plies
+
+Promises:
+  - Returns the cell (0-8) played at u8Ply_
+*/
+u8 AntttJournalGetMove(const AntttJournalGameType* psGame_, u8 u8Ply_)
+{
+  u8 u8Byte = psGame_->au8Moves[u8Ply_ >> 1];
+
+  if(u8Ply_ & 1)
+  {
+    u8Byte >>= 4;
+  }
+
+  return( (u8)(u8Byte & ANTTT_JOURNAL_CELL_MASK) );
+
+} /* end AntttJournalGetMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalOpen
+
+Description:
+Starts replaying a game.
+
+Requires:
+  - psGame_ is the current game or one from the history
+
+Promises:
+  - psCursor_ holds a copy of the game and the empty board at ply 0
+*/
+void AntttJournalOpen(AntttJournalCursorType* psCursor_, const AntttJournalGameType* psGame_)
+{
+  psCursor_->sGame = *psGame_;
+  psCursor_->sBoard.u16Home = 0;
+  psCursor_->sBoard.u16Away = 0;
+  psCursor_->u8Ply = 0;
+
+} /* end AntttJournalOpen() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalSeek
+
+Description:
+Moves a replay to the position after u8Ply_ moves, stepping from where it is.
+
+Requires:
+  - psCursor_ was set up by AntttJournalOpen()
+
+Promises:
+  - If u8Ply_ is no more than the game's moves, psCursor_->sBoard is the position after u8Ply_ moves and returns
+    true.  Each ply between the old and new position costs one AntttJournalToggle().
+  - Otherwise returns false and the cursor is unchanged
+*/
+bool AntttJournalSeek(AntttJournalCursorType* psCursor_, u8 u8Ply_)
+{
+  if(u8Ply_ > psCursor_->sGame.u8Plies)
+  {
+    return(false);
+  }
+
+  while(psCursor_->u8Ply < u8Ply_)
+  {
+    AntttJournalToggle(&psCursor_->sBoard, &psCursor_->sGame, psCursor_->u8Ply);
+    psCursor_->u8Ply++;
+  }
+
+  while(psCursor_->u8Ply > u8Ply_)
+  {
+    psCursor_->u8Ply--;
+    AntttJournalToggle(&psCursor_->sBoard, &psCursor_->sGame, psCursor_->u8Ply);
+  }
+
+  return(true);
+
+} /* end AntttJournalSeek() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalInitialize
+
+Description:
+Empties the journal and the history.
+
+Requires:
+  -
+
+Promises:
+  - No completed games are kept and the current game is empty with HOME to move
+*/
+void AntttJournalInitialize(void)
+{
+  memset(AntttJournal_asHistory, 0, sizeof(AntttJournal_asHistory));
+  AntttJournal_u8Newest = ANTTT_JOURNAL_GAMES - 1;
+  AntttJournal_u8Count = 0;
+
+  memset(&AntttJournal_sGame, 0, sizeof(AntttJournal_sGame));
+  AntttJournal_sGame.u8Result = ANTTT_GAME_ACTIVE;
+  AntttJournal_u8Ply = 0;
+
+} /* end AntttJournalInitialize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttJournalToggle
+
+Description:
+Makes or takes back one move of a game: XOR is its own inverse.
+
+Requires:
+  - psBoard_ is the position after u8Ply_ moves of psGame_ (to make the move) or after u8Ply_ + 1 (to take it back)
+
+Promises:
+  - The cell played at u8Ply_ is toggled in the mask of the side that played it
+*/
+void AntttJournalToggle(AntttBoardType* psBoard_, const AntttJournalGameType* psGame_, u8 u8Ply_)
+{
+  u16 u16Cell = (u16)(1 << AntttJournalGetMove(psGame_, u8Ply_));
+
+  if( (psGame_->u8FirstSide ^ (u8Ply_ & 1)) == ANTTT_HOME )
+  {
+    psBoard_->u16Home ^= u16Cell;
+  }
+  else
+  {
+    psBoard_->u16Away ^= u16Cell;
+  }
+
+} /* end AntttJournalToggle() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
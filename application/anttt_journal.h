@@ -0,0 +1,89 @@
+/**********************************************************************************************************************
+File: anttt_journal.h
+
+Description:
+Header file for anttt_journal.c
+**********************************************************************************************************************/
+
+#ifndef __ANTTT_JOURNAL_H
+#define __ANTTT_JOURNAL_H
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+/* Completed games kept in RAM.  Override on the compiler command line (e.g. -DANTTT_JOURNAL_GAMES=32). */
+#ifndef ANTTT_JOURNAL_GAMES
+#define ANTTT_JOURNAL_GAMES     16
+#endif
+
+#define ANTTT_JOURNAL_MOVE_BYTES  (u8)((ANTTT_CELLS + 1) / 2)  /* 9 cells at 4 bits each */
+#define ANTTT_JOURNAL_CELL_MASK   (u8)0x0F
+
+#if (ANTTT_JOURNAL_GAMES < 1) || (ANTTT_JOURNAL_GAMES > 255)
+#error "ANTTT_JOURNAL_GAMES must be from 1 to 255"
+#endif
+
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+/* One classic game (12 bytes).  Ply n's cell is in byte n/2: even plies in the low nibble, odd in the high. */
+typedef struct
+{
+  u32 u32DurationMs;                                /* Time the game was active (AntttJournalTick()) */
+  u8 au8Moves[ANTTT_JOURNAL_MOVE_BYTES];            /* Cells 0-8 packed two per byte */
+  u8 u8Plies;                                       /* Moves recorded */
+  u8 u8FirstSide;                                   /* AntttSideType that played ply 0 */
+  u8 u8Result;                                      /* AntttGameStatusType after the last move */
+} AntttJournalGameType;
+
+/* A position in any recorded game.  Copies the game so it stays valid when the history ring moves on. */
+typedef struct
+{
+  AntttJournalGameType sGame;                       /* The game being replayed */
+  AntttBoardType sBoard;                            /* Position after u8Ply moves */
+  u8 u8Ply;                                         /* Moves applied to sBoard */
+} AntttJournalCursorType;
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttJournalNewGame(AntttSideType eFirstSide_);
+void AntttJournalRecord(u8 u8Cell_, AntttGameStatusType eResult_);
+u8 AntttJournalUndo(AntttBoardType* psBoard_);
+u8 AntttJournalRedo(AntttBoardType* psBoard_);
+void AntttJournalTick(u32 u32Ms_);
+
+const AntttJournalGameType* AntttJournalCurrent(void);
+u8 AntttJournalPly(void);
+const AntttJournalGameType* AntttJournalHistory(u8 u8Age_);
+u8 AntttJournalHistoryCount(void);
+u8 AntttJournalGetMove(const AntttJournalGameType* psGame_, u8 u8Ply_);
+
+void AntttJournalOpen(AntttJournalCursorType* psCursor_, const AntttJournalGameType* psGame_);
+bool AntttJournalSeek(AntttJournalCursorType* psCursor_, u8 u8Ply_);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttJournalInitialize(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttJournalToggle(AntttBoardType* psBoard_, const AntttJournalGameType* psGame_, u8 u8Ply_);
+
+
+#endif /* __ANTTT_JOURNAL_H */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,336 @@
+/**********************************************************************************************************************
+File: anttt_load.c
+
+Description:
+CPU load accounting: how much of each second goes to the LEDs, the game, ANT event handling, sleep and the system
+itself.  Code is charged to a subsystem either with AntttLoadBegin()/AntttLoadEnd() around it or, where the caller
+has already timed it (the task scheduler in main.c, SystemSleep()), with AntttLoadAdd().  AntttLoadTick() closes a
+window every second: each subsystem's time becomes a share of the window in per-mille, and whatever was not
+charged to anything (interrupt entry, the scheduler's own loop, wake-up latency) is reported as unaccounted.
+
+On target the counters are CPU cycles from TIMER1 captures, so a Begin/End pair must be shorter than 1ms (one roll
+of TIMER1, see SystemCyclesElapsed()); longer work is charged by the scheduler, which counts whole ticks.  An
+interrupt that lands inside a Begin/End pair is charged to that subsystem as well as to its own.  When the file is
+compiled for a Linux host (ANTTT_HOST) the same counters read CLOCK_MONOTONIC in nanoseconds and the window is one
+second of host time, so host tools can watch for regressions in real units before anything is flashed.
+
+------------------------------------------------------------------------------------------------------------------------
+API:
+AntttLoadSubsystemType: ANTTT_LOAD_LEDS, ANTTT_LOAD_GAME, ANTTT_LOAD_ANT, ANTTT_LOAD_SLEEP, ANTTT_LOAD_SYSTEM
+
+void AntttLoadBegin(AntttLoadSubsystemType eSubsystem_)
+void AntttLoadEnd(AntttLoadSubsystemType eSubsystem_)
+Charge the time between the two calls to eSubsystem_.  Pairs for different subsystems may nest.
+
+void AntttLoadAdd(AntttLoadSubsystemType eSubsystem_, u32 u32Units_)
+Charge time measured by the caller (ANTTT_LOAD_UNITS_PER_SECOND units).
+
+u16 AntttLoadPerMille(AntttLoadSubsystemType eSubsystem_)
+const AntttLoadStatsType* AntttLoadGetStats(void)
+The last complete window: each subsystem's share in per-mille, and its raw time.
+
+Protected:
+void AntttLoadInitialize(void)
+void AntttLoadTick(void)
+Call on passes of the main loop (it is a task in main.c's table); a window closes on the first call after each second.
+
+u32 AntttLoadMsToNext(void)
+The task's sleep hook: the ms until the next window closes.
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+#ifdef ANTTT_HOST
+#include <time.h>
+#endif
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+extern volatile u32 G_u32SystemTime1s;                 /* From board-specific source file */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "AntttLoad_" and be declared as static.
+***********************************************************************************************************************/
+static AntttLoadStatsType AntttLoad_sStats;              /* The last complete window (AntttLoadGetStats()) */
+static u32 AntttLoad_au32Units[ANTTT_LOAD_SUBSYSTEMS];   /* Time charged so far in the current window */
+static u32 AntttLoad_au32Start[ANTTT_LOAD_SUBSYSTEMS];   /* AntttLoadNow() at each subsystem's AntttLoadBegin() */
+static u32 AntttLoad_u32WindowStart;                     /* Start of the current window (G_u32SystemTime1s on target) */
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadBegin
+
+Description:
+Starts timing work charged to a subsystem.
+
+Requires:
+  - eSubsystem_ has no AntttLoadBegin() without its AntttLoadEnd()
+
+Promises:
+  - The start time of eSubsystem_ is noted
+*/
+void AntttLoadBegin(AntttLoadSubsystemType eSubsystem_)
+{
+  AntttLoad_au32Start[eSubsystem_] = AntttLoadNow();
+
+} /* end AntttLoadBegin() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadEnd
+
+Description:
+Ends timing work charged to a subsystem.
+
+Requires:
+  - AntttLoadBegin(eSubsystem_) was called less than 1ms ago on target
+
+Promises:
+  - The time since AntttLoadBegin(eSubsystem_) is charged to eSubsystem_ in the current window
+*/
+void AntttLoadEnd(AntttLoadSubsystemType eSubsystem_)
+{
+  AntttLoad_au32Units[eSubsystem_] += AntttLoadSince(AntttLoad_au32Start[eSubsystem_]);
+
+} /* end AntttLoadEnd() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadAdd
+
+Description:
+Charges time the caller measured itself.
+
+Requires:
+  - u32Units_ is in ANTTT_LOAD_UNITS_PER_SECOND units (cycles on target)
+
+Promises:
+  - u32Units_ is charged to eSubsystem_ in the current window
+*/
+void AntttLoadAdd(AntttLoadSubsystemType eSubsystem_, u32 u32Units_)
+{
+  AntttLoad_au32Units[eSubsystem_] += u32Units_;
+
+} /* end AntttLoadAdd() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadPerMille
+
+Description:
+Returns one subsystem's share of the last complete window.
+
+Requires:
+  - eSubsystem_ is a subsystem
+
+Promises:
+  - Returns 0-1000 (0 until the first window completes)
+*/
+u16 AntttLoadPerMille(AntttLoadSubsystemType eSubsystem_)
+{
+  return(AntttLoad_sStats.au16PerMille[eSubsystem_]);
+
+} /* end AntttLoadPerMille() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadGetStats
+
+Description:
+Returns the last complete window.
+
+Requires:
+  -
+
+Promises:
+  - Returns a pointer to the statistics (read-only)
+*/
+const AntttLoadStatsType* AntttLoadGetStats(void)
+{
+  return(&AntttLoad_sStats);
+
+} /* end AntttLoadGetStats() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadInitialize
+
+Description:
+Clears the counters and starts the first window.
+
+Requires:
+  - The system tick is running
+
+Promises:
+  - No time is charged and the statistics are empty
+*/
+void AntttLoadInitialize(void)
+{
+  memset(&AntttLoad_sStats, 0, sizeof(AntttLoad_sStats));
+  memset(AntttLoad_au32Units, 0, sizeof(AntttLoad_au32Units));
+
+#ifdef ANTTT_HOST
+  AntttLoad_u32WindowStart = AntttLoadNow();
+#else
+  AntttLoad_u32WindowStart = G_u32SystemTime1s;
+#endif
+
+} /* end AntttLoadInitialize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadTick
+
+Description:
+Closes the window once a second.  The shares are one divide per subsystem per second.
+
+Requires:
+  - Called on the pass at each second boundary (AntttLoadMsToNext()) or soon after
+
+Promises:
+  - Time charged by an interrupt while the window closes is kept for the next window
+  - When a second has passed, AntttLoad_sStats holds each subsystem's time and share of the window (at most 1000:
+    a run that started in an earlier window is charged whole to the window it ends in), the time not charged to
+    anything, and a new window is started
+*/
+void AntttLoadTick(void)
+{
+  u32 u32Window;
+  u32 u32PerMilleUnits;
+  u32 u32Share;
+  u32 u32Units;
+  u32 u32Charged = 0;
+  u8 u8Subsystem;
+
+#ifdef ANTTT_HOST
+  u32Window = AntttLoadSince(AntttLoad_u32WindowStart);
+  if(u32Window < ANTTT_LOAD_UNITS_PER_SECOND)
+  {
+    return;
+  }
+  AntttLoad_u32WindowStart += u32Window;
+#else
+  if(G_u32SystemTime1s == AntttLoad_u32WindowStart)
+  {
+    return;
+  }
+  AntttLoad_u32WindowStart = G_u32SystemTime1s;
+  u32Window = ANTTT_LOAD_UNITS_PER_SECOND;
+#endif
+
+  u32PerMilleUnits = u32Window / 1000;
+  for(u8Subsystem = 0; u8Subsystem < ANTTT_LOAD_SUBSYSTEMS; u8Subsystem++)
+  {
+    /* SD_EVT_IRQHandler() charges ANTTT_LOAD_ANT, so each slot is taken and zeroed with interrupts masked */
+#ifndef ANTTT_HOST
+    __disable_irq();
+#endif
+    u32Units = AntttLoad_au32Units[u8Subsystem];
+    AntttLoad_au32Units[u8Subsystem] = 0;
+#ifndef ANTTT_HOST
+    __enable_irq();
+#endif
+
+    AntttLoad_sStats.au32Units[u8Subsystem] = u32Units;
+    u32Share = u32Units / u32PerMilleUnits;
+    AntttLoad_sStats.au16PerMille[u8Subsystem] = (u16)( (u32Share < 1000) ? u32Share : 1000 );
+    u32Charged += AntttLoad_sStats.au16PerMille[u8Subsystem];
+  }
+
+  /* Interrupts inside a timed subsystem are charged twice, so the total can pass 1000 */
+  AntttLoad_sStats.u16UnaccountedPerMille = (u32Charged < 1000) ? (u16)(1000 - u32Charged) : 0;
+  AntttLoad_sStats.u32WindowUnits = u32Window;
+  AntttLoad_sStats.u32Windows++;
+
+} /* end AntttLoadTick() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadMsToNext
+
+Description:
+Reports how long AntttLoadTick() has nothing to do: on target it only acts when G_u32SystemTime1s goes up.  The host
+closes windows on its own clock and does not sleep, so it asks for every pass.
+
+Requires:
+  - Called after AntttLoadTick() in the same pass
+
+Promises:
+  - Returns the ms that can pass before the next window closes (0 if it closes on the next tick)
+*/
+u32 AntttLoadMsToNext(void)
+{
+#ifdef ANTTT_HOST
+  return(0);
+#else
+  return(InterruptsMsToNextSecond() - 1);
+#endif
+
+} /* end AntttLoadMsToNext() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadNow
+
+Description:
+The current time in load units: a TIMER1 capture on target (rolls every 1ms), nanoseconds on the host.
+*/
+u32 AntttLoadNow(void)
+{
+#ifdef ANTTT_HOST
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (u32)((uint64_t)sNow.tv_sec * ANTTT_LOAD_UNITS_PER_SECOND + (uint64_t)sNow.tv_nsec) );
+#else
+  return( SystemCycleCapture() );
+#endif
+
+} /* end AntttLoadNow() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttLoadSince
+
+Description:
+Load units since a value returned by AntttLoadNow().  On target this allows one roll of TIMER1.
+*/
+u32 AntttLoadSince(u32 u32Start_)
+{
+#ifdef ANTTT_HOST
+  return(AntttLoadNow() - u32Start_);
+#else
+  return( SystemCyclesElapsed(u32Start_) );
+#endif
+
+} /* end AntttLoadSince() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,74 @@
+/**********************************************************************************************************************
+File: anttt_load.h
+
+Description:
+Header file for anttt_load.c
+**********************************************************************************************************************/
+
+#ifndef __ANTTT_LOAD_H
+#define __ANTTT_LOAD_H
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+/* Units of the load counters: CPU cycles on target, nanoseconds on the host */
+#ifdef ANTTT_HOST
+#define ANTTT_LOAD_UNITS_PER_SECOND   (u32)1000000000
+#else
+#define ANTTT_LOAD_UNITS_PER_SECOND   HFCLK_FREQ
+#endif
+
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+/* What the time is charged to */
+typedef enum {ANTTT_LOAD_LEDS = 0, ANTTT_LOAD_GAME, ANTTT_LOAD_ANT, ANTTT_LOAD_SLEEP, ANTTT_LOAD_SYSTEM,
+              ANTTT_LOAD_SUBSYSTEMS} AntttLoadSubsystemType;
+
+/* The last complete one second window */
+typedef struct
+{
+  u32 au32Units[ANTTT_LOAD_SUBSYSTEMS];             /* Time charged to each subsystem (ANTTT_LOAD_UNITS_PER_SECOND) */
+  u16 au16PerMille[ANTTT_LOAD_SUBSYSTEMS];          /* The same as a share of the window, 0-1000 */
+  u16 u16UnaccountedPerMille;                       /* Window time not charged to anything (interrupts, scheduling) */
+  u32 u32WindowUnits;                               /* Length of the window */
+  u32 u32Windows;                                   /* Windows completed */
+} AntttLoadStatsType;
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttLoadBegin(AntttLoadSubsystemType eSubsystem_);
+void AntttLoadEnd(AntttLoadSubsystemType eSubsystem_);
+void AntttLoadAdd(AntttLoadSubsystemType eSubsystem_, u32 u32Units_);
+u16 AntttLoadPerMille(AntttLoadSubsystemType eSubsystem_);
+const AntttLoadStatsType* AntttLoadGetStats(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttLoadInitialize(void);
+void AntttLoadTick(void);
+u32 AntttLoadMsToNext(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+u32 AntttLoadNow(void);
+u32 AntttLoadSince(u32 u32Start_);
+
+
+#endif /* __ANTTT_LOAD_H */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,1220 @@
+/**********************************************************************************************************************
+File: anttt_mcts.c
+
+Description:
+Monte Carlo tree search for the games too big for the full search in anttt_search.c: ultimate tic-tac-toe and the
+m,n,k boards of anttt_mnk.c.  A game is described by an AntttMctsGameType so the same search plays either one.
+
+Memory is fixed at compile time.  Nodes come from AntttMcts_asArena, which is ANTTT_MCTS_ARENA_BYTES of RAM, through
+a bump allocator: expanding a node takes one block of contiguous children at AntttMcts_u16Next in O(1) and single
+nodes are never freed.  When the arena is full the search carries on with the tree it has and playouts start from
+its leaves.  Nothing is allocated with malloc().
+
+The tree is reused between moves.  AntttMctsAdvance() makes the child for the move played the new root, everything
+outside that subtree becomes garbage and the live nodes are slid down to the start of the arena so the allocator
+has one free block again.  Children are always allocated after their parent, so one ascending pass marks the
+subtree in AntttMcts_au32Live, a running count per 32-bit word of marks (AntttMcts_au16Rank) gives each live node
+its new index, and a second ascending pass moves the nodes down and renumbers their children.  Nodes only ever move
+to a lower index so it is done in place, 6 bytes of bookkeeping per 32 nodes.  The compaction runs in steps at the
+start of the next search; if the other side moves first the pending root just moves down another ply.
+
+As in anttt_search.c, AntttMctsRun() works in steps so main() keeps its 1ms cadence.  A step is one level of the
+selection descent (expanding the leaf it reaches), one move of a random playout, or ANTTT_MCTS_COMPACT_STEP nodes
+of compaction.  The slice stops as soon as another step at the decaying peak step cost might not fit.
+
+Selection is UCT with no divide or square root.  Exploitation is wins times 1/visits from AntttMcts_au16Reciprocal.
+Exploration is C*sqrt(ln N) from AntttMcts_au16Explore (indexed by the bit length of the parent's visits, C =
+sqrt(2)) times 1/sqrt(visits) from AntttMcts_au16InvSqrt.  Both are Q10 and visit counts of 256 or more are scaled
+into the tables.  Playouts pick uniformly random legal moves with xorshift32, scaled by a multiply rather than a
+modulo; the m,n,k moves are read straight out of the empty-square bitboard.
+
+The target playout rate is kept in AntttMcts_sStats (see AntttMctsGetStats()) for every move and measured from the
+empty ultimate board by AntttBenchmark().  host/anttt_mcts_bench.c reports the host rate and playing strength.
+
+------------------------------------------------------------------------------------------------------------------------
+API:
+const AntttMctsGameType G_sAntttMctsUltimate
+const AntttMctsGameType G_sAntttMctsMnk
+Descriptors for ultimate tic-tac-toe (moves packed with ANTTT_ULTIMATE_MOVE()) and for the m,n,k board built by
+anttt_mnk.c (moves are square numbers).
+
+void AntttMctsNewGame(const AntttMctsGameType* psGame_, const AntttMctsStateType* psState_, AntttSideType eSide_)
+Empties the tree for a game in position psState_ with eSide_ to move.
+
+void AntttMctsAdvance(u8 u8Move_)
+Tells the search a move was played; the subtree below it is kept for the next search.
+
+void AntttMctsStart(u32 u32Playouts_, u32 u32Ticks_)
+Starts a search for the side to move.  It stops after u32Playouts_ playouts or u32Ticks_ calls to AntttMctsRun(),
+whichever comes first (0 = no limit), and always by ANTTT_MCTS_MAX_VISITS root visits.
+
+bool AntttMctsRun(u32 u32BudgetUs_)
+Searches for up to u32BudgetUs_ microseconds.  Returns true when the search is complete.
+
+bool AntttMctsBusy(void)
+u8 AntttMctsResult(void)
+Status and chosen move (the most visited root child, ANTTT_NO_CELL if there was no move) of the search.
+
+void AntttMctsSeed(u32 u32Seed_)
+Mixes u32Seed_ into the playout generator.
+
+const AntttMctsStatsType* AntttMctsGetStats(void)
+Playout rate, slice timing and arena use.
+
+Protected:
+void AntttMctsInitialize(void)
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+const AntttMctsGameType G_sAntttMctsUltimate =
+{
+  AntttMctsUltimateLegalMoves, AntttMctsUltimateMakeMove, AntttMctsUltimateStatus
+};
+
+const AntttMctsGameType G_sAntttMctsMnk =
+{
+  AntttMctsMnkLegalMoves, AntttMctsMnkMakeMove, AntttMctsMnkStatus
+};
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "AntttMcts_" and be declared as static.
+***********************************************************************************************************************/
+static AntttMctsNodeType AntttMcts_asArena[ANTTT_MCTS_NODES];  /* Every tree node */
+static u32 AntttMcts_au32Live[ANTTT_MCTS_LIVE_WORDS];   /* Compaction: one mark bit per node */
+static u16 AntttMcts_au16Rank[ANTTT_MCTS_LIVE_WORDS];   /* Compaction: live nodes before each word of marks */
+static u16 AntttMcts_u16Root;                            /* Arena index of the root */
+static u16 AntttMcts_u16Next;                            /* First free node: the bump allocator */
+static u16 AntttMcts_u16Scan;                            /* Compaction progress */
+static u16 AntttMcts_u16LiveCount;                       /* Nodes kept by the compaction in progress */
+static AntttMctsPhaseType AntttMcts_ePhase;              /* What the next step of AntttMctsRun() does */
+
+static const AntttMctsGameType* AntttMcts_psGame;        /* Game being searched */
+static AntttMctsStateType AntttMcts_sRootState;          /* Position at the root */
+static AntttSideType AntttMcts_eRootSide;                /* Side to move at the root */
+static AntttMctsStateType AntttMcts_sState;              /* Position reached by the current iteration */
+static AntttSideType AntttMcts_eSide;                    /* Side to move in AntttMcts_sState */
+static u16 AntttMcts_au16Path[ANTTT_MCTS_MAX_DEPTH];     /* Nodes from the root to the current one */
+static u8 AntttMcts_u8Depth;                             /* Current node in AntttMcts_au16Path */
+static u8 AntttMcts_au8Moves[ANTTT_MCTS_MAX_MOVES];      /* Move list scratch */
+
+static bool AntttMcts_bBusy;                             /* true while a search is in progress */
+static u8 AntttMcts_u8Result = ANTTT_NO_CELL;            /* Move chosen by the last completed search */
+static u32 AntttMcts_u32PlayoutLimit;                    /* Playouts for this search, 0 = no limit */
+static u32 AntttMcts_u32TickLimit;                       /* AntttMctsRun() calls for this search, 0 = no limit */
+static u32 AntttMcts_u32Random = ANTTT_MCTS_RANDOM_START;  /* xorshift32 state, never 0 */
+static u32 AntttMcts_u32StepCycles;                      /* Decaying peak of the cycles taken by one step */
+
+static AntttMctsStatsType AntttMcts_sStats;              /* Timing and arena use for the debugger */
+
+/* 65536 / n (Q16), n = 1..255 */
+static const u16 AntttMcts_au16Reciprocal[ANTTT_MCTS_TABLE_SIZE] =
+{
+      0, 65535, 32768, 21845, 16384, 13107, 10923,  9362,  8192,  7282,  6554,  5958,  5461,  5041,  4681,  4369,
+   4096,  3855,  3641,  3449,  3277,  3121,  2979,  2849,  2731,  2621,  2521,  2427,  2341,  2260,  2185,  2114,
+   2048,  1986,  1928,  1872,  1820,  1771,  1725,  1680,  1638,  1598,  1560,  1524,  1489,  1456,  1425,  1394,
+   1365,  1337,  1311,  1285,  1260,  1237,  1214,  1192,  1170,  1150,  1130,  1111,  1092,  1074,  1057,  1040,
+   1024,  1008,   993,   978,   964,   950,   936,   923,   910,   898,   886,   874,   862,   851,   840,   830,
+    819,   809,   799,   790,   780,   771,   762,   753,   745,   736,   728,   720,   712,   705,   697,   690,
+    683,   676,   669,   662,   655,   649,   643,   636,   630,   624,   618,   612,   607,   601,   596,   590,
+    585,   580,   575,   570,   565,   560,   555,   551,   546,   542,   537,   533,   529,   524,   520,   516,
+    512,   508,   504,   500,   496,   493,   489,   485,   482,   478,   475,   471,   468,   465,   462,   458,
+    455,   452,   449,   446,   443,   440,   437,   434,   431,   428,   426,   423,   420,   417,   415,   412,
+    410,   407,   405,   402,   400,   397,   395,   392,   390,   388,   386,   383,   381,   379,   377,   374,
+    372,   370,   368,   366,   364,   362,   360,   358,   356,   354,   352,   350,   349,   347,   345,   343,
+    341,   340,   338,   336,   334,   333,   331,   329,   328,   326,   324,   323,   321,   320,   318,   317,
+    315,   314,   312,   311,   309,   308,   306,   305,   303,   302,   301,   299,   298,   297,   295,   294,
+    293,   291,   290,   289,   287,   286,   285,   284,   282,   281,   280,   279,   278,   277,   275,   274,
+    273,   272,   271,   270,   269,   267,   266,   265,   264,   263,   262,   261,   260,   259,   258,   257
+};
+
+/* 1024 / sqrt(n) (Q10), n = 1..255 */
+static const u16 AntttMcts_au16InvSqrt[ANTTT_MCTS_TABLE_SIZE] =
+{
+      0,  1024,   724,   591,   512,   458,   418,   387,   362,   341,   324,   309,   296,   284,   274,   264,
+    256,   248,   241,   235,   229,   223,   218,   214,   209,   205,   201,   197,   194,   190,   187,   184,
+    181,   178,   176,   173,   171,   168,   166,   164,   162,   160,   158,   156,   154,   153,   151,   149,
+    148,   146,   145,   143,   142,   141,   139,   138,   137,   136,   134,   133,   132,   131,   130,   129,
+    128,   127,   126,   125,   124,   123,   122,   122,   121,   120,   119,   118,   117,   117,   116,   115,
+    114,   114,   113,   112,   112,   111,   110,   110,   109,   109,   108,   107,   107,   106,   106,   105,
+    105,   104,   103,   103,   102,   102,   101,   101,   100,   100,    99,    99,    99,    98,    98,    97,
+     97,    96,    96,    95,    95,    95,    94,    94,    93,    93,    93,    92,    92,    92,    91,    91,
+     91,    90,    90,    89,    89,    89,    88,    88,    88,    87,    87,    87,    87,    86,    86,    86,
+     85,    85,    85,    84,    84,    84,    84,    83,    83,    83,    83,    82,    82,    82,    81,    81,
+     81,    81,    80,    80,    80,    80,    79,    79,    79,    79,    79,    78,    78,    78,    78,    77,
+     77,    77,    77,    77,    76,    76,    76,    76,    75,    75,    75,    75,    75,    74,    74,    74,
+     74,    74,    74,    73,    73,    73,    73,    73,    72,    72,    72,    72,    72,    72,    71,    71,
+     71,    71,    71,    70,    70,    70,    70,    70,    70,    70,    69,    69,    69,    69,    69,    69,
+     68,    68,    68,    68,    68,    68,    68,    67,    67,    67,    67,    67,    67,    67,    66,    66,
+     66,    66,    66,    66,    66,    65,    65,    65,    65,    65,    65,    65,    65,    64,    64,    64
+};
+
+/* sqrt(2) * sqrt(ln N) (Q10) by the bit length of N */
+static const u16 AntttMcts_au16Explore[17] =
+{
+     0,  853, 1477, 1906, 2256, 2558, 2828, 3074, 3302, 3515, 3716, 3907, 4089, 4263, 4430, 4591, 4747
+};
+
+/* Lowest set bit to bit number: index by (bit * 0x077CB531) >> 27 */
+static const u8 AntttMcts_au8DeBruijn[32] =
+{
+  0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8, 31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+};
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsNewGame
+
+Description:
+Starts searching a new game.  Any search in progress and the whole tree are dropped.
+
+Requires:
+  - psGame_ is the descriptor for the game held in psState_ (G_sAntttMctsUltimate or G_sAntttMctsMnk)
+  - eSide_ is the side to move in psState_
+
+Promises:
+  - The root position is a copy of *psState_ and the arena holds only the root node
+  - No search is in progress
+*/
+void AntttMctsNewGame(const AntttMctsGameType* psGame_, const AntttMctsStateType* psState_, AntttSideType eSide_)
+{
+  AntttMcts_psGame = psGame_;
+  AntttMcts_sRootState = *psState_;
+  AntttMcts_eRootSide = eSide_;
+  AntttMcts_bBusy = false;
+  AntttMcts_u8Result = ANTTT_NO_CELL;
+  AntttMctsResetTree();
+
+} /* end AntttMctsNewGame() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsAdvance
+
+Description:
+Plays a move on the root position.  If the tree holds the child for the move, its subtree becomes the new tree and
+the rest of the arena is reclaimed by a compaction that runs at the start of the next search.  Call for every move
+of the game, the search's own as well as the other side's.
+
+Requires:
+  - u8Move_ is legal in the root position
+
+Promises:
+  - The root position has u8Move_ played and the other side to move
+  - Any search in progress is abandoned
+  - The tree is the subtree below u8Move_ (compaction pending) or just a new root
+*/
+void AntttMctsAdvance(u8 u8Move_)
+{
+  AntttMctsNodeType* psRoot;
+  u16 u16Child = ANTTT_MCTS_NULL;
+
+  /* Once nodes have started moving the compaction has to be finished before the tree can be read */
+  while(AntttMcts_ePhase == ANTTT_MCTS_SLIDE)
+  {
+    AntttMctsCompactStep();
+  }
+
+  if( (AntttMcts_ePhase == ANTTT_MCTS_SELECT) || (AntttMcts_ePhase == ANTTT_MCTS_PLAYOUT) )
+  {
+    AntttMcts_ePhase = ANTTT_MCTS_IDLE;
+  }
+  AntttMcts_bBusy = false;
+
+  AntttMcts_psGame->pfnMakeMove(&AntttMcts_sRootState, AntttMcts_eRootSide, u8Move_);
+  AntttMcts_eRootSide = (AntttSideType)(AntttMcts_eRootSide ^ ANTTT_AWAY);
+
+  /* A pending mark is simply restarted from the deeper root: nothing has moved yet */
+  psRoot = &AntttMcts_asArena[AntttMcts_u16Root];
+  for(u8 i = 0; i < psRoot->u8Children; i++)
+  {
+    if(AntttMcts_asArena[psRoot->u16FirstChild + i].u8Move == u8Move_)
+    {
+      u16Child = psRoot->u16FirstChild + i;
+      break;
+    }
+  }
+
+  if( (u16Child == ANTTT_MCTS_NULL) || (AntttMcts_asArena[u16Child].u8Children == 0) )
+  {
+    AntttMctsResetTree();
+    AntttMcts_sStats.u32TreeResets++;
+  }
+  else
+  {
+    AntttMctsStartCompaction(u16Child);
+  }
+
+} /* end AntttMctsAdvance() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsStart
+
+Description:
+Starts a search for the side to move at the root.  A pending compaction is finished by the first steps.
+
+Requires:
+  - AntttMctsNewGame() has set up the game
+  - u32Playouts_ is the most playouts to run and u32Ticks_ the most calls to AntttMctsRun(); 0 means no limit
+
+Promises:
+  - AntttMctsBusy() returns true, unless the root has one legal move or none: then the search is already complete
+    with that move or ANTTT_NO_CELL
+*/
+void AntttMctsStart(u32 u32Playouts_, u32 u32Ticks_)
+{
+  u8 u8Count;
+
+  AntttMcts_u32PlayoutLimit = u32Playouts_;
+  AntttMcts_u32TickLimit = u32Ticks_;
+  AntttMcts_sStats.u32LastPlayouts = 0;
+  AntttMcts_sStats.u32LastTicks = 0;
+  AntttMcts_sStats.u32LastCycles = 0;
+  AntttMcts_bBusy = true;
+
+  /* A forced move needs no search */
+  u8Count = AntttMcts_psGame->pfnLegalMoves(&AntttMcts_sRootState, AntttMcts_au8Moves);
+  if(u8Count <= 1)
+  {
+    AntttMcts_u8Result = u8Count ? AntttMcts_au8Moves[0] : ANTTT_NO_CELL;
+    AntttMcts_bBusy = false;
+    AntttMcts_sStats.u32Moves++;
+    return;
+  }
+
+  AntttMcts_u8Result = ANTTT_NO_CELL;
+  if(AntttMcts_ePhase == ANTTT_MCTS_IDLE)
+  {
+    AntttMctsBeginIteration();
+  }
+
+} /* end AntttMctsStart() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsRun
+
+Description:
+Runs the search started by AntttMctsStart() for one time slice.  Call once per main loop pass until it returns
+true.  At least one step is taken per call so the search always makes progress.
+
+Requires:
+  - u32BudgetUs_ is the time allowed for this slice; values above ANTTT_SEARCH_MAX_BUDGET_US are limited to it
+  - TIMER1 is running (SystemCycleCapture())
+
+Promises:
+  - Returns true if the search is complete: AntttMctsResult() holds the move
+  - Returns false if the budget ran out first; the iteration in progress carries on at the next call
+  - AntttMcts_sStats is updated with the slice duration and, when the search completes, the playout rate
+*/
+bool AntttMctsRun(u32 u32BudgetUs_)
+{
+  u32 u32Start = SystemCycleCapture();
+  u32 u32Budget;
+  u32 u32Elapsed = 0;
+  u32 u32SliceCycles;
+
+  if(!AntttMcts_bBusy)
+  {
+    return(true);
+  }
+
+  if(u32BudgetUs_ > ANTTT_SEARCH_MAX_BUDGET_US)
+  {
+    u32BudgetUs_ = ANTTT_SEARCH_MAX_BUDGET_US;
+  }
+  u32Budget = u32BudgetUs_ * ANTTT_SEARCH_CYCLES_PER_US;
+
+  AntttMcts_sStats.u32LastTicks++;
+  if( AntttMcts_u32TickLimit && (AntttMcts_sStats.u32LastTicks > AntttMcts_u32TickLimit) )
+  {
+    AntttMctsFinish();
+  }
+
+  while(AntttMcts_bBusy)
+  {
+    switch(AntttMcts_ePhase)
+    {
+      case ANTTT_MCTS_MARK:
+      case ANTTT_MCTS_RANK:
+      case ANTTT_MCTS_SLIDE:
+        AntttMctsCompactStep();
+        break;
+
+      case ANTTT_MCTS_SELECT:
+        AntttMctsSelectStep();
+        break;
+
+      case ANTTT_MCTS_PLAYOUT:
+        AntttMctsPlayoutStep();
+        break;
+
+      default:
+        AntttMctsBeginIteration();
+        break;
+    }
+
+    if( !AntttMctsStepFits(u32Start, &u32Elapsed, u32Budget) )
+    {
+      break;
+    }
+  }
+
+  /* Slice instrumentation */
+  u32SliceCycles = SystemCyclesElapsed(u32Start);
+  AntttMcts_sStats.u32LastCycles += u32SliceCycles;
+  if(u32SliceCycles > AntttMcts_sStats.u32WorstSliceCycles)
+  {
+    AntttMcts_sStats.u32WorstSliceCycles = u32SliceCycles;
+  }
+  if(u32SliceCycles > u32Budget)
+  {
+    AntttMcts_sStats.u32Overruns++;
+  }
+
+  if( !AntttMcts_bBusy && AntttMcts_sStats.u32LastPlayouts )
+  {
+    u32SliceCycles = AntttMcts_sStats.u32LastCycles / AntttMcts_sStats.u32LastPlayouts;
+    AntttMcts_sStats.u32PlayoutsPerSecond = HFCLK_FREQ / (u32SliceCycles ? u32SliceCycles : 1);
+  }
+
+  return(!AntttMcts_bBusy);
+
+} /* end AntttMctsRun() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsBusy
+
+Description:
+Reports whether a search is in progress.
+
+Requires:
+  -
+
+Promises:
+  - Returns true if AntttMctsRun() still has work to do
+*/
+bool AntttMctsBusy(void)
+{
+  return(AntttMcts_bBusy);
+
+} /* end AntttMctsBusy() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsResult
+
+Description:
+Returns the move chosen by the last completed search.
+
+Requires:
+  - AntttMctsRun() has returned true
+
+Promises:
+  - Returns the move in the game's packing, or ANTTT_NO_CELL if the root had no moves
+*/
+u8 AntttMctsResult(void)
+{
+  return(AntttMcts_u8Result);
+
+} /* end AntttMctsResult() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsSeed
+
+Description:
+Mixes a value into the playout generator.  Any captured timer value makes a useful seed since it depends on when
+the player moved.
+
+Requires:
+  -
+
+Promises:
+  - AntttMcts_u32Random is changed and non-zero
+*/
+void AntttMctsSeed(u32 u32Seed_)
+{
+  AntttMcts_u32Random ^= u32Seed_;
+  if(AntttMcts_u32Random == 0)
+  {
+    AntttMcts_u32Random = ANTTT_MCTS_RANDOM_START;
+  }
+
+} /* end AntttMctsSeed() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsGetStats
+
+Description:
+Returns the search statistics.
+
+Requires:
+  -
+
+Promises:
+  - Returns a pointer to the statistics, which are updated by every AntttMctsRun()
+*/
+const AntttMctsStatsType* AntttMctsGetStats(void)
+{
+  return(&AntttMcts_sStats);
+
+} /* end AntttMctsGetStats() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsInitialize
+
+Description:
+Clears the search and its statistics and sets up an empty ultimate game.
+
+Requires:
+  -
+
+Promises:
+  - No search is in progress, the tree is a single root and AntttMcts_sStats is zeroed
+  - The playout generator restarts from its fixed state, so the same AntttMctsSeed() calls give the same searches
+*/
+void AntttMctsInitialize(void)
+{
+  memset(&AntttMcts_sStats, 0, sizeof(AntttMcts_sStats));
+  AntttMcts_u32Random = ANTTT_MCTS_RANDOM_START;
+  AntttMcts_u32StepCycles = 0;
+
+  AntttUltimateClear(&AntttMcts_sRootState.sUltimate);
+  AntttMctsNewGame(&G_sAntttMctsUltimate, &AntttMcts_sRootState, ANTTT_HOME);
+
+} /* end AntttMctsInitialize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsStepFits
+
+Description:
+Called after each step of AntttMctsRun().  Measures the step just taken, updates the step cost estimate and decides
+whether another step still fits in the slice.  Same policy as AntttSearchStepFits().
+
+Requires:
+  - u32Start_ is the cycle count captured at the start of the slice
+  - *pu32Elapsed_ is the elapsed count returned by the previous call in this slice (0 for the first)
+  - u32Budget_ is the slice budget in cycles, less than TIMER_COUNT_1MS
+
+Promises:
+  - *pu32Elapsed_ is updated to the cycles used so far
+  - AntttMcts_u32StepCycles rises to any longer step and otherwise decays by 1/16
+  - AntttMcts_sStats.u32WorstStepCycles holds the longest step seen
+  - Returns true if the elapsed cycles plus the step cost estimate are within u32Budget_
+*/
+bool AntttMctsStepFits(u32 u32Start_, u32* pu32Elapsed_, u32 u32Budget_)
+{
+  u32 u32Elapsed = SystemCyclesElapsed(u32Start_);
+  u32 u32Step = u32Elapsed - *pu32Elapsed_;
+
+  *pu32Elapsed_ = u32Elapsed;
+  if(u32Step > AntttMcts_sStats.u32WorstStepCycles)
+  {
+    AntttMcts_sStats.u32WorstStepCycles = u32Step;
+  }
+
+  if(u32Step > AntttMcts_u32StepCycles)
+  {
+    AntttMcts_u32StepCycles = u32Step;
+  }
+  else
+  {
+    AntttMcts_u32StepCycles -= AntttMcts_u32StepCycles >> 4;
+  }
+
+  return( (u32Elapsed + AntttMcts_u32StepCycles) <= u32Budget_ );
+
+} /* end AntttMctsStepFits() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsBeginIteration
+
+Description:
+Starts a selection from the root.
+
+Requires:
+  - No compaction is in progress
+
+Promises:
+  - The iteration position is a copy of the root position and the path holds just the root
+*/
+void AntttMctsBeginIteration(void)
+{
+  AntttMcts_sState = AntttMcts_sRootState;
+  AntttMcts_eSide = AntttMcts_eRootSide;
+  AntttMcts_au16Path[0] = AntttMcts_u16Root;
+  AntttMcts_u8Depth = 0;
+  AntttMcts_ePhase = ANTTT_MCTS_SELECT;
+
+} /* end AntttMctsBeginIteration() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsSelectStep
+
+Description:
+One step of the descent: moves from the current node to its best UCT child.  A leaf that has had a playout (or the
+root) is expanded first; any other leaf, a finished game or a full arena ends the descent.
+
+Requires:
+  - AntttMcts_sState is the position at the node at the end of AntttMcts_au16Path
+
+Promises:
+  - Either one child is added to the path with its move played, or the phase is ANTTT_MCTS_PLAYOUT
+*/
+void AntttMctsSelectStep(void)
+{
+  u16 u16Node = AntttMcts_au16Path[AntttMcts_u8Depth];
+  AntttMctsNodeType* psNode = &AntttMcts_asArena[u16Node];
+  u16 u16Child;
+
+  if(AntttMcts_psGame->pfnStatus(&AntttMcts_sState) != ANTTT_GAME_ACTIVE)
+  {
+    AntttMcts_ePhase = ANTTT_MCTS_PLAYOUT;
+    return;
+  }
+
+  /* New leaves get one playout before they are expanded so the arena is spent on lines that are revisited */
+  if(psNode->u8Children == 0)
+  {
+    if( ((psNode->u16Visits == 0) && (u16Node != AntttMcts_u16Root)) || !AntttMctsExpand(u16Node) )
+    {
+      AntttMcts_ePhase = ANTTT_MCTS_PLAYOUT;
+      return;
+    }
+  }
+
+  u16Child = AntttMctsSelectChild(u16Node);
+  AntttMcts_psGame->pfnMakeMove(&AntttMcts_sState, AntttMcts_eSide, AntttMcts_asArena[u16Child].u8Move);
+  AntttMcts_eSide = (AntttSideType)(AntttMcts_eSide ^ ANTTT_AWAY);
+  AntttMcts_au16Path[++AntttMcts_u8Depth] = u16Child;
+
+} /* end AntttMctsSelectStep() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsPlayoutStep
+
+Description:
+One random move of the playout, or, once the game is over, the backup of its result and the end of the iteration.
+
+Requires:
+  - AntttMcts_sState is the position reached by the iteration so far
+
+Promises:
+  - If the game is active a uniformly random legal move is played for AntttMcts_eSide
+  - Otherwise the result is backed up along the path and either the search finishes or the next iteration starts
+*/
+void AntttMctsPlayoutStep(void)
+{
+  AntttGameStatusType eStatus = AntttMcts_psGame->pfnStatus(&AntttMcts_sState);
+  u8 u8Count;
+
+  if(eStatus == ANTTT_GAME_ACTIVE)
+  {
+    u8Count = AntttMcts_psGame->pfnLegalMoves(&AntttMcts_sState, AntttMcts_au8Moves);
+    AntttMcts_psGame->pfnMakeMove(&AntttMcts_sState, AntttMcts_eSide,
+                                  AntttMcts_au8Moves[AntttMctsRandomIndex(u8Count)]);
+    AntttMcts_eSide = (AntttSideType)(AntttMcts_eSide ^ ANTTT_AWAY);
+    return;
+  }
+
+  AntttMctsBackup(eStatus);
+  AntttMcts_sStats.u32LastPlayouts++;
+
+  if( (AntttMcts_u32PlayoutLimit && (AntttMcts_sStats.u32LastPlayouts >= AntttMcts_u32PlayoutLimit)) ||
+      (AntttMcts_asArena[AntttMcts_u16Root].u16Visits >= ANTTT_MCTS_MAX_VISITS) )
+  {
+    AntttMctsFinish();
+  }
+  else
+  {
+    AntttMctsBeginIteration();
+  }
+
+} /* end AntttMctsPlayoutStep() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsBackup
+
+Description:
+Adds a playout result to every node on the path.  Each node is scored for the side that played its move.
+
+Requires:
+  - eStatus_ is the result of the finished playout
+
+Promises:
+  - Every node on AntttMcts_au16Path has one more visit and 2 more half points for a win or 1 for a draw
+*/
+void AntttMctsBackup(AntttGameStatusType eStatus_)
+{
+  AntttMctsNodeType* psNode;
+  AntttSideType eMover = (AntttSideType)(AntttMcts_eRootSide ^ ANTTT_AWAY);  /* Side that moved into the root */
+  AntttGameStatusType eMoverWins;
+
+  for(u8 i = 0; i <= AntttMcts_u8Depth; i++)
+  {
+    psNode = &AntttMcts_asArena[AntttMcts_au16Path[i]];
+    psNode->u16Visits++;
+
+    eMoverWins = (eMover == ANTTT_HOME) ? ANTTT_GAME_HOME_WIN : ANTTT_GAME_AWAY_WIN;
+    if(eStatus_ == eMoverWins)
+    {
+      psNode->u16Wins += 2;
+    }
+    else if(eStatus_ == ANTTT_GAME_DRAW)
+    {
+      psNode->u16Wins++;
+    }
+
+    eMover = (AntttSideType)(eMover ^ ANTTT_AWAY);
+  }
+
+} /* end AntttMctsBackup() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsSelectChild
+
+Description:
+Picks the child with the highest UCT score.  An unvisited child is taken straight away; children are shuffled when
+they are created so this tries them in random order.
+
+Requires:
+  - u16Node_ has children
+
+Promises:
+  - Returns the arena index of the chosen child
+*/
+u16 AntttMctsSelectChild(u16 u16Node_)
+{
+  const AntttMctsNodeType* psParent = &AntttMcts_asArena[u16Node_];
+  const AntttMctsNodeType* psChild;
+  u32 u32Explore;
+  u32 u32Score;
+  u32 u32Best = 0;
+  u16 u16Best = psParent->u16FirstChild;
+  u16 u16Visits;
+  u16 u16Wins;
+  u8 u8Shift;
+  u8 u8Bits = 0;
+
+  /* The bit length of the parent's visits selects C * sqrt(ln N) */
+  for(u16Visits = psParent->u16Visits; u16Visits; u16Visits >>= 1)
+  {
+    u8Bits++;
+  }
+  u32Explore = AntttMcts_au16Explore[u8Bits];
+
+  for(u8 i = 0; i < psParent->u8Children; i++)
+  {
+    psChild = &AntttMcts_asArena[psParent->u16FirstChild + i];
+    if(psChild->u16Visits == 0)
+    {
+      return(psParent->u16FirstChild + i);
+    }
+
+    /* Exploitation: wins / (2 * visits) in Q10, visits and wins scaled together into the table */
+    u16Visits = psChild->u16Visits;
+    u16Wins = psChild->u16Wins;
+    while(u16Visits >= ANTTT_MCTS_TABLE_SIZE)
+    {
+      u16Visits >>= 1;
+      u16Wins >>= 1;
+    }
+    u32Score = ((u32)u16Wins * AntttMcts_au16Reciprocal[u16Visits]) >> 7;
+
+    /* Exploration: C * sqrt(ln N / visits) in Q10, 1/sqrt(4n) = 1/sqrt(n) / 2 */
+    u16Visits = psChild->u16Visits;
+    u8Shift = 10;
+    while(u16Visits >= ANTTT_MCTS_TABLE_SIZE)
+    {
+      u16Visits >>= 2;
+      u8Shift++;
+    }
+    u32Score += (u32Explore * AntttMcts_au16InvSqrt[u16Visits]) >> u8Shift;
+
+    if(u32Score > u32Best)
+    {
+      u32Best = u32Score;
+      u16Best = psParent->u16FirstChild + i;
+    }
+  }
+
+  return(u16Best);
+
+} /* end AntttMctsSelectChild() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsExpand
+
+Description:
+Gives a leaf one child per legal move, allocated as one block from the top of the arena.
+
+Requires:
+  - u16Node_ is a leaf and AntttMcts_sState is its position, with the game still active
+
+Promises:
+  - Returns true if the children were added in random order with no visits
+  - Returns false, leaving the node a leaf, if the arena has no room (AntttMcts_sStats.u32ArenaFull counts it)
+*/
+bool AntttMctsExpand(u16 u16Node_)
+{
+  AntttMctsNodeType* psChild;
+  u8 u8Count;
+  u8 u8Swap;
+  u8 u8Index;
+
+  u8Count = AntttMcts_psGame->pfnLegalMoves(&AntttMcts_sState, AntttMcts_au8Moves);
+  if(u8Count == 0)
+  {
+    return(false);
+  }
+
+  if( (u32)AntttMcts_u16Next + u8Count > ANTTT_MCTS_NODES )
+  {
+    AntttMcts_sStats.u32ArenaFull++;
+    return(false);
+  }
+
+  /* Shuffle so that unvisited children are tried in random order */
+  for(u8 i = u8Count - 1; i > 0; i--)
+  {
+    u8Index = AntttMctsRandomIndex(i + 1);
+    u8Swap = AntttMcts_au8Moves[i];
+    AntttMcts_au8Moves[i] = AntttMcts_au8Moves[u8Index];
+    AntttMcts_au8Moves[u8Index] = u8Swap;
+  }
+
+  AntttMcts_asArena[u16Node_].u16FirstChild = AntttMcts_u16Next;
+  AntttMcts_asArena[u16Node_].u8Children = u8Count;
+  for(u8 i = 0; i < u8Count; i++)
+  {
+    psChild = &AntttMcts_asArena[AntttMcts_u16Next++];
+    psChild->u16Visits = 0;
+    psChild->u16Wins = 0;
+    psChild->u16FirstChild = ANTTT_MCTS_NULL;
+    psChild->u8Children = 0;
+    psChild->u8Move = AntttMcts_au8Moves[i];
+  }
+
+  AntttMcts_sStats.u16NodesUsed = AntttMcts_u16Next;
+  if(AntttMcts_u16Next > AntttMcts_sStats.u16NodesPeak)
+  {
+    AntttMcts_sStats.u16NodesPeak = AntttMcts_u16Next;
+  }
+
+  return(true);
+
+} /* end AntttMctsExpand() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsFinish
+
+Description:
+Ends the search with the most visited root child as the answer.  With no visited child the first legal move is
+used so a move is always returned while the game is active.
+
+Requires:
+  -
+
+Promises:
+  - AntttMcts_u8Result holds the move, AntttMctsBusy() returns false and any iteration in progress is dropped
+*/
+void AntttMctsFinish(void)
+{
+  const AntttMctsNodeType* psRoot;
+  const AntttMctsNodeType* psChild;
+  u16 u16Most = 0;
+
+  while(AntttMcts_ePhase == ANTTT_MCTS_SLIDE)
+  {
+    AntttMctsCompactStep();
+  }
+
+  if( (AntttMcts_ePhase == ANTTT_MCTS_SELECT) || (AntttMcts_ePhase == ANTTT_MCTS_PLAYOUT) )
+  {
+    AntttMcts_ePhase = ANTTT_MCTS_IDLE;
+  }
+
+  AntttMcts_u8Result = ANTTT_NO_CELL;
+  psRoot = &AntttMcts_asArena[AntttMcts_u16Root];
+  for(u8 i = 0; i < psRoot->u8Children; i++)
+  {
+    psChild = &AntttMcts_asArena[psRoot->u16FirstChild + i];
+    if(psChild->u16Visits > u16Most)
+    {
+      u16Most = psChild->u16Visits;
+      AntttMcts_u8Result = psChild->u8Move;
+    }
+  }
+
+  if( (AntttMcts_u8Result == ANTTT_NO_CELL) &&
+      AntttMcts_psGame->pfnLegalMoves(&AntttMcts_sRootState, AntttMcts_au8Moves) )
+  {
+    AntttMcts_u8Result = AntttMcts_au8Moves[0];
+  }
+
+  AntttMcts_bBusy = false;
+  AntttMcts_sStats.u32Moves++;
+
+} /* end AntttMctsFinish() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsResetTree
+
+Description:
+Frees the whole arena and starts again from a single root node.
+
+Requires:
+  -
+
+Promises:
+  - Node 0 is an unvisited leaf root and the allocator is at node 1; no compaction or iteration is pending
+*/
+void AntttMctsResetTree(void)
+{
+  AntttMcts_asArena[0].u16Visits = 0;
+  AntttMcts_asArena[0].u16Wins = 0;
+  AntttMcts_asArena[0].u16FirstChild = ANTTT_MCTS_NULL;
+  AntttMcts_asArena[0].u8Children = 0;
+  AntttMcts_asArena[0].u8Move = ANTTT_NO_CELL;
+
+  AntttMcts_u16Root = 0;
+  AntttMcts_u16Next = 1;
+  AntttMcts_ePhase = ANTTT_MCTS_IDLE;
+  AntttMcts_sStats.u16NodesUsed = 1;
+
+} /* end AntttMctsResetTree() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsStartCompaction
+
+Description:
+Makes u16NewRoot_ the root and schedules the compaction that keeps only its subtree.
+
+Requires:
+  - u16NewRoot_ is a child of the current root and no nodes are being moved
+
+Promises:
+  - Only u16NewRoot_ is marked live and the phase is ANTTT_MCTS_MARK starting from it
+*/
+void AntttMctsStartCompaction(u16 u16NewRoot_)
+{
+  memset(AntttMcts_au32Live, 0, sizeof(AntttMcts_au32Live));
+  AntttMcts_au32Live[u16NewRoot_ >> 5] |= (u32)1 << (u16NewRoot_ & 0x1F);
+
+  AntttMcts_u16Root = u16NewRoot_;
+  AntttMcts_u16Scan = u16NewRoot_;
+  AntttMcts_ePhase = ANTTT_MCTS_MARK;
+
+} /* end AntttMctsStartCompaction() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsCompactStep
+
+Description:
+One step of the compaction:
+  MARK   ANTTT_MCTS_COMPACT_STEP nodes: each live node marks its children (which always lie above it)
+  RANK   counts the live nodes before every word of marks
+  SLIDE  ANTTT_MCTS_COMPACT_STEP nodes: each live node moves down to its rank and its child index is renumbered
+
+Requires:
+  - The phase is ANTTT_MCTS_MARK, ANTTT_MCTS_RANK or ANTTT_MCTS_SLIDE
+
+Promises:
+  - The compaction advances; after the last SLIDE step the root is node 0, the live nodes are packed below
+    AntttMcts_u16Next and the phase is ANTTT_MCTS_IDLE
+*/
+void AntttMctsCompactStep(void)
+{
+  AntttMctsNodeType* psNode;
+  u16 u16End = AntttMcts_u16Scan + ANTTT_MCTS_COMPACT_STEP;
+  u16 u16Index;
+  u16 u16Count = 0;
+
+  if(u16End > AntttMcts_u16Next)
+  {
+    u16End = AntttMcts_u16Next;
+  }
+
+  switch(AntttMcts_ePhase)
+  {
+    case ANTTT_MCTS_MARK:
+      for( ; AntttMcts_u16Scan < u16End; AntttMcts_u16Scan++)
+      {
+        psNode = &AntttMcts_asArena[AntttMcts_u16Scan];
+        if( (AntttMcts_au32Live[AntttMcts_u16Scan >> 5] & ((u32)1 << (AntttMcts_u16Scan & 0x1F))) )
+        {
+          for(u8 i = 0; i < psNode->u8Children; i++)
+          {
+            u16Index = psNode->u16FirstChild + i;
+            AntttMcts_au32Live[u16Index >> 5] |= (u32)1 << (u16Index & 0x1F);
+          }
+        }
+      }
+
+      if(AntttMcts_u16Scan >= AntttMcts_u16Next)
+      {
+        AntttMcts_ePhase = ANTTT_MCTS_RANK;
+      }
+      break;
+
+    case ANTTT_MCTS_RANK:
+      for(u16 i = 0; i < ANTTT_MCTS_LIVE_WORDS; i++)
+      {
+        AntttMcts_au16Rank[i] = u16Count;
+        u16Count += AntttMctsPopCount(AntttMcts_au32Live[i]);
+      }
+
+      AntttMcts_u16LiveCount = u16Count;
+      AntttMcts_u16Scan = AntttMcts_u16Root;
+      AntttMcts_ePhase = ANTTT_MCTS_SLIDE;
+      break;
+
+    case ANTTT_MCTS_SLIDE:
+      /* Nodes only move down and in order, so nothing live is overwritten before it has moved */
+      for( ; AntttMcts_u16Scan < u16End; AntttMcts_u16Scan++)
+      {
+        if( (AntttMcts_au32Live[AntttMcts_u16Scan >> 5] & ((u32)1 << (AntttMcts_u16Scan & 0x1F))) )
+        {
+          psNode = &AntttMcts_asArena[AntttMctsRank(AntttMcts_u16Scan)];
+          *psNode = AntttMcts_asArena[AntttMcts_u16Scan];
+          if(psNode->u8Children)
+          {
+            psNode->u16FirstChild = AntttMctsRank(psNode->u16FirstChild);
+          }
+        }
+      }
+
+      if(AntttMcts_u16Scan >= AntttMcts_u16Next)
+      {
+        AntttMcts_sStats.u32Compactions++;
+        AntttMcts_sStats.u32NodesReclaimed += AntttMcts_u16Next - AntttMcts_u16LiveCount;
+        AntttMcts_sStats.u16NodesUsed = AntttMcts_u16LiveCount;
+        AntttMcts_u16Next = AntttMcts_u16LiveCount;
+        AntttMcts_u16Root = 0;
+        AntttMcts_ePhase = ANTTT_MCTS_IDLE;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+} /* end AntttMctsCompactStep() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsRank
+
+Description:
+Returns the index a live node moves to: the number of live nodes below it.
+
+Requires:
+  - AntttMcts_au16Rank has been filled from the current marks
+
+Promises:
+  - Returns the count of marked nodes with a lower index than u16Node_
+*/
+u16 AntttMctsRank(u16 u16Node_)
+{
+  u32 u32Below = AntttMcts_au32Live[u16Node_ >> 5] & (((u32)1 << (u16Node_ & 0x1F)) - 1);
+
+  return( AntttMcts_au16Rank[u16Node_ >> 5] + AntttMctsPopCount(u32Below) );
+
+} /* end AntttMctsRank() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsPopCount
+
+Description:
+Counts the set bits of a word with shifts, masks and one multiply (the Cortex-M0 has no count instruction).
+
+Requires:
+  -
+
+Promises:
+  - Returns the number of 1 bits in u32Bits_
+*/
+u8 AntttMctsPopCount(u32 u32Bits_)
+{
+  u32Bits_ -= (u32Bits_ >> 1) & 0x55555555;
+  u32Bits_ = (u32Bits_ & 0x33333333) + ((u32Bits_ >> 2) & 0x33333333);
+  u32Bits_ = (u32Bits_ + (u32Bits_ >> 4)) & 0x0F0F0F0F;
+
+  return( (u8)((u32Bits_ * 0x01010101) >> 24) );
+
+} /* end AntttMctsPopCount() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsRandomIndex
+
+Description:
+Uniform random index below u8Count_.  The top of a 16-bit random value times the count avoids a software divide.
+
+Requires:
+  - u8Count_ is at least 1
+
+Promises:
+  - Returns 0 to u8Count_ - 1
+*/
+u8 AntttMctsRandomIndex(u8 u8Count_)
+{
+  return( (u8)(((AntttMctsRandom() & 0xFFFF) * u8Count_) >> 16) );
+
+} /* end AntttMctsRandomIndex() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsRandom
+
+Description:
+xorshift32 generator for the playouts and the child order.
+
+Requires:
+  - AntttMcts_u32Random is not 0
+
+Promises:
+  - Returns the next 32-bit value
+*/
+u32 AntttMctsRandom(void)
+{
+  AntttMcts_u32Random ^= AntttMcts_u32Random << 13;
+  AntttMcts_u32Random ^= AntttMcts_u32Random >> 17;
+  AntttMcts_u32Random ^= AntttMcts_u32Random << 5;
+
+  return(AntttMcts_u32Random);
+
+} /* end AntttMctsRandom() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsUltimateLegalMoves
+Function: AntttMctsUltimateMakeMove
+Function: AntttMctsUltimateStatus
+
+Description:
+G_sAntttMctsUltimate: the ultimate helpers from anttt.c on psState_->sUltimate.
+*/
+u8 AntttMctsUltimateLegalMoves(const AntttMctsStateType* psState_, u8* pu8Moves_)
+{
+  return( AntttUltimateLegalMoves(&psState_->sUltimate, pu8Moves_) );
+
+} /* end AntttMctsUltimateLegalMoves() */
+
+
+void AntttMctsUltimateMakeMove(AntttMctsStateType* psState_, AntttSideType eSide_, u8 u8Move_)
+{
+  AntttUltimateMakeMove(&psState_->sUltimate, eSide_, ANTTT_ULTIMATE_MOVE_BOARD(u8Move_),
+                        ANTTT_ULTIMATE_MOVE_CELL(u8Move_));
+
+} /* end AntttMctsUltimateMakeMove() */
+
+
+AntttGameStatusType AntttMctsUltimateStatus(const AntttMctsStateType* psState_)
+{
+  return( (AntttGameStatusType)psState_->sUltimate.u8Status );
+
+} /* end AntttMctsUltimateStatus() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsMnkLegalMoves
+
+Description:
+G_sAntttMctsMnk move list: the empty-square mask is walked lowest bit first, each bit isolated with x & -x and
+turned into its square number with a de Bruijn multiply.
+
+Requires:
+  - pu8Moves_ points to space for ANTTT_MNK_CELLS moves
+
+Promises:
+  - pu8Moves_ holds every empty square and the count is returned (0 once the game is over)
+*/
+u8 AntttMctsMnkLegalMoves(const AntttMctsStateType* psState_, u8* pu8Moves_)
+{
+  u32 u32Empty;
+  u8 u8Count = 0;
+
+  if(AntttMnkGameStatus(&psState_->sMnk) != ANTTT_GAME_ACTIVE)
+  {
+    return(0);
+  }
+
+  for(u32Empty = AntttMnkEmpty(&psState_->sMnk); u32Empty; u32Empty &= u32Empty - 1)
+  {
+    pu8Moves_[u8Count++] = AntttMcts_au8DeBruijn[((u32Empty & (~u32Empty + 1)) * 0x077CB531) >> 27];
+  }
+
+  return(u8Count);
+
+} /* end AntttMctsMnkLegalMoves() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMctsMnkMakeMove
+Function: AntttMctsMnkStatus
+
+Description:
+G_sAntttMctsMnk: the anttt_mnk.c engine on psState_->sMnk.
+*/
+void AntttMctsMnkMakeMove(AntttMctsStateType* psState_, AntttSideType eSide_, u8 u8Move_)
+{
+  AntttMnkMakeMove(&psState_->sMnk, eSide_, u8Move_);
+
+} /* end AntttMctsMnkMakeMove() */
+
+
+AntttGameStatusType AntttMctsMnkStatus(const AntttMctsStateType* psState_)
+{
+  return( AntttMnkGameStatus(&psState_->sMnk) );
+
+} /* end AntttMctsMnkStatus() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,145 @@
+/**********************************************************************************************************************
+File: anttt_mcts.h
+
+Description:
+Header file for anttt_mcts.c
+**********************************************************************************************************************/
+
+#ifndef __ANTTT_MCTS_H
+#define __ANTTT_MCTS_H
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+/* Any position the tree search can play.  The game descriptor says which member is in use. */
+typedef union
+{
+  AntttUltimateBoardType sUltimate;
+  AntttMnkBoardType sMnk;
+} AntttMctsStateType;
+
+/* Game descriptor: how the search lists, plays and scores moves of one game.  Moves fit in a u8. */
+typedef struct
+{
+  u8 (*pfnLegalMoves)(const AntttMctsStateType* psState_, u8* pu8Moves_);
+  void (*pfnMakeMove)(AntttMctsStateType* psState_, AntttSideType eSide_, u8 u8Move_);
+  AntttGameStatusType (*pfnStatus)(const AntttMctsStateType* psState_);
+} AntttMctsGameType;
+
+/* One tree node (8 bytes).  All children of a node are allocated together so they are contiguous in the arena. */
+typedef struct
+{
+  u16 u16Visits;                                    /* Playouts through this node */
+  u16 u16Wins;                                      /* Half points for the side that played u8Move: win 2, draw 1 */
+  u16 u16FirstChild;                                /* Arena index of the first child, ANTTT_MCTS_NULL if a leaf */
+  u8 u8Children;                                    /* Number of children */
+  u8 u8Move;                                        /* Move that leads to this node from its parent */
+} AntttMctsNodeType;
+
+/* Work done by one step of AntttMctsRun() */
+typedef enum {ANTTT_MCTS_IDLE = 0, ANTTT_MCTS_MARK, ANTTT_MCTS_RANK, ANTTT_MCTS_SLIDE,
+              ANTTT_MCTS_SELECT, ANTTT_MCTS_PLAYOUT} AntttMctsPhaseType;
+
+typedef struct
+{
+  u32 u32Moves;                                     /* Searches completed */
+  u32 u32LastPlayouts;                              /* Playouts for the last move */
+  u32 u32LastTicks;                                 /* Main loop passes (1ms ticks) used by the last move */
+  u32 u32LastCycles;                                /* Cycles spent in AntttMctsRun() for the last move */
+  u32 u32PlayoutsPerSecond;                         /* Search rate for the last move at HFCLK_FREQ */
+  u32 u32WorstSliceCycles;                          /* Longest slice since AntttMctsInitialize() */
+  u32 u32WorstStepCycles;                           /* Longest single step of the search loop */
+  u32 u32Overruns;                                  /* Slices that ran past their budget */
+  u32 u32ArenaFull;                                 /* Expansions skipped because the arena was full */
+  u32 u32Compactions;                               /* Trees kept and slid down to the start of the arena */
+  u32 u32NodesReclaimed;                            /* Nodes freed by compaction */
+  u32 u32TreeResets;                                /* Moves that left no subtree to keep */
+  u16 u16NodesUsed;                                 /* Arena nodes in use */
+  u16 u16NodesPeak;                                 /* Most arena nodes ever in use */
+} AntttMctsStatsType;
+
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+/* RAM given to tree nodes.  Override on the compiler command line (e.g. -DANTTT_MCTS_ARENA_BYTES=8192). */
+#ifndef ANTTT_MCTS_ARENA_BYTES
+#define ANTTT_MCTS_ARENA_BYTES  4096
+#endif
+
+#define ANTTT_MCTS_NODE_BYTES   8                 /* sizeof(AntttMctsNodeType) */
+#define ANTTT_MCTS_NODES        (ANTTT_MCTS_ARENA_BYTES / ANTTT_MCTS_NODE_BYTES)
+#define ANTTT_MCTS_LIVE_WORDS   ((ANTTT_MCTS_NODES + 31) / 32)
+#define ANTTT_MCTS_NULL         (u16)0xFFFF       /* No node */
+
+#define ANTTT_MCTS_MAX_MOVES    ANTTT_ULTIMATE_MOVES           /* Most moves in any position */
+#define ANTTT_MCTS_MAX_DEPTH    (ANTTT_MCTS_MAX_MOVES + 1)     /* Nodes on a path from the root */
+
+/* 81 is ANTTT_ULTIMATE_MOVES without its cast, which #if cannot evaluate */
+#if (ANTTT_MCTS_NODES <= 81) || (ANTTT_MCTS_NODES >= 0xFFFF)
+#error "ANTTT_MCTS_ARENA_BYTES must hold more than one full expansion and fewer than 65535 nodes"
+#endif
+
+#define ANTTT_MCTS_MOVE_MS      (u32)2000         /* Ticks the on-board opponent thinks for an ultimate move */
+#define ANTTT_MCTS_MAX_VISITS   (u16)32000        /* Root visits at which a search stops: u16Wins cannot overflow */
+#define ANTTT_MCTS_COMPACT_STEP (u16)16           /* Nodes handled by one compaction step */
+#define ANTTT_MCTS_TABLE_SIZE   (u16)256          /* Entries in the reciprocal and 1/sqrt tables */
+#define ANTTT_MCTS_RANDOM_START (u32)0x2545F491   /* Playout generator state after AntttMctsInitialize() */
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttMctsNewGame(const AntttMctsGameType* psGame_, const AntttMctsStateType* psState_, AntttSideType eSide_);
+void AntttMctsAdvance(u8 u8Move_);
+void AntttMctsStart(u32 u32Playouts_, u32 u32Ticks_);
+bool AntttMctsRun(u32 u32BudgetUs_);
+bool AntttMctsBusy(void);
+u8 AntttMctsResult(void);
+void AntttMctsSeed(u32 u32Seed_);
+const AntttMctsStatsType* AntttMctsGetStats(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttMctsInitialize(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+bool AntttMctsStepFits(u32 u32Start_, u32* pu32Elapsed_, u32 u32Budget_);
+void AntttMctsBeginIteration(void);
+void AntttMctsSelectStep(void);
+void AntttMctsPlayoutStep(void);
+void AntttMctsBackup(AntttGameStatusType eStatus_);
+u16 AntttMctsSelectChild(u16 u16Node_);
+bool AntttMctsExpand(u16 u16Node_);
+void AntttMctsFinish(void);
+void AntttMctsResetTree(void);
+void AntttMctsStartCompaction(u16 u16NewRoot_);
+void AntttMctsCompactStep(void);
+u16 AntttMctsRank(u16 u16Node_);
+u8 AntttMctsPopCount(u32 u32Bits_);
+u8 AntttMctsRandomIndex(u8 u8Count_);
+u32 AntttMctsRandom(void);
+
+u8 AntttMctsUltimateLegalMoves(const AntttMctsStateType* psState_, u8* pu8Moves_);
+void AntttMctsUltimateMakeMove(AntttMctsStateType* psState_, AntttSideType eSide_, u8 u8Move_);
+AntttGameStatusType AntttMctsUltimateStatus(const AntttMctsStateType* psState_);
+u8 AntttMctsMnkLegalMoves(const AntttMctsStateType* psState_, u8* pu8Moves_);
+void AntttMctsMnkMakeMove(AntttMctsStateType* psState_, AntttSideType eSide_, u8 u8Move_);
+AntttGameStatusType AntttMctsMnkStatus(const AntttMctsStateType* psState_);
+
+
+#endif /* __ANTTT_MCTS_H */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,274 @@
+/**********************************************************************************************************************
+File: anttt_mnk.c
+
+Description:
+m,n,k game core for boards larger than the 3x3 ANTTT: ANTTT_MNK_WIDTH columns by ANTTT_MNK_HEIGHT rows, won by
+ANTTT_MNK_K in a row.  All three are compile-time macros in anttt_mnk.h.
+
+Each side is a u32 bitboard with rows ANTTT_MNK_STRIDE = WIDTH + 1 bits apart.  The extra bit at the end of each
+row is never set, so shifting a mask by 1 (along a row), STRIDE (down a column), STRIDE + 1 (diagonal) or
+STRIDE - 1 (anti-diagonal) can never carry a run from one row into the next.  A run of K in a direction is found
+by ANDing the mask with shifted copies of itself, doubling the run length each time:
+
+  m1 = b;  m2 = m1 & (m1 >> d);  m4 = m2 & (m2 >> 2d);  then one more step for the remainder of K
+
+so checking a side costs 4 directions x about log2(K) + 1 shift/AND pairs, whatever the size of the board.  Scanning
+a list of line masks instead would cost one test per line: 8 for 3x3x3 but 28 for 5x5x4.
+
+------------------------------------------------------------------------------------------------------------------------
+API:
+Squares are bit numbers in the masks: ANTTT_MNK_SQUARE(column, row).  AntttMnkEmpty() returns the free squares.
+
+void AntttMnkClear(AntttMnkBoardType* psBoard_)
+u32 AntttMnkEmpty(const AntttMnkBoardType* psBoard_)
+bool AntttMnkMakeMove(AntttMnkBoardType* psBoard_, AntttSideType eSide_, u8 u8Square_)
+void AntttMnkUnmakeMove(AntttMnkBoardType* psBoard_, AntttSideType eSide_, u8 u8Square_)
+u32 AntttMnkRuns(u32 u32Squares_)
+AntttGameStatusType AntttMnkGameStatus(const AntttMnkBoardType* psBoard_)
+
+The host benchmark is host/anttt_mnk_bench.c.
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "AntttMnk_" and be declared as static.
+***********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMnkClear
+
+Description:
+Empties a board.
+
+Requires:
+  - psBoard_ points to a board
+
+Promises:
+  - No squares are occupied
+*/
+void AntttMnkClear(AntttMnkBoardType* psBoard_)
+{
+  psBoard_->u32Home = 0;
+  psBoard_->u32Away = 0;
+  psBoard_->u8Moves = 0;
+
+} /* end AntttMnkClear() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMnkEmpty
+
+Description:
+Returns the squares that are still free.
+
+Requires:
+  - psBoard_ points to a valid board
+
+Promises:
+  - Returns a mask of the empty squares; guard bits are never included
+*/
+u32 AntttMnkEmpty(const AntttMnkBoardType* psBoard_)
+{
+  return( ANTTT_MNK_BOARD_MASK & ~(psBoard_->u32Home | psBoard_->u32Away) );
+
+} /* end AntttMnkEmpty() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMnkMakeMove
+
+Description:
+Places a piece for a side.
+
+Requires:
+  - u8Square_ is a square number from ANTTT_MNK_SQUARE()
+
+Promises:
+  - If the square is on the board and empty, it is set in eSide_'s mask and returns true
+  - Otherwise the board is unchanged and returns false
+*/
+bool AntttMnkMakeMove(AntttMnkBoardType* psBoard_, AntttSideType eSide_, u8 u8Square_)
+{
+  u32 u32Square;
+
+  if(u8Square_ >= ANTTT_MNK_BITS)
+  {
+    return(false);
+  }
+
+  u32Square = (u32)1 << u8Square_;
+  if( !(AntttMnkEmpty(psBoard_) & u32Square) )
+  {
+    return(false);
+  }
+
+  if(eSide_ == ANTTT_HOME)
+  {
+    psBoard_->u32Home |= u32Square;
+  }
+  else
+  {
+    psBoard_->u32Away |= u32Square;
+  }
+  psBoard_->u8Moves++;
+
+  return(true);
+
+} /* end AntttMnkMakeMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMnkUnmakeMove
+
+Description:
+Takes back a move made with AntttMnkMakeMove().
+
+Requires:
+  - eSide_ holds u8Square_
+
+Promises:
+  - u8Square_ is empty again
+*/
+void AntttMnkUnmakeMove(AntttMnkBoardType* psBoard_, AntttSideType eSide_, u8 u8Square_)
+{
+  if(eSide_ == ANTTT_HOME)
+  {
+    psBoard_->u32Home &= ~((u32)1 << u8Square_);
+  }
+  else
+  {
+    psBoard_->u32Away &= ~((u32)1 << u8Square_);
+  }
+  psBoard_->u8Moves--;
+
+} /* end AntttMnkUnmakeMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMnkRuns
+
+Description:
+Finds every run of ANTTT_MNK_K in any direction in one side's mask.
+
+Requires:
+  - u32Squares_ is one side's mask
+
+Promises:
+  - Returns the squares that start a run of ANTTT_MNK_K (the run extends towards higher bit numbers), or 0 if
+    there is none
+*/
+u32 AntttMnkRuns(u32 u32Squares_)
+{
+  return( AntttMnkRunsInDirection(u32Squares_, ANTTT_MNK_DIR_ROW)      |
+          AntttMnkRunsInDirection(u32Squares_, ANTTT_MNK_DIR_COLUMN)   |
+          AntttMnkRunsInDirection(u32Squares_, ANTTT_MNK_DIR_DIAGONAL) |
+          AntttMnkRunsInDirection(u32Squares_, ANTTT_MNK_DIR_ANTI) );
+
+} /* end AntttMnkRuns() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMnkGameStatus
+
+Description:
+Determines if a board is won, drawn or still in play.
+
+Requires:
+  - psBoard_ points to a valid board with at most one side holding a run
+
+Promises:
+  - Returns ANTTT_GAME_HOME_WIN or ANTTT_GAME_AWAY_WIN if that side has ANTTT_MNK_K in a row
+  - Returns ANTTT_GAME_DRAW if the board is full with no run
+  - Returns ANTTT_GAME_ACTIVE otherwise
+*/
+AntttGameStatusType AntttMnkGameStatus(const AntttMnkBoardType* psBoard_)
+{
+  if( AntttMnkRuns(psBoard_->u32Home) )
+  {
+    return(ANTTT_GAME_HOME_WIN);
+  }
+
+  if( AntttMnkRuns(psBoard_->u32Away) )
+  {
+    return(ANTTT_GAME_AWAY_WIN);
+  }
+
+  if(psBoard_->u8Moves >= ANTTT_MNK_CELLS)
+  {
+    return(ANTTT_GAME_DRAW);
+  }
+
+  return(ANTTT_GAME_ACTIVE);
+
+} /* end AntttMnkGameStatus() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttMnkRunsInDirection
+
+Description:
+Shift-and-AND run detection in one direction.  After each step bit i of u32Runs is set if u8Length squares
+starting at i and stepping by u8Shift_ are all held.  The length doubles while it can, then one step with an
+overlapping shift covers the rest of ANTTT_MNK_K.  The loop bounds are constants, so the compiler unrolls it.
+
+Requires:
+  - u8Shift_ is one of the ANTTT_MNK_DIR_ values
+
+Promises:
+  - Returns the start squares of every run of ANTTT_MNK_K in that direction
+*/
+u32 AntttMnkRunsInDirection(u32 u32Squares_, u8 u8Shift_)
+{
+  u32 u32Runs = u32Squares_;
+  u8 u8Length = 1;
+
+  while( (u8Length << 1) <= ANTTT_MNK_K )
+  {
+    u32Runs &= u32Runs >> (u8Length * u8Shift_);
+    u8Length <<= 1;
+  }
+
+  if(u8Length < ANTTT_MNK_K)
+  {
+    u32Runs &= u32Runs >> ((ANTTT_MNK_K - u8Length) * u8Shift_);
+  }
+
+  return(u32Runs);
+
+} /* end AntttMnkRunsInDirection() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,94 @@
+/**********************************************************************************************************************
+File: anttt_mnk.h
+
+Description:
+Header file for anttt_mnk.c
+**********************************************************************************************************************/
+
+#ifndef __ANTTT_MNK_H
+#define __ANTTT_MNK_H
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+typedef struct
+{
+  u32 u32Home;                                      /* Squares occupied by HOME */
+  u32 u32Away;                                      /* Squares occupied by AWAY */
+  u8 u8Moves;                                       /* Squares filled */
+} AntttMnkBoardType;
+
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+/* Board size and run length.  Override on the compiler command line (e.g. -DANTTT_MNK_WIDTH=5) for other boards. */
+#ifndef ANTTT_MNK_WIDTH
+#define ANTTT_MNK_WIDTH         3                 /* m: columns */
+#endif
+#ifndef ANTTT_MNK_HEIGHT
+#define ANTTT_MNK_HEIGHT        3                 /* n: rows */
+#endif
+#ifndef ANTTT_MNK_K
+#define ANTTT_MNK_K             3                 /* k: run length that wins */
+#endif
+
+/* Each row is stored with one empty guard bit after it so shifted runs cannot wrap onto the next row */
+#define ANTTT_MNK_STRIDE        (ANTTT_MNK_WIDTH + 1)
+#define ANTTT_MNK_CELLS         (ANTTT_MNK_WIDTH * ANTTT_MNK_HEIGHT)
+#define ANTTT_MNK_BITS          (ANTTT_MNK_STRIDE * ANTTT_MNK_HEIGHT)
+
+#if (ANTTT_MNK_BITS > 32)
+#error "ANTTT_MNK_WIDTH + 1 times ANTTT_MNK_HEIGHT must fit in a u32"
+#endif
+#if (ANTTT_MNK_K < 2) || ((ANTTT_MNK_K > ANTTT_MNK_WIDTH) && (ANTTT_MNK_K > ANTTT_MNK_HEIGHT))
+#error "ANTTT_MNK_K must be at least 2 and fit on the board"
+#endif
+
+/* Square index of column c, row r (bit number in the masks) */
+#define ANTTT_MNK_SQUARE(c, r)  (u8)((r) * ANTTT_MNK_STRIDE + (c))
+
+/* All playable squares: one row of WIDTH bits repeated every STRIDE bits */
+#define ANTTT_MNK_ROW_MASK      (u32)((1UL << ANTTT_MNK_WIDTH) - 1)
+#define ANTTT_MNK_BOARD_MASK    (u32)(ANTTT_MNK_ROW_MASK * \
+                                      (((1ULL << ANTTT_MNK_BITS) - 1) / ((1ULL << ANTTT_MNK_STRIDE) - 1)))
+
+/* Shift between neighbouring squares in each direction */
+#define ANTTT_MNK_DIR_ROW       (u8)1
+#define ANTTT_MNK_DIR_COLUMN    (u8)ANTTT_MNK_STRIDE
+#define ANTTT_MNK_DIR_DIAGONAL  (u8)(ANTTT_MNK_STRIDE + 1)
+#define ANTTT_MNK_DIR_ANTI      (u8)(ANTTT_MNK_STRIDE - 1)
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttMnkClear(AntttMnkBoardType* psBoard_);
+u32 AntttMnkEmpty(const AntttMnkBoardType* psBoard_);
+bool AntttMnkMakeMove(AntttMnkBoardType* psBoard_, AntttSideType eSide_, u8 u8Square_);
+void AntttMnkUnmakeMove(AntttMnkBoardType* psBoard_, AntttSideType eSide_, u8 u8Square_);
+u32 AntttMnkRuns(u32 u32Squares_);
+AntttGameStatusType AntttMnkGameStatus(const AntttMnkBoardType* psBoard_);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+u32 AntttMnkRunsInDirection(u32 u32Squares_, u8 u8Shift_);
+
+
+#endif /* __ANTTT_MNK_H */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,713 @@
+/**********************************************************************************************************************
+File: anttt_search.c
+
+Description:
+Resumable alpha-beta (negamax) search for the on-board opponent.
+
+main() must get back to LedUpdate() and SystemSleep() every 1ms, so the search never recurses.  Each ply is a
+frame on AntttSearch_asStack that holds the node's masks, window, best score so far and the next move to try.
+AntttSearchRun() expands one node per loop iteration and checks the TIMER1 cycle count after each one.  The
+cost of a step is tracked as a peak that decays by 1/16 per step (so one step stretched by an interrupt does not
+shorten every later slice) and the slice stops as soon as another step of that cost might not fit in the budget.
+A slice therefore finishes inside its budget rather than one step past it.  The stack is left intact and the next
+call carries on from the same node.
+
+Moves are tried center, corners, then edges so the cutoffs come early.  A win scores ANTTT_SEARCH_WIN less the
+ply it happens on, so faster wins and slower losses are preferred.
+
+Positions reached by different move orders are searched once: every frame carries its Zobrist key, updated with
+AntttHashMove() as moves are made, and the transposition table in anttt_hash.c is probed before each child is
+searched.  A stored result searched at least as deep is used if it is exact or a bound that cuts off the window;
+otherwise its best cell is tried first.  Results are stored when a frame is finished, with win and loss scores made
+relative to the frame so they hold at any ply.  The depth limit never exceeds the empty cells at the root, so a
+stored depth that covers the rest of the game is a full solve that later moves can reuse.  The table is cleared when
+the level changes since the evaluation noise differs.  Positions at the depth limit are scored by
+open lines (AntttOpenLines()) for each side plus xorshift noise, both set by the difficulty level:
+
+  Level    Depth  Noise
+  EASY       1    -7..+8
+  MEDIUM     3    -1..+2
+  HARD       9    none (a full search: perfect play)
+  PERFECT    9    none
+
+Instrumentation for the debugger is kept in AntttSearch_sStats: worst slice duration in cycles, the longest step,
+slices that overran their budget, and the number of ticks (main loop passes) each move took.
+
+------------------------------------------------------------------------------------------------------------------------
+API:
+void AntttSearchStart(const AntttBoardType* psBoard_, AntttSideType eSide_, AntttLevelType eLevel_)
+Sets up a search for eSide_ to move on psBoard_.
+
+bool AntttSearchRun(u32 u32BudgetUs_)
+Searches for up to u32BudgetUs_ microseconds.  Returns true when the search is complete.
+
+bool AntttSearchBusy(void)
+u8 AntttSearchResult(void)
+s16 AntttSearchScore(void)
+Status, chosen cell (ANTTT_NO_CELL if there was no move) and its score for the completed search.
+
+void AntttSearchSeed(u32 u32Seed_)
+Mixes u32Seed_ into the evaluation noise generator.
+
+const AntttSearchStatsType* AntttSearchGetStats(void)
+Slice and move timing.
+
+Protected:
+void AntttSearchInitialize(void)
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "AntttSearch_" and be declared as static.
+***********************************************************************************************************************/
+static AntttSearchFrameType AntttSearch_asStack[ANTTT_SEARCH_MAX_PLY];  /* Explicit search stack */
+static u8 AntttSearch_u8Ply;                             /* Current frame in AntttSearch_asStack */
+static u8 AntttSearch_u8DepthLimit;                      /* Plies searched before the evaluation is used */
+static u8 AntttSearch_u8NoiseMask;                       /* Evaluation noise is (random & mask) - (mask >> 1) */
+static AntttSideType AntttSearch_eRootSide;              /* Side to move at ply 0 */
+static u8 AntttSearch_u8HashLevel = ANTTT_LEVELS;        /* Level the transposition table entries belong to */
+static bool AntttSearch_bBusy;                           /* true while a search is in progress */
+static u8 AntttSearch_u8Result = ANTTT_NO_CELL;          /* Best cell from the last completed search */
+static s16 AntttSearch_s16Score;                         /* Score of AntttSearch_u8Result */
+static u32 AntttSearch_u32Random = ANTTT_SEARCH_RANDOM_START;  /* xorshift32 state, never 0 */
+static u32 AntttSearch_u32StepCycles;                    /* Decaying peak of the cycles taken by one step */
+
+static AntttSearchStatsType AntttSearch_sStats;          /* Timing for the debugger */
+
+/* Center, corners, then edges */
+static const u8 AntttSearch_au8MoveOrder[ANTTT_CELLS] = {4, 0, 2, 6, 8, 1, 3, 5, 7};
+
+/* Indexed by AntttLevelType */
+static const u8 AntttSearch_au8LevelDepth[ANTTT_LEVELS] = {1, 3, ANTTT_CELLS, ANTTT_CELLS};
+static const u8 AntttSearch_au8LevelNoise[ANTTT_LEVELS] = {0x0F, 0x03, 0x00, 0x00};
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchStart
+
+Description:
+Sets up a new search.  Any search in progress is abandoned.
+
+Requires:
+  - psBoard_ points to a valid board with eSide_ to move
+  - eLevel_ is the difficulty to search at
+
+Promises:
+  - The root frame holds the position and AntttSearchBusy() returns true, unless the game is already over in
+    which case the search is complete with AntttSearchResult() = ANTTT_NO_CELL
+*/
+void AntttSearchStart(const AntttBoardType* psBoard_, AntttSideType eSide_, AntttLevelType eLevel_)
+{
+  AntttSearchFrameType* psRoot = &AntttSearch_asStack[0];
+  u8 u8Empty = 0;
+  u8 u8HashMove;
+  s16 s16Score;
+
+  if(eSide_ == ANTTT_HOME)
+  {
+    psRoot->u16Own = psBoard_->u16Home;
+    psRoot->u16Opponent = psBoard_->u16Away;
+  }
+  else
+  {
+    psRoot->u16Own = psBoard_->u16Away;
+    psRoot->u16Opponent = psBoard_->u16Home;
+  }
+
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    if( !((psBoard_->u16Home | psBoard_->u16Away) & (1 << i)) )
+    {
+      u8Empty++;
+    }
+  }
+
+  AntttSearch_u8Ply = 0;
+  AntttSearch_eRootSide = eSide_;
+  AntttSearch_u8DepthLimit = AntttSearch_au8LevelDepth[eLevel_];
+  if(AntttSearch_u8DepthLimit > u8Empty)
+  {
+    AntttSearch_u8DepthLimit = u8Empty;
+  }
+  AntttSearch_u8NoiseMask = AntttSearch_au8LevelNoise[eLevel_];
+
+  /* Stored scores include the level's noise, so they only carry over between searches at the same level */
+  if(eLevel_ != AntttSearch_u8HashLevel)
+  {
+    AntttHashClear();
+    AntttSearch_u8HashLevel = eLevel_;
+  }
+  AntttHashNewSearch();
+
+  /* The root is always searched: the table only orders its moves */
+  psRoot->u32Key = AntttHashBoard(psBoard_, eSide_);
+  (void)AntttSearchProbe(psRoot->u32Key, 0, -ANTTT_SEARCH_INFINITY, ANTTT_SEARCH_INFINITY, &s16Score, &u8HashMove);
+  AntttSearchSetupFrame(psRoot, -ANTTT_SEARCH_INFINITY, ANTTT_SEARCH_INFINITY, u8HashMove);
+
+  AntttSearch_u8Result = ANTTT_NO_CELL;
+  AntttSearch_s16Score = 0;
+  AntttSearch_sStats.u32LastNodes = 0;
+  AntttSearch_sStats.u32LastTicks = 0;
+
+  /* Nothing to search once a line is complete */
+  AntttSearch_bBusy = true;
+  if( AntttWinningLine(psRoot->u16Own) || AntttWinningLine(psRoot->u16Opponent) )
+  {
+    AntttSearch_bBusy = false;
+  }
+
+} /* end AntttSearchStart() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchRun
+
+Description:
+Runs the search started by AntttSearchStart() for one time slice.  Call once per main loop pass until it returns
+true.  At least one step is taken per call so the search always makes progress.
+
+Requires:
+  - u32BudgetUs_ is the time allowed for this slice; values above ANTTT_SEARCH_MAX_BUDGET_US are limited to it
+  - TIMER1 is running (SystemCycleCapture())
+
+Promises:
+  - Returns true if the search is complete: AntttSearchResult() and AntttSearchScore() hold the answer
+  - Returns false if the budget ran out first; the search stack is left ready for the next call
+  - AntttSearch_sStats is updated with the slice duration and, when the search completes, the ticks it took
+*/
+bool AntttSearchRun(u32 u32BudgetUs_)
+{
+  u32 u32Start = SystemCycleCapture();
+  u32 u32Budget;
+  u32 u32Elapsed = 0;
+  AntttSearchFrameType* psFrame;
+  AntttSearchFrameType* psChild;
+  u32 u32Key;
+  u16 u16Move;
+  u16 u16Own;
+  s16 s16Score;
+  u8 u8Cell;
+  u8 u8HashMove;
+
+  if(!AntttSearch_bBusy)
+  {
+    return(true);
+  }
+
+  if(u32BudgetUs_ > ANTTT_SEARCH_MAX_BUDGET_US)
+  {
+    u32BudgetUs_ = ANTTT_SEARCH_MAX_BUDGET_US;
+  }
+  u32Budget = u32BudgetUs_ * ANTTT_SEARCH_CYCLES_PER_US;
+  AntttSearch_sStats.u32LastTicks++;
+
+  do
+  {
+    psFrame = &AntttSearch_asStack[AntttSearch_u8Ply];
+
+    /* All children searched or cut off: pass the score up */
+    if(psFrame->u8NextMove >= ANTTT_CELLS)
+    {
+      AntttSearchStoreFrame(psFrame, AntttSearch_u8Ply);
+      if(AntttSearch_u8Ply == 0)
+      {
+        AntttSearch_u8Result = psFrame->u8BestCell;
+        AntttSearch_s16Score = psFrame->s16Best;
+        AntttSearch_bBusy = false;
+        break;
+      }
+
+      AntttSearch_u8Ply--;
+      AntttSearchScoreChild(&AntttSearch_asStack[AntttSearch_u8Ply], -psFrame->s16Best);
+      continue;
+    }
+
+    /* The table's best cell first, then the fixed order without it */
+    if(psFrame->u8HashMove < ANTTT_CELLS)
+    {
+      u8Cell = psFrame->u8HashMove;
+      psFrame->u8HashMove |= ANTTT_SEARCH_HASH_TRIED;
+    }
+    else
+    {
+      u8Cell = AntttSearch_au8MoveOrder[psFrame->u8NextMove++];
+      if( u8Cell == (u8)(psFrame->u8HashMove & ~ANTTT_SEARCH_HASH_TRIED) )
+      {
+        continue;
+      }
+    }
+
+    u16Move = (u16)(1 << u8Cell);
+    if( (psFrame->u16Own | psFrame->u16Opponent) & u16Move )
+    {
+      continue;
+    }
+
+    AntttSearch_sStats.u32LastNodes++;
+    psFrame->u8Child = u8Cell;
+    u16Own = psFrame->u16Own | u16Move;
+
+    if( AntttWinningLine(u16Own) )
+    {
+      s16Score = ANTTT_SEARCH_WIN - (s16)(AntttSearch_u8Ply + 1);
+    }
+    else if( (u16Own | psFrame->u16Opponent) == ANTTT_BOARD_MASK )
+    {
+      s16Score = 0;
+    }
+    else if( (AntttSearch_u8Ply + 1) >= AntttSearch_u8DepthLimit )
+    {
+      s16Score = -AntttSearchEvaluate(psFrame->u16Opponent, u16Own);
+    }
+    else
+    {
+      u32Key = AntttHashMove(psFrame->u32Key, (AntttSideType)(AntttSearch_eRootSide ^ (AntttSearch_u8Ply & 1)), u8Cell);
+      if( AntttSearchProbe(u32Key, AntttSearch_u8Ply + 1, -psFrame->s16Beta, -psFrame->s16Alpha, &s16Score,
+                           &u8HashMove) )
+      {
+        s16Score = -s16Score;
+      }
+      else
+      {
+        /* Descend: the child is scored when its own moves are exhausted */
+        psChild = &AntttSearch_asStack[AntttSearch_u8Ply + 1];
+        psChild->u32Key = u32Key;
+        psChild->u16Own = psFrame->u16Opponent;
+        psChild->u16Opponent = u16Own;
+        AntttSearchSetupFrame(psChild, -psFrame->s16Beta, -psFrame->s16Alpha, u8HashMove);
+        AntttSearch_u8Ply++;
+        continue;
+      }
+    }
+
+    AntttSearchScoreChild(psFrame, s16Score);
+
+  } while( AntttSearchStepFits(u32Start, &u32Elapsed, u32Budget) );
+
+  /* Slice instrumentation */
+  AntttSearch_sStats.u32LastSliceCycles = SystemCyclesElapsed(u32Start);
+  if(AntttSearch_sStats.u32LastSliceCycles > AntttSearch_sStats.u32WorstSliceCycles)
+  {
+    AntttSearch_sStats.u32WorstSliceCycles = AntttSearch_sStats.u32LastSliceCycles;
+  }
+  if(AntttSearch_sStats.u32LastSliceCycles > u32Budget)
+  {
+    AntttSearch_sStats.u32Overruns++;
+  }
+
+  if(!AntttSearch_bBusy)
+  {
+    AntttSearch_sStats.u32Moves++;
+    if(AntttSearch_sStats.u32LastTicks > AntttSearch_sStats.u32WorstTicks)
+    {
+      AntttSearch_sStats.u32WorstTicks = AntttSearch_sStats.u32LastTicks;
+    }
+  }
+
+  return(!AntttSearch_bBusy);
+
+} /* end AntttSearchRun() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchBusy
+
+Description:
+Reports whether a search is in progress.
+
+Requires:
+  -
+
+Promises:
+  - Returns true if AntttSearchRun() still has work to do
+*/
+bool AntttSearchBusy(void)
+{
+  return(AntttSearch_bBusy);
+
+} /* end AntttSearchBusy() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchResult
+
+Description:
+Returns the move chosen by the last completed search.
+
+Requires:
+  - AntttSearchRun() has returned true
+
+Promises:
+  - Returns the cell 0-8, or ANTTT_NO_CELL if the position had no moves
+*/
+u8 AntttSearchResult(void)
+{
+  return(AntttSearch_u8Result);
+
+} /* end AntttSearchResult() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchScore
+
+Description:
+Returns the score of the move chosen by the last completed search.
+
+Requires:
+  - AntttSearchRun() has returned true
+
+Promises:
+  - Returns the score for the side that searched: above 0 is a win (ANTTT_SEARCH_WIN less the ply it happens
+    on), below 0 a loss; inside the depth limit 0 is a draw
+*/
+s16 AntttSearchScore(void)
+{
+  return(AntttSearch_s16Score);
+
+} /* end AntttSearchScore() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchSeed
+
+Description:
+Mixes a value into the evaluation noise generator.  Any captured timer value makes a useful seed since it depends
+on when the player moved.
+
+Requires:
+  -
+
+Promises:
+  - AntttSearch_u32Random is changed and non-zero
+*/
+void AntttSearchSeed(u32 u32Seed_)
+{
+  AntttSearch_u32Random ^= u32Seed_;
+  if(AntttSearch_u32Random == 0)
+  {
+    AntttSearch_u32Random = ANTTT_SEARCH_RANDOM_START;
+  }
+
+} /* end AntttSearchSeed() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchGetStats
+
+Description:
+Returns the search timing statistics.
+
+Requires:
+  -
+
+Promises:
+  - Returns a pointer to the statistics, which are updated by every AntttSearchRun()
+*/
+const AntttSearchStatsType* AntttSearchGetStats(void)
+{
+  return(&AntttSearch_sStats);
+
+} /* end AntttSearchGetStats() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchInitialize
+
+Description:
+Clears the search and its statistics.
+
+Requires:
+  -
+
+Promises:
+  - No search is in progress and AntttSearch_sStats is zeroed
+  - The transposition table is cleared by the next AntttSearchStart()
+  - The noise generator restarts from its fixed state, so the same AntttSearchSeed() calls give the same searches
+*/
+void AntttSearchInitialize(void)
+{
+  AntttSearch_bBusy = false;
+  AntttSearch_u32Random = ANTTT_SEARCH_RANDOM_START;
+  AntttSearch_u8HashLevel = ANTTT_LEVELS;
+  AntttSearch_u8Result = ANTTT_NO_CELL;
+  AntttSearch_u32StepCycles = 0;
+  memset(&AntttSearch_sStats, 0, sizeof(AntttSearch_sStats));
+
+} /* end AntttSearchInitialize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchStepFits
+
+Description:
+Called after each step of AntttSearchRun().  Measures the step just taken, updates the step cost estimate and
+decides whether another step still fits in the slice.
+
+Requires:
+  - u32Start_ is the cycle count captured at the start of the slice
+  - *pu32Elapsed_ is the elapsed count returned by the previous call in this slice (0 for the first)
+  - u32Budget_ is the slice budget in cycles, less than TIMER_COUNT_1MS
+
+Promises:
+  - *pu32Elapsed_ is updated to the cycles used so far
+  - AntttSearch_u32StepCycles rises to any longer step and otherwise decays by 1/16
+  - AntttSearch_sStats.u32WorstStepCycles holds the longest step seen
+  - Returns true if the elapsed cycles plus the step cost estimate are within u32Budget_
+*/
+bool AntttSearchStepFits(u32 u32Start_, u32* pu32Elapsed_, u32 u32Budget_)
+{
+  u32 u32Elapsed = SystemCyclesElapsed(u32Start_);
+  u32 u32Step = u32Elapsed - *pu32Elapsed_;
+
+  *pu32Elapsed_ = u32Elapsed;
+  if(u32Step > AntttSearch_sStats.u32WorstStepCycles)
+  {
+    AntttSearch_sStats.u32WorstStepCycles = u32Step;
+  }
+
+  if(u32Step > AntttSearch_u32StepCycles)
+  {
+    AntttSearch_u32StepCycles = u32Step;
+  }
+  else
+  {
+    AntttSearch_u32StepCycles -= AntttSearch_u32StepCycles >> 4;
+  }
+
+  return( (u32Elapsed + AntttSearch_u32StepCycles) <= u32Budget_ );
+
+} /* end AntttSearchStepFits() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchScoreChild
+
+Description:
+Folds the score of the child just searched into a frame and checks for a cutoff.
+
+Requires:
+  - psFrame_->u8Child is the cell that was played to reach the child
+  - s16Score_ is the child's score from psFrame_'s point of view
+
+Promises:
+  - psFrame_ best score, best cell and alpha are updated
+  - If alpha reaches beta, the remaining moves of psFrame_ are skipped
+*/
+void AntttSearchScoreChild(AntttSearchFrameType* psFrame_, s16 s16Score_)
+{
+  if(s16Score_ > psFrame_->s16Best)
+  {
+    psFrame_->s16Best = s16Score_;
+    psFrame_->u8BestCell = psFrame_->u8Child;
+  }
+
+  if(s16Score_ > psFrame_->s16Alpha)
+  {
+    psFrame_->s16Alpha = s16Score_;
+    if(psFrame_->s16Alpha >= psFrame_->s16Beta)
+    {
+      psFrame_->u8NextMove = ANTTT_CELLS;
+    }
+  }
+
+} /* end AntttSearchScoreChild() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchSetupFrame
+
+Description:
+Readies a frame whose key and masks are already set.
+
+Requires:
+  - s16Alpha_ and s16Beta_ are the window for the frame
+  - u8HashMove_ is the cell suggested by the transposition table, or ANTTT_NO_CELL
+
+Promises:
+  - The frame has no best move yet and will try u8HashMove_ first, then the fixed move order
+*/
+void AntttSearchSetupFrame(AntttSearchFrameType* psFrame_, s16 s16Alpha_, s16 s16Beta_, u8 u8HashMove_)
+{
+  psFrame_->s16Alpha = s16Alpha_;
+  psFrame_->s16Beta = s16Beta_;
+  psFrame_->s16AlphaStart = s16Alpha_;
+  psFrame_->s16Best = -ANTTT_SEARCH_INFINITY;
+  psFrame_->u8BestCell = ANTTT_NO_CELL;
+  psFrame_->u8HashMove = u8HashMove_;
+  psFrame_->u8NextMove = 0;
+
+} /* end AntttSearchSetupFrame() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchProbe
+
+Description:
+Looks up a position about to be searched at ply u8Ply_ with window s16Alpha_..s16Beta_.
+
+Requires:
+  - u32Key_ is the position's key, with the side to move at u8Ply_ to move
+
+Promises:
+  - *pu8Move_ is the stored best cell, or ANTTT_NO_CELL if the position is not in the table
+  - Returns true if the stored result was searched deep enough and is exact or a bound outside the window;
+    *ps16Score_ is then the score for the side to move with wins and losses put back to absolute plies
+*/
+bool AntttSearchProbe(u32 u32Key_, u8 u8Ply_, s16 s16Alpha_, s16 s16Beta_, s16* ps16Score_, u8* pu8Move_)
+{
+  const AntttHashEntryType* psEntry = AntttHashProbe(u32Key_);
+  s16 s16Score;
+
+  *pu8Move_ = ANTTT_NO_CELL;
+  if(psEntry == NULL)
+  {
+    return(false);
+  }
+
+  *pu8Move_ = psEntry->u8Move;
+  if(psEntry->u8Depth < (u8)(AntttSearch_u8DepthLimit - u8Ply_))
+  {
+    return(false);
+  }
+
+  s16Score = psEntry->s16Score;
+  if(s16Score > ANTTT_SEARCH_WIN_BOUND)
+  {
+    s16Score -= u8Ply_;
+  }
+  else if(s16Score < -ANTTT_SEARCH_WIN_BOUND)
+  {
+    s16Score += u8Ply_;
+  }
+  *ps16Score_ = s16Score;
+
+  return( (psEntry->u8Bound == ANTTT_HASH_EXACT) ||
+          ((psEntry->u8Bound == ANTTT_HASH_LOWER) && (s16Score >= s16Beta_)) ||
+          ((psEntry->u8Bound == ANTTT_HASH_UPPER) && (s16Score <= s16Alpha_)) );
+
+} /* end AntttSearchProbe() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchStoreFrame
+
+Description:
+Stores the result of a finished frame in the transposition table.
+
+Requires:
+  - psFrame_ at ply u8Ply_ has searched all its moves or been cut off
+
+Promises:
+  - The best score is stored as exact, a lower bound (it reached beta) or an upper bound (it did not beat the
+    starting alpha), with win and loss scores made relative to the frame
+*/
+void AntttSearchStoreFrame(const AntttSearchFrameType* psFrame_, u8 u8Ply_)
+{
+  s16 s16Score = psFrame_->s16Best;
+  AntttHashBoundType eBound = ANTTT_HASH_EXACT;
+
+  if(s16Score <= psFrame_->s16AlphaStart)
+  {
+    eBound = ANTTT_HASH_UPPER;
+  }
+  else if(s16Score >= psFrame_->s16Beta)
+  {
+    eBound = ANTTT_HASH_LOWER;
+  }
+
+  if(s16Score > ANTTT_SEARCH_WIN_BOUND)
+  {
+    s16Score += u8Ply_;
+  }
+  else if(s16Score < -ANTTT_SEARCH_WIN_BOUND)
+  {
+    s16Score -= u8Ply_;
+  }
+
+  AntttHashStore(psFrame_->u32Key, (u8)(AntttSearch_u8DepthLimit - u8Ply_), s16Score, eBound, psFrame_->u8BestCell);
+
+} /* end AntttSearchStoreFrame() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchEvaluate
+
+Description:
+Static evaluation at the depth limit: lines still open to the side to move less lines still open to the
+opponent, plus the level's noise.
+
+Requires:
+  - u16Own_ is the side to move and u16Opponent_ the other side, with no completed line
+
+Promises:
+  - Returns the score from the side to move's point of view, well inside +/-ANTTT_SEARCH_WIN
+*/
+s16 AntttSearchEvaluate(u16 u16Own_, u16 u16Opponent_)
+{
+  s16 s16Score = (s16)AntttOpenLines(u16Own_, u16Opponent_) - (s16)AntttOpenLines(u16Opponent_, u16Own_);
+
+  if(AntttSearch_u8NoiseMask)
+  {
+    s16Score += (s16)(AntttSearchRandom() & AntttSearch_u8NoiseMask) - (s16)(AntttSearch_u8NoiseMask >> 1);
+  }
+
+  return(s16Score);
+
+} /* end AntttSearchEvaluate() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSearchRandom
+
+Description:
+xorshift32 generator for the evaluation noise.  Shifts and XORs only, so it is cheap on the Cortex-M0.
+
+Requires:
+  - AntttSearch_u32Random is not 0
+
+Promises:
+  - Returns the next 32-bit value
+*/
+u32 AntttSearchRandom(void)
+{
+  AntttSearch_u32Random ^= AntttSearch_u32Random << 13;
+  AntttSearch_u32Random ^= AntttSearch_u32Random >> 17;
+  AntttSearch_u32Random ^= AntttSearch_u32Random << 5;
+
+  return(AntttSearch_u32Random);
+
+} /* end AntttSearchRandom() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
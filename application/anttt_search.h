@@ -0,0 +1,97 @@
+/**********************************************************************************************************************
+File: anttt_search.h
+
+Description:
+Header file for anttt_search.c
+**********************************************************************************************************************/
+
+#ifndef __ANTTT_SEARCH_H
+#define __ANTTT_SEARCH_H
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+/* One ply of the explicit search stack.  Masks are relative to the side to move at this ply. */
+typedef struct
+{
+  u32 u32Key;                                       /* Zobrist key of the position (anttt_hash.c) */
+  u16 u16Own;                                       /* Cells held by the side to move */
+  u16 u16Opponent;                                  /* Cells held by the other side */
+  s16 s16Alpha;                                     /* Alpha-beta window for this node */
+  s16 s16Beta;
+  s16 s16AlphaStart;                                /* Alpha on entry, to tell an exact score from a bound */
+  s16 s16Best;                                      /* Best score found so far */
+  u8 u8BestCell;                                    /* Cell that gave s16Best */
+  u8 u8HashMove;                                    /* Best cell from the table, tried first; ORed with _TRIED */
+  u8 u8NextMove;                                    /* Index into the move order of the next child to search */
+  u8 u8Child;                                       /* Cell of the child currently being searched */
+} AntttSearchFrameType;
+
+typedef struct
+{
+  u32 u32Moves;                                     /* Searches completed */
+  u32 u32LastNodes;                                 /* Nodes searched for the last move */
+  u32 u32LastTicks;                                 /* Main loop passes (1ms ticks) used by the last move */
+  u32 u32WorstTicks;                                /* Most ticks used by any move */
+  u32 u32LastSliceCycles;                           /* Duration of the most recent slice */
+  u32 u32WorstSliceCycles;                          /* Longest slice since AntttSearchInitialize() */
+  u32 u32WorstStepCycles;                           /* Longest single step of the search loop */
+  u32 u32Overruns;                                  /* Slices that ran past their budget */
+} AntttSearchStatsType;
+
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+#define ANTTT_SEARCH_BUDGET_US      (u32)300      /* Default search time per main loop pass */
+#define ANTTT_SEARCH_MAX_BUDGET_US  (u32)900      /* Largest budget accepted: a slice must end inside its 1ms tick */
+#define ANTTT_SEARCH_CYCLES_PER_US  (u32)(HFCLK_FREQ / 1000000)
+
+#define ANTTT_SEARCH_MAX_PLY        (u8)(ANTTT_CELLS + 1)
+#define ANTTT_SEARCH_WIN            (s16)100      /* Score of a win at the root, less one per ply */
+#define ANTTT_SEARCH_INFINITY       (s16)1000
+#define ANTTT_SEARCH_WIN_BOUND      (s16)(ANTTT_SEARCH_WIN - ANTTT_SEARCH_MAX_PLY)  /* Scores beyond are wins */
+#define ANTTT_SEARCH_HASH_TRIED     (u8)0x80      /* Set in u8HashMove once it has been searched */
+#define ANTTT_SEARCH_RANDOM_START   (u32)0x2545F491  /* Noise generator state after AntttSearchInitialize() */
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttSearchStart(const AntttBoardType* psBoard_, AntttSideType eSide_, AntttLevelType eLevel_);
+bool AntttSearchRun(u32 u32BudgetUs_);
+bool AntttSearchBusy(void);
+u8 AntttSearchResult(void);
+s16 AntttSearchScore(void);
+void AntttSearchSeed(u32 u32Seed_);
+const AntttSearchStatsType* AntttSearchGetStats(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void AntttSearchInitialize(void);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+bool AntttSearchStepFits(u32 u32Start_, u32* pu32Elapsed_, u32 u32Budget_);
+void AntttSearchScoreChild(AntttSearchFrameType* psFrame_, s16 s16Score_);
+void AntttSearchSetupFrame(AntttSearchFrameType* psFrame_, s16 s16Alpha_, s16 s16Beta_, u8 u8HashMove_);
+bool AntttSearchProbe(u32 u32Key_, u8 u8Ply_, s16 s16Alpha_, s16 s16Beta_, s16* ps16Score_, u8* pu8Move_);
+void AntttSearchStoreFrame(const AntttSearchFrameType* psFrame_, u8 u8Ply_);
+s16 AntttSearchEvaluate(u16 u16Own_, u16 u16Opponent_);
+u32 AntttSearchRandom(void);
+
+
+#endif /* __ANTTT_SEARCH_H */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
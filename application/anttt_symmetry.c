@@ -0,0 +1,233 @@
+/**********************************************************************************************************************
+File: anttt_symmetry.c
+
+Description:
+Dihedral symmetry of the 3x3 board.  Each of the 8 rotations and reflections is stored as a permutation of the
+9 cells, and as two lookup tables that transform a whole cell mask at once (bits 0-4 and bits 5-8), so transforming
+a mask costs two loads and an OR with no per-cell branching.
+
+A position is canonicalized by transforming both sides' masks through all 8 transforms and keeping the one with
+the smallest (own << 9 | opponent) value.  The transform used is returned so a move chosen on the canonical board
+can be mapped back onto the physical HOME1..HOME9 / AWAY1..AWAY9 LEDs with AntttSymUnmapCell().
+
+Transforms: 0 identity, 1 rotate 90, 2 rotate 180, 3 rotate 270 (clockwise), 4 mirror left-right,
+5 mirror top-bottom, 6 transpose, 7 anti-transpose.
+
+------------------------------------------------------------------------------------------------------------------------
+API:
+u16 AntttSymTransformMask(u8 u8Transform_, u16 u16Cells_)
+Returns the 9-bit cell mask after applying the transform.
+
+u8 AntttSymCanonicalize(u16* pu16Own_, u16* pu16Opponent_)
+Replaces both masks with the canonical position and returns the transform that was applied.
+
+u8 AntttSymMapCell(u8 u8Transform_, u8 u8Cell_)
+u8 AntttSymUnmapCell(u8 u8Transform_, u8 u8Cell_)
+Map a cell index from the physical board to the transformed board, and back.
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Existing variables (defined in other files -- should all contain the "extern" keyword) */
+
+
+/***********************************************************************************************************************
+Global variable definitions with scope limited to this local application.
+Variable names shall start with "AntttSym_" and be declared as static.
+***********************************************************************************************************************/
+/* Cell n moves to AntttSym_au8CellMap[t][n] under transform t */
+static const u8 AntttSym_au8CellMap[ANTTT_SYM_TRANSFORMS][ANTTT_CELLS] =
+{
+  {0, 1, 2, 3, 4, 5, 6, 7, 8},
+  {2, 5, 8, 1, 4, 7, 0, 3, 6},
+  {8, 7, 6, 5, 4, 3, 2, 1, 0},
+  {6, 3, 0, 7, 4, 1, 8, 5, 2},
+  {2, 1, 0, 5, 4, 3, 8, 7, 6},
+  {6, 7, 8, 3, 4, 5, 0, 1, 2},
+  {0, 3, 6, 1, 4, 7, 2, 5, 8},
+  {8, 5, 2, 7, 4, 1, 6, 3, 0}
+};
+
+/* Transform that undoes transform t */
+static const u8 AntttSym_au8Inverse[ANTTT_SYM_TRANSFORMS] = {0, 3, 2, 1, 4, 5, 6, 7};
+
+/* Transformed mask of cells 1-5 (bits 0-4) for each transform */
+static const u16 AntttSym_au16Low[ANTTT_SYM_TRANSFORMS][32] =
+{
+  { /* 0: identity */
+    0x000, 0x001, 0x002, 0x003, 0x004, 0x005, 0x006, 0x007, 0x008, 0x009, 0x00A, 0x00B, 0x00C, 0x00D, 0x00E, 0x00F,
+    0x010, 0x011, 0x012, 0x013, 0x014, 0x015, 0x016, 0x017, 0x018, 0x019, 0x01A, 0x01B, 0x01C, 0x01D, 0x01E, 0x01F
+  },
+  { /* 1: rotate 90 clockwise */
+    0x000, 0x004, 0x020, 0x024, 0x100, 0x104, 0x120, 0x124, 0x002, 0x006, 0x022, 0x026, 0x102, 0x106, 0x122, 0x126,
+    0x010, 0x014, 0x030, 0x034, 0x110, 0x114, 0x130, 0x134, 0x012, 0x016, 0x032, 0x036, 0x112, 0x116, 0x132, 0x136
+  },
+  { /* 2: rotate 180 */
+    0x000, 0x100, 0x080, 0x180, 0x040, 0x140, 0x0C0, 0x1C0, 0x020, 0x120, 0x0A0, 0x1A0, 0x060, 0x160, 0x0E0, 0x1E0,
+    0x010, 0x110, 0x090, 0x190, 0x050, 0x150, 0x0D0, 0x1D0, 0x030, 0x130, 0x0B0, 0x1B0, 0x070, 0x170, 0x0F0, 0x1F0
+  },
+  { /* 3: rotate 270 clockwise */
+    0x000, 0x040, 0x008, 0x048, 0x001, 0x041, 0x009, 0x049, 0x080, 0x0C0, 0x088, 0x0C8, 0x081, 0x0C1, 0x089, 0x0C9,
+    0x010, 0x050, 0x018, 0x058, 0x011, 0x051, 0x019, 0x059, 0x090, 0x0D0, 0x098, 0x0D8, 0x091, 0x0D1, 0x099, 0x0D9
+  },
+  { /* 4: mirror left-right */
+    0x000, 0x004, 0x002, 0x006, 0x001, 0x005, 0x003, 0x007, 0x020, 0x024, 0x022, 0x026, 0x021, 0x025, 0x023, 0x027,
+    0x010, 0x014, 0x012, 0x016, 0x011, 0x015, 0x013, 0x017, 0x030, 0x034, 0x032, 0x036, 0x031, 0x035, 0x033, 0x037
+  },
+  { /* 5: mirror top-bottom */
+    0x000, 0x040, 0x080, 0x0C0, 0x100, 0x140, 0x180, 0x1C0, 0x008, 0x048, 0x088, 0x0C8, 0x108, 0x148, 0x188, 0x1C8,
+    0x010, 0x050, 0x090, 0x0D0, 0x110, 0x150, 0x190, 0x1D0, 0x018, 0x058, 0x098, 0x0D8, 0x118, 0x158, 0x198, 0x1D8
+  },
+  { /* 6: transpose (main diagonal) */
+    0x000, 0x001, 0x008, 0x009, 0x040, 0x041, 0x048, 0x049, 0x002, 0x003, 0x00A, 0x00B, 0x042, 0x043, 0x04A, 0x04B,
+    0x010, 0x011, 0x018, 0x019, 0x050, 0x051, 0x058, 0x059, 0x012, 0x013, 0x01A, 0x01B, 0x052, 0x053, 0x05A, 0x05B
+  },
+  { /* 7: anti-transpose (other diagonal) */
+    0x000, 0x100, 0x020, 0x120, 0x004, 0x104, 0x024, 0x124, 0x080, 0x180, 0x0A0, 0x1A0, 0x084, 0x184, 0x0A4, 0x1A4,
+    0x010, 0x110, 0x030, 0x130, 0x014, 0x114, 0x034, 0x134, 0x090, 0x190, 0x0B0, 0x1B0, 0x094, 0x194, 0x0B4, 0x1B4
+  }
+};
+
+/* Transformed mask of cells 6-9 (bits 5-8) for each transform */
+static const u16 AntttSym_au16High[ANTTT_SYM_TRANSFORMS][16] =
+{
+  {0x000, 0x020, 0x040, 0x060, 0x080, 0x0A0, 0x0C0, 0x0E0, 0x100, 0x120, 0x140, 0x160, 0x180, 0x1A0, 0x1C0, 0x1E0},  /* 0 */
+  {0x000, 0x080, 0x001, 0x081, 0x008, 0x088, 0x009, 0x089, 0x040, 0x0C0, 0x041, 0x0C1, 0x048, 0x0C8, 0x049, 0x0C9},  /* 1 */
+  {0x000, 0x008, 0x004, 0x00C, 0x002, 0x00A, 0x006, 0x00E, 0x001, 0x009, 0x005, 0x00D, 0x003, 0x00B, 0x007, 0x00F},  /* 2 */
+  {0x000, 0x002, 0x100, 0x102, 0x020, 0x022, 0x120, 0x122, 0x004, 0x006, 0x104, 0x106, 0x024, 0x026, 0x124, 0x126},  /* 3 */
+  {0x000, 0x008, 0x100, 0x108, 0x080, 0x088, 0x180, 0x188, 0x040, 0x048, 0x140, 0x148, 0x0C0, 0x0C8, 0x1C0, 0x1C8},  /* 4 */
+  {0x000, 0x020, 0x001, 0x021, 0x002, 0x022, 0x003, 0x023, 0x004, 0x024, 0x005, 0x025, 0x006, 0x026, 0x007, 0x027},  /* 5 */
+  {0x000, 0x080, 0x004, 0x084, 0x020, 0x0A0, 0x024, 0x0A4, 0x100, 0x180, 0x104, 0x184, 0x120, 0x1A0, 0x124, 0x1A4},  /* 6 */
+  {0x000, 0x002, 0x040, 0x042, 0x008, 0x00A, 0x048, 0x04A, 0x001, 0x003, 0x041, 0x043, 0x009, 0x00B, 0x049, 0x04B}   /* 7 */
+};
+
+
+/**********************************************************************************************************************
+Function Definitions
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSymTransformMask
+
+Description:
+Applies a transform to a cell mask.
+
+Requires:
+  - u8Transform_ is 0 to ANTTT_SYM_TRANSFORMS - 1
+  - u16Cells_ is a 9-bit cell mask
+
+Promises:
+  - Returns the transformed cell mask
+*/
+u16 AntttSymTransformMask(u8 u8Transform_, u16 u16Cells_)
+{
+  return( AntttSym_au16Low[u8Transform_][u16Cells_ & 0x1F] | AntttSym_au16High[u8Transform_][u16Cells_ >> 5] );
+
+} /* end AntttSymTransformMask() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSymCanonicalize
+
+Description:
+Reduces a position to its canonical form: the symmetric equivalent with the smallest (own << 9 | opponent).
+
+Requires:
+  - *pu16Own_ and *pu16Opponent_ are non-overlapping 9-bit cell masks
+
+Promises:
+  - *pu16Own_ and *pu16Opponent_ hold the canonical position
+  - Returns the transform that maps the original position onto the canonical one
+*/
+u8 AntttSymCanonicalize(u16* pu16Own_, u16* pu16Opponent_)
+{
+  u16 u16Own = *pu16Own_;
+  u16 u16Opponent = *pu16Opponent_;
+  u32 u32Best = ((u32)u16Own << 9) | u16Opponent;
+  u32 u32Candidate;
+  u8 u8BestTransform = ANTTT_SYM_IDENTITY;
+
+  for(u8 i = 1; i < ANTTT_SYM_TRANSFORMS; i++)
+  {
+    u32Candidate = ((u32)(AntttSym_au16Low[i][u16Own & 0x1F] | AntttSym_au16High[i][u16Own >> 5]) << 9) |
+                   (AntttSym_au16Low[i][u16Opponent & 0x1F] | AntttSym_au16High[i][u16Opponent >> 5]);
+    if(u32Candidate < u32Best)
+    {
+      u32Best = u32Candidate;
+      u8BestTransform = i;
+    }
+  }
+
+  *pu16Own_ = (u16)(u32Best >> 9);
+  *pu16Opponent_ = (u16)(u32Best & ANTTT_BOARD_MASK);
+
+  return(u8BestTransform);
+
+} /* end AntttSymCanonicalize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSymMapCell
+
+Description:
+Maps a cell on the physical board to the same cell on the transformed board.
+
+Requires:
+  - u8Transform_ is 0 to ANTTT_SYM_TRANSFORMS - 1
+  - u8Cell_ is 0-8
+
+Promises:
+  - Returns the transformed cell index
+*/
+u8 AntttSymMapCell(u8 u8Transform_, u8 u8Cell_)
+{
+  return( AntttSym_au8CellMap[u8Transform_][u8Cell_] );
+
+} /* end AntttSymMapCell() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: AntttSymUnmapCell
+
+Description:
+Maps a cell on a transformed (e.g. canonical) board back to the physical board.
+
+Requires:
+  - u8Transform_ is the transform returned by AntttSymCanonicalize()
+  - u8Cell_ is 0-8
+
+Promises:
+  - Returns the physical cell index, which is also the HOME1/AWAY1 based LED offset
+*/
+u8 AntttSymUnmapCell(u8 u8Transform_, u8 u8Cell_)
+{
+  return( AntttSym_au8CellMap[AntttSym_au8Inverse[u8Transform_]][u8Cell_] );
+
+} /* end AntttSymUnmapCell() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,51 @@
+/**********************************************************************************************************************
+File: anttt_symmetry.h
+
+Description:
+Header file for anttt_symmetry.c
+**********************************************************************************************************************/
+
+#ifndef __ANTTT_SYMMETRY_H
+#define __ANTTT_SYMMETRY_H
+
+/**********************************************************************************************************************
+Type Definitions
+**********************************************************************************************************************/
+
+
+/**********************************************************************************************************************
+Constants / Definitions
+**********************************************************************************************************************/
+#define ANTTT_SYM_TRANSFORMS    (u8)8             /* Rotations and reflections of the 3x3 board */
+#define ANTTT_SYM_IDENTITY      (u8)0             /* Transform that leaves the board unchanged */
+
+
+/**********************************************************************************************************************
+Function Declarations
+**********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+u16 AntttSymTransformMask(u8 u8Transform_, u16 u16Cells_);
+u8 AntttSymCanonicalize(u16* pu16Own_, u16* pu16Opponent_);
+u8 AntttSymMapCell(u8 u8Transform_, u8 u8Cell_);
+u8 AntttSymUnmapCell(u8 u8Transform_, u8 u8Cell_);
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions                                                                                                */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+
+#endif /* __ANTTT_SYMMETRY_H */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,1378 @@
+/**********************************************************************************************************************
+File: anttt_table.c
+
+Description:
+Perfect-play table for AntttBestMove().  GENERATED by host/anttt_table_gen.c -- do not edit.
+One byte per position: bits 0-3 are the best cell (ANTTT_TABLE_NO_CELL if the game is over) and bits 4-5
+the value to the side to move (ANTTT_VALUE_LOSS/DRAW/WIN/INVALID).
+
+ANTTT_TABLE_FULL: one entry per base-3 key from AntttTableKey(); 5478 of 19683 keys are reachable.
+Otherwise: the 765 reachable positions that are their own canonical form under AntttSymCanonicalize(),
+as sorted keys and entries.  Cells are in the canonical frame.
+**********************************************************************************************************************/
+
+#include "configuration.h"
+
+#ifdef ANTTT_TABLE_FULL
+const u8 G_au8AntttTable[ANTTT_TABLE_SIZE] =
+{
+  0x10, 0x3F, 0x14, 0x3F, 0x3F, 0x13, 0x10, 0x23, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x25, 0x14, 0x23, 0x3F, 0x14, 0x3F, 0x14, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F,
+  0x3F, 0x20, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x20, 0x3F, 0x01,
+  0x3F, 0x3F, 0x24, 0x20, 0x26, 0x3F, 0x10, 0x21, 0x3F, 0x20, 0x3F, 0x06, 0x3F, 0x14, 0x3F, 0x20,
+  0x3F, 0x06, 0x3F, 0x3F, 0x06, 0x28, 0x24, 0x3F, 0x3F, 0x14, 0x3F, 0x14, 0x24, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x26, 0x10, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x0F, 0x20, 0x3F, 0x16, 0x3F, 0x3F, 0x27, 0x10, 0x28, 0x3F,
+  0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x10, 0x28, 0x3F, 0x27, 0x3F, 0x27, 0x3F,
+  0x28, 0x3F, 0x10, 0x11, 0x3F, 0x10, 0x3F, 0x08, 0x3F, 0x17, 0x3F, 0x10, 0x3F, 0x18, 0x3F, 0x3F,
+  0x18, 0x17, 0x17, 0x3F, 0x3F, 0x16, 0x3F, 0x06, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x08,
+  0x3F, 0x3F, 0x18, 0x07, 0x26, 0x3F, 0x3F, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x17, 0x3F, 0x05, 0x06,
+  0x26, 0x3F, 0x16, 0x3F, 0x05, 0x3F, 0x26, 0x3F, 0x3F, 0x15, 0x3F, 0x05, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x15, 0x21, 0x3F, 0x20, 0x3F, 0x05, 0x3F, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x05, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x10, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x00, 0x23, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x0F, 0x10, 0x3F, 0x16, 0x3F, 0x3F, 0x26, 0x10,
+  0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x10, 0x11, 0x3F, 0x10, 0x3F,
+  0x16, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16, 0x3F, 0x3F, 0x3F,
+  0x22, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x10, 0x3F, 0x01, 0x3F,
+  0x3F, 0x27, 0x10, 0x28, 0x3F, 0x10, 0x3F, 0x08, 0x3F, 0x3F, 0x18, 0x07, 0x17, 0x3F, 0x3F, 0x3F,
+  0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x06, 0x16, 0x3F, 0x16, 0x3F, 0x03, 0x3F, 0x03, 0x3F,
+  0x3F, 0x3F, 0x08, 0x3F, 0x3F, 0x3F, 0x07, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x06, 0x3F, 0x01, 0x3F, 0x3F, 0x06, 0x00, 0x26, 0x3F, 0x10, 0x22, 0x3F, 0x22, 0x3F,
+  0x02, 0x3F, 0x17, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x28, 0x28, 0x3F, 0x3F, 0x16, 0x3F,
+  0x16, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x22, 0x3F, 0x22, 0x3F, 0x14, 0x3F, 0x26, 0x3F, 0x20,
+  0x3F, 0x13, 0x3F, 0x3F, 0x24, 0x13, 0x24, 0x3F, 0x3F, 0x08, 0x3F, 0x08, 0x08, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x10, 0x3F, 0x12, 0x3F, 0x3F, 0x12, 0x12, 0x26, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F,
+  0x26, 0x3F, 0x14, 0x18, 0x26, 0x3F, 0x28, 0x3F, 0x18, 0x3F, 0x26, 0x3F, 0x3F, 0x24, 0x3F, 0x24,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x21, 0x3F, 0x20, 0x3F, 0x04, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x10, 0x28, 0x3F,
+  0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x18, 0x28, 0x3F, 0x27, 0x3F, 0x27, 0x3F,
+  0x28, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x26, 0x18, 0x3F, 0x01, 0x3F, 0x3F, 0x27, 0x00, 0x26, 0x3F, 0x20, 0x28, 0x3F,
+  0x27, 0x3F, 0x27, 0x3F, 0x28, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F,
+  0x28, 0x3F, 0x27, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x13, 0x3F, 0x03, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x13, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x10, 0x26, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x26, 0x3F, 0x20, 0x3F, 0x18, 0x3F,
+  0x3F, 0x18, 0x17, 0x26, 0x3F, 0x3F, 0x26, 0x3F, 0x00, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x20, 0x3F, 0x01, 0x3F, 0x3F,
+  0x27, 0x20, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x02, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x24,
+  0x3F, 0x27, 0x3F, 0x3F, 0x24, 0x28, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F,
+  0x24, 0x14, 0x28, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F,
+  0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x27, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x10, 0x28, 0x3F, 0x10, 0x3F, 0x18, 0x3F, 0x3F,
+  0x18, 0x17, 0x23, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x17, 0x3F, 0x03, 0x10, 0x23, 0x3F,
+  0x10, 0x3F, 0x18, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x02, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x05, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x18, 0x20, 0x3F,
+  0x3F, 0x15, 0x15, 0x3F, 0x15, 0x3F, 0x02, 0x3F, 0x02, 0x3F, 0x15, 0x3F, 0x01, 0x3F, 0x3F, 0x05,
+  0x00, 0x05, 0x3F, 0x3F, 0x15, 0x3F, 0x15, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x24, 0x10, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x28, 0x3F, 0x3F, 0x3F, 0x17, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28,
+  0x10, 0x3F, 0x01, 0x3F, 0x3F, 0x18, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F,
+  0x3F, 0x20, 0x3F, 0x0F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x17, 0x17, 0x3F, 0x3F, 0x3F, 0x28,
+  0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x10, 0x11, 0x3F, 0x10, 0x3F, 0x18, 0x3F, 0x17, 0x3F, 0x20,
+  0x3F, 0x18, 0x3F, 0x3F, 0x24, 0x20, 0x23, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F,
+  0x24, 0x28, 0x23, 0x3F, 0x28, 0x3F, 0x18, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x3F, 0x3F,
+  0x20, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x20, 0x3F, 0x01, 0x3F,
+  0x3F, 0x18, 0x20, 0x3F, 0x3F, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F,
+  0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x04, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x28, 0x3F, 0x01, 0x3F, 0x3F, 0x27, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x28, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x28,
+  0x3F, 0x13, 0x23, 0x3F, 0x13, 0x3F, 0x02, 0x3F, 0x23, 0x3F, 0x13, 0x3F, 0x01, 0x3F, 0x3F, 0x03,
+  0x00, 0x23, 0x3F, 0x3F, 0x23, 0x3F, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x18, 0x3F,
+  0x3F, 0x18, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x07, 0x20, 0x3F,
+  0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x14, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x14, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x3F,
+  0x03, 0x14, 0x28, 0x3F, 0x3F, 0x04, 0x3F, 0x14, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x14,
+  0x3F, 0x3F, 0x24, 0x14, 0x24, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x14,
+  0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x20, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x13, 0x3F, 0x3F, 0x27, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x13, 0x3F,
+  0x3F, 0x3F, 0x25, 0x3F, 0x13, 0x11, 0x28, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x28, 0x3F, 0x3F, 0x3F,
+  0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x10, 0x28, 0x3F, 0x27, 0x3F, 0x0F, 0x3F,
+  0x28, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x28, 0x3F, 0x3F, 0x28, 0x3F, 0x27, 0x27,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x02, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x21, 0x3F,
+  0x20, 0x3F, 0x03, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x02,
+  0x12, 0x3F, 0x12, 0x3F, 0x02, 0x3F, 0x02, 0x3F, 0x10, 0x3F, 0x18, 0x3F, 0x3F, 0x18, 0x17, 0x17,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x03, 0x3F, 0x3F, 0x03, 0x14, 0x24, 0x3F, 0x3F, 0x3F,
+  0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x14, 0x24, 0x3F, 0x24, 0x3F, 0x03, 0x3F, 0x24, 0x3F,
+  0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x10, 0x22, 0x3F, 0x20, 0x3F,
+  0x0F, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x28, 0x28, 0x3F, 0x3F, 0x14, 0x3F,
+  0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x23, 0x23, 0x23,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x0F, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x0F, 0x10, 0x28,
+  0x3F, 0x27, 0x3F, 0x0F, 0x3F, 0x28, 0x3F, 0x02, 0x22, 0x3F, 0x22, 0x3F, 0x02, 0x3F, 0x02, 0x3F,
+  0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x28, 0x28, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x02, 0x3F, 0x01, 0x3F, 0x3F, 0x02, 0x00, 0x02, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x28, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x28, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x14, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x10, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x12, 0x12, 0x3F, 0x12, 0x3F, 0x14, 0x3F, 0x02, 0x3F, 0x10, 0x3F, 0x14, 0x3F,
+  0x3F, 0x14, 0x14, 0x14, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x28, 0x3F, 0x27, 0x3F, 0x27, 0x3F,
+  0x28, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x27, 0x10, 0x28, 0x3F, 0x3F, 0x28, 0x3F, 0x27, 0x27,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x12, 0x28, 0x3F, 0x3F, 0x3F, 0x11,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x17, 0x18, 0x28, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x28, 0x3F, 0x3F,
+  0x28, 0x3F, 0x27, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x28,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x12, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x21,
+  0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F,
+  0x3F, 0x10, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x28, 0x3F, 0x01,
+  0x3F, 0x3F, 0x24, 0x10, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x0F, 0x24, 0x3F, 0x26, 0x3F, 0x3F, 0x24, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F,
+  0x26, 0x3F, 0x26, 0x14, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x28, 0x3F, 0x10, 0x3F, 0x08,
+  0x3F, 0x3F, 0x08, 0x10, 0x26, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x06,
+  0x26, 0x3F, 0x06, 0x3F, 0x03, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x26, 0x3F,
+  0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x26, 0x3F, 0x01, 0x3F, 0x3F, 0x05,
+  0x00, 0x26, 0x3F, 0x05, 0x15, 0x3F, 0x05, 0x3F, 0x02, 0x3F, 0x15, 0x3F, 0x15, 0x3F, 0x01, 0x3F,
+  0x3F, 0x05, 0x15, 0x15, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x02, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x10, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x10, 0x28, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x02, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x16, 0x3F, 0x01, 0x3F, 0x3F, 0x03, 0x00, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01,
+  0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x28, 0x3F, 0x01, 0x3F, 0x3F, 0x02, 0x28, 0x28, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x16, 0x16, 0x3F, 0x16, 0x3F, 0x06, 0x3F, 0x16,
+  0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x3F, 0x24, 0x10, 0x26, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x26, 0x3F, 0x26, 0x28, 0x28, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x11, 0x3F,
+  0x3F, 0x3F, 0x26, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x28, 0x3F,
+  0x01, 0x3F, 0x3F, 0x24, 0x00, 0x26, 0x3F, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x14, 0x3F,
+  0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x14, 0x24, 0x3F, 0x3F, 0x01, 0x3F, 0x24, 0x24, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x00, 0x28, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x26, 0x28,
+  0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x03, 0x13, 0x3F, 0x03, 0x3F, 0x02, 0x3F, 0x13, 0x3F, 0x13, 0x3F, 0x01, 0x3F,
+  0x3F, 0x03, 0x13, 0x13, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F,
+  0x18, 0x3F, 0x3F, 0x18, 0x26, 0x26, 0x3F, 0x3F, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x18,
+  0x00, 0x26, 0x3F, 0x00, 0x3F, 0x06, 0x3F, 0x26, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F,
+  0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x28, 0x3F, 0x28, 0x3F,
+  0x3F, 0x24, 0x28, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x28, 0x23,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x28, 0x3F, 0x28, 0x3F,
+  0x3F, 0x28, 0x28, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x28, 0x28,
+  0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x28, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x28, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F,
+  0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x28, 0x3F, 0x28, 0x3F,
+  0x3F, 0x24, 0x28, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F,
+  0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x24, 0x28, 0x28, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x24, 0x28, 0x28, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x28, 0x28, 0x3F, 0x28, 0x3F, 0x28, 0x3F,
+  0x3F, 0x28, 0x28, 0x23, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x28, 0x23,
+  0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x28,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x20, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x20,
+  0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x03,
+  0x3F, 0x3F, 0x24, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x13, 0x14,
+  0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x10, 0x3F,
+  0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24,
+  0x00, 0x24, 0x3F, 0x00, 0x21, 0x3F, 0x24, 0x3F, 0x0F, 0x3F, 0x12, 0x3F, 0x20, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x0F, 0x10, 0x28, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x13,
+  0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F,
+  0x3F, 0x25, 0x3F, 0x0F, 0x21, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x02,
+  0x12, 0x3F, 0x02, 0x3F, 0x02, 0x3F, 0x12, 0x3F, 0x10, 0x3F, 0x01, 0x3F, 0x3F, 0x03, 0x10, 0x13,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x01, 0x3F, 0x3F, 0x02,
+  0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x18, 0x0F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x0F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x28, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x0F, 0x00, 0x24, 0x3F, 0x24, 0x3F, 0x0F, 0x3F, 0x14,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x21, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10,
+  0x28, 0x3F, 0x12, 0x3F, 0x01, 0x3F, 0x3F, 0x02, 0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x28, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x01,
+  0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x00, 0x22, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x12,
+  0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x28, 0x28, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x14, 0x21, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x21, 0x3F, 0x13, 0x3F,
+  0x3F, 0x24, 0x10, 0x13, 0x3F, 0x3F, 0x01, 0x3F, 0x24, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F,
+  0x12, 0x3F, 0x3F, 0x24, 0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x14,
+  0x00, 0x01, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x04, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x28, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x13, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F,
+  0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x18, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x00, 0x28, 0x3F, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x21, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x28, 0x3F, 0x3F, 0x21, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x13, 0x21,
+  0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x12, 0x12, 0x3F, 0x12, 0x3F, 0x02, 0x3F, 0x12, 0x3F, 0x10, 0x3F, 0x18, 0x3F, 0x3F, 0x18, 0x10,
+  0x18, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x22, 0x3F, 0x10, 0x3F, 0x16, 0x3F, 0x24, 0x3F, 0x20,
+  0x3F, 0x18, 0x3F, 0x3F, 0x16, 0x24, 0x24, 0x3F, 0x3F, 0x16, 0x3F, 0x16, 0x16, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x3F, 0x14, 0x24, 0x26, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x24, 0x3F, 0x24, 0x14, 0x26, 0x3F, 0x14, 0x3F, 0x14, 0x3F, 0x26, 0x3F, 0x3F, 0x22, 0x3F, 0x16,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x21, 0x3F, 0x20, 0x3F, 0x06, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x13, 0x20, 0x28, 0x3F,
+  0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x13, 0x28, 0x3F, 0x13, 0x3F, 0x13, 0x3F,
+  0x28, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x25, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x10, 0x28, 0x3F,
+  0x20, 0x3F, 0x16, 0x3F, 0x28, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F,
+  0x28, 0x3F, 0x16, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x10, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x11, 0x21, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x01, 0x26, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x0F, 0x3F, 0x11, 0x3F, 0x01, 0x3F,
+  0x3F, 0x18, 0x0F, 0x0F, 0x3F, 0x3F, 0x26, 0x3F, 0x16, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x3F, 0x13, 0x24,
+  0x24, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x28, 0x14, 0x23, 0x3F, 0x13, 0x3F,
+  0x14, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x10,
+  0x22, 0x3F, 0x22, 0x3F, 0x16, 0x3F, 0x14, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x28, 0x28,
+  0x3F, 0x3F, 0x14, 0x3F, 0x16, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F,
+  0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x23, 0x3F, 0x23, 0x3F,
+  0x3F, 0x23, 0x23, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x22, 0x3F, 0x16, 0x3F, 0x3F, 0x16, 0x22, 0x28, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26,
+  0x3F, 0x26, 0x10, 0x28, 0x3F, 0x10, 0x3F, 0x16, 0x3F, 0x28, 0x3F, 0x01, 0x11, 0x3F, 0x22, 0x3F,
+  0x18, 0x3F, 0x0F, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x0F, 0x0F, 0x3F, 0x3F, 0x01, 0x3F,
+  0x16, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x01, 0x3F, 0x3F, 0x18, 0x0F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x00, 0x26, 0x3F, 0x16, 0x3F, 0x06, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x11, 0x3F, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x21, 0x3F, 0x20, 0x3F, 0x28,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x16,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x08, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x26, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x26, 0x3F,
+  0x20, 0x3F, 0x14, 0x3F, 0x3F, 0x14, 0x14, 0x26, 0x3F, 0x3F, 0x26, 0x3F, 0x18, 0x26, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x28, 0x3F,
+  0x20, 0x3F, 0x16, 0x3F, 0x28, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F,
+  0x28, 0x3F, 0x18, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x12, 0x3F, 0x3F, 0x12, 0x20, 0x26,
+  0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x18, 0x26, 0x3F, 0x18, 0x3F, 0x18,
+  0x3F, 0x26, 0x3F, 0x3F, 0x28, 0x3F, 0x20, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x20,
+  0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x20, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x11, 0x21, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x24, 0x23, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F,
+  0x24, 0x10, 0x23, 0x3F, 0x10, 0x3F, 0x14, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x20, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x20, 0x3F, 0x01, 0x3F,
+  0x3F, 0x14, 0x20, 0x3F, 0x3F, 0x11, 0x22, 0x3F, 0x22, 0x3F, 0x14, 0x3F, 0x24, 0x3F, 0x24, 0x3F,
+  0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x3F, 0x14, 0x3F, 0x14, 0x14, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x13, 0x20, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x28, 0x3F, 0x10, 0x3F, 0x15, 0x3F, 0x28,
+  0x3F, 0x11, 0x23, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x0F, 0x3F, 0x11, 0x3F, 0x01, 0x3F, 0x3F, 0x18,
+  0x0F, 0x0F, 0x3F, 0x3F, 0x23, 0x3F, 0x10, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x01, 0x3F,
+  0x3F, 0x18, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x20, 0x3F,
+  0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x15, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x00, 0x21, 0x3F, 0x20, 0x3F, 0x05, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x24, 0x23, 0x3F, 0x11, 0x3F, 0x3F, 0x13, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x14, 0x24,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x10, 0x11, 0x3F, 0x10, 0x3F, 0x14,
+  0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x11, 0x3F, 0x3F,
+  0x18, 0x10, 0x28, 0x3F, 0x11, 0x3F, 0x01, 0x3F, 0x3F, 0x18, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x28,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x11, 0x23, 0x3F, 0x10, 0x3F, 0x18, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x18, 0x0F, 0x3F, 0x3F, 0x11, 0x11, 0x3F, 0x22, 0x3F, 0x18,
+  0x3F, 0x0F, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x0F, 0x0F, 0x3F, 0x3F, 0x11, 0x3F, 0x10,
+  0x18, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x23, 0x3F, 0x20, 0x3F, 0x14, 0x3F, 0x23, 0x3F, 0x24, 0x3F,
+  0x24, 0x3F, 0x3F, 0x24, 0x24, 0x23, 0x3F, 0x3F, 0x23, 0x3F, 0x18, 0x23, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x12, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x24, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x14, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x21, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x18, 0x23, 0x3F, 0x18, 0x3F, 0x18, 0x3F, 0x23,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x18, 0x20, 0x3F, 0x3F, 0x22, 0x22, 0x3F, 0x22,
+  0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28,
+  0x3F, 0x18, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x13, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x00, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x01, 0x3F, 0x3F,
+  0x18, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x08, 0x3F, 0x18, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x28, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x08, 0x08, 0x3F, 0x28, 0x3F, 0x18, 0x3F, 0x02, 0x3F, 0x28, 0x3F, 0x18, 0x3F,
+  0x3F, 0x18, 0x00, 0x04, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x18, 0x28, 0x3F, 0x18, 0x3F, 0x02, 0x3F,
+  0x28, 0x3F, 0x28, 0x3F, 0x01, 0x3F, 0x3F, 0x03, 0x28, 0x28, 0x3F, 0x3F, 0x28, 0x3F, 0x18, 0x28,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F,
+  0x28, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x28,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21,
+  0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x28, 0x3F, 0x28, 0x3F,
+  0x02, 0x3F, 0x02, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x28, 0x28, 0x3F, 0x3F, 0x01, 0x3F,
+  0x00, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24,
+  0x3F, 0x3F, 0x28, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x21, 0x3F, 0x20, 0x3F, 0x0F,
+  0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x3F,
+  0x3F, 0x23, 0x23, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x23, 0x23,
+  0x3F, 0x23, 0x3F, 0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x00, 0x28, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x0F, 0x28, 0x28, 0x3F, 0x3F, 0x28, 0x3F, 0x00, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F,
+  0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x21, 0x3F, 0x20, 0x3F, 0x28, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x01, 0x3F, 0x00, 0x3F, 0x02, 0x3F, 0x0F,
+  0x3F, 0x28, 0x3F, 0x28, 0x3F, 0x3F, 0x28, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x08, 0x3F, 0x18, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x18, 0x21, 0x3F, 0x20, 0x3F, 0x18, 0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x04,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x28, 0x3F, 0x18, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x18, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x28,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x18, 0x28, 0x3F, 0x18, 0x3F, 0x18,
+  0x3F, 0x28, 0x3F, 0x18, 0x3F, 0x18, 0x3F, 0x3F, 0x18, 0x18, 0x28, 0x3F, 0x3F, 0x28, 0x3F, 0x18,
+  0x28, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x27, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x22, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x22, 0x24, 0x3F,
+  0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x16, 0x24, 0x3F, 0x24, 0x3F, 0x16, 0x3F,
+  0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x27,
+  0x20, 0x3F, 0x3F, 0x10, 0x3F, 0x12, 0x3F, 0x3F, 0x12, 0x17, 0x17, 0x3F, 0x3F, 0x3F, 0x25, 0x3F,
+  0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x16, 0x26, 0x3F, 0x16, 0x3F, 0x16, 0x3F, 0x03, 0x3F, 0x3F, 0x3F,
+  0x11, 0x3F, 0x3F, 0x3F, 0x17, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x26, 0x3F, 0x01, 0x3F, 0x3F, 0x16, 0x00, 0x26, 0x3F, 0x15, 0x15, 0x3F, 0x15, 0x3F, 0x02, 0x3F,
+  0x02, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x05,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F,
+  0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x01, 0x3F,
+  0x3F, 0x16, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16, 0x3F, 0x01, 0x3F, 0x3F, 0x16, 0x00, 0x03,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x22, 0x3F, 0x22, 0x3F,
+  0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16, 0x16,
+  0x3F, 0x16, 0x3F, 0x16, 0x3F, 0x06, 0x3F, 0x24, 0x3F, 0x13, 0x3F, 0x3F, 0x27, 0x26, 0x24, 0x3F,
+  0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x26, 0x26, 0x24, 0x3F, 0x24, 0x3F, 0x27, 0x3F,
+  0x24, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x26, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x20, 0x24, 0x3F, 0x24, 0x24, 0x3F,
+  0x24, 0x3F, 0x02, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x04, 0x24, 0x24, 0x3F, 0x3F,
+  0x24, 0x3F, 0x24, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x27,
+  0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F,
+  0x26, 0x3F, 0x3F, 0x27, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x26,
+  0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x13, 0x13, 0x3F, 0x13, 0x3F, 0x13, 0x3F,
+  0x02, 0x3F, 0x13, 0x3F, 0x13, 0x3F, 0x3F, 0x13, 0x00, 0x03, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x03,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x17, 0x26, 0x3F, 0x3F, 0x3F, 0x11,
+  0x3F, 0x3F, 0x3F, 0x17, 0x3F, 0x17, 0x26, 0x26, 0x3F, 0x26, 0x3F, 0x16, 0x3F, 0x26, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x3F,
+  0x3F, 0x3F, 0x27, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x27, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x27, 0x3F,
+  0x3F, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x27, 0x3F,
+  0x27, 0x3F, 0x3F, 0x27, 0x27, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x0F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x27, 0x27, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F,
+  0x3F, 0x25, 0x3F, 0x25, 0x27, 0x27, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x27, 0x27, 0x3F,
+  0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x27, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x27, 0x24, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x27, 0x24, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x20,
+  0x3F, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x27, 0x23, 0x3F, 0x3F, 0x3F, 0x27, 0x3F, 0x3F,
+  0x3F, 0x27, 0x3F, 0x27, 0x27, 0x23, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x27,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x27, 0x20,
+  0x3F, 0x27, 0x3F, 0x3F, 0x27, 0x20, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x3F, 0x13, 0x12, 0x24, 0x3F, 0x3F, 0x3F, 0x25, 0x3F,
+  0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x04, 0x24, 0x3F, 0x24, 0x3F, 0x03, 0x3F, 0x24, 0x3F, 0x3F, 0x3F,
+  0x25, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x00, 0x24, 0x3F, 0x00, 0x24, 0x3F, 0x20, 0x3F, 0x0F, 0x3F,
+  0x24, 0x3F, 0x25, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x25, 0x24, 0x3F, 0x3F, 0x24, 0x3F, 0x00, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x02, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x27, 0x20, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F,
+  0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x20,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x12, 0x22, 0x3F, 0x22, 0x3F, 0x02, 0x3F, 0x02, 0x3F, 0x25, 0x3F,
+  0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x12, 0x3F, 0x12, 0x3F, 0x3F, 0x12, 0x00, 0x02, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x25, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x03, 0x00, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x0F, 0x22, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x0F, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x24,
+  0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x22, 0x22,
+  0x3F, 0x22, 0x3F, 0x0F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x13, 0x24, 0x3F, 0x20, 0x3F, 0x13, 0x3F,
+  0x24, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x13, 0x13, 0x24, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x12, 0x24, 0x3F, 0x3F, 0x3F, 0x11,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x14, 0x14, 0x24, 0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x24, 0x3F, 0x3F,
+  0x24, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x27,
+  0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x13, 0x20, 0x3F, 0x3F, 0x20,
+  0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x12, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x17, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x20, 0x3F, 0x3F,
+  0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x13, 0x21, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x12, 0x3F, 0x12, 0x3F, 0x12, 0x3F, 0x02, 0x3F, 0x10,
+  0x3F, 0x11, 0x3F, 0x3F, 0x17, 0x17, 0x17, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x25, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x24, 0x26, 0x24, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F,
+  0x3F, 0x26, 0x3F, 0x0F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x26, 0x26, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26,
+  0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x26, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x24, 0x26, 0x24, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x0F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x24, 0x26, 0x24,
+  0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x26, 0x24, 0x3F, 0x24, 0x3F, 0x24,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x20, 0x3F, 0x21, 0x3F, 0x3F,
+  0x3F, 0x20, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F, 0x3F, 0x26,
+  0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F,
+  0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x26, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x03, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F,
+  0x3F, 0x00, 0x3F, 0x0F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x0F, 0x00, 0x24, 0x3F, 0x24, 0x3F, 0x0F, 0x3F, 0x24, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F,
+  0x12, 0x3F, 0x01, 0x3F, 0x3F, 0x02, 0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x25, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x3F,
+  0x3F, 0x12, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x00, 0x01, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x02, 0x3F, 0x25,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x25, 0x25, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00,
+  0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x22, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x22,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F,
+  0x0F, 0x3F, 0x0F, 0x3F, 0x24, 0x3F, 0x03, 0x3F, 0x3F, 0x24, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x13,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x13, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F,
+  0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x14, 0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x00, 0x24, 0x3F, 0x00, 0x24, 0x3F, 0x24, 0x3F, 0x0F,
+  0x3F, 0x24, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x24, 0x3F, 0x3F, 0x24, 0x3F, 0x24,
+  0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x02, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x13, 0x20, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x01, 0x3F, 0x00, 0x3F, 0x02, 0x3F, 0x02, 0x3F, 0x13,
+  0x3F, 0x13, 0x3F, 0x3F, 0x13, 0x13, 0x13, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x12, 0x3F, 0x12, 0x3F, 0x3F, 0x12, 0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F,
+  0x10, 0x3F, 0x1F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x24, 0x24, 0x3F,
+  0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x11, 0x24, 0x3F, 0x10, 0x3F, 0x13, 0x3F,
+  0x24, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x14, 0x00, 0x24, 0x3F, 0x22, 0x24, 0x3F,
+  0x20, 0x3F, 0x16, 0x3F, 0x24, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x24, 0x3F, 0x3F,
+  0x24, 0x3F, 0x14, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x13,
+  0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F,
+  0x16, 0x3F, 0x3F, 0x16, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x25,
+  0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x16, 0x3F, 0x3F, 0x3F, 0x11, 0x11, 0x3F, 0x22, 0x3F, 0x12, 0x3F,
+  0x0F, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x0F, 0x0F, 0x3F, 0x3F, 0x01, 0x3F, 0x16, 0x16,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x00, 0x26, 0x3F, 0x16, 0x3F, 0x16, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x01, 0x3F, 0x15, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x21, 0x3F, 0x20, 0x3F, 0x25, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F,
+  0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x01, 0x3F,
+  0x3F, 0x13, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x0F,
+  0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x00, 0x24, 0x3F, 0x10, 0x3F, 0x16, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x16, 0x20, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F,
+  0x3F, 0x22, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x01,
+  0x3F, 0x16, 0x3F, 0x16, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x3F, 0x16, 0x0F,
+  0x0F, 0x3F, 0x22, 0x22, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x16, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x24, 0x3F,
+  0x20, 0x3F, 0x13, 0x3F, 0x24, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x13, 0x24, 0x24, 0x3F, 0x3F,
+  0x24, 0x3F, 0x13, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x14, 0x24,
+  0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x14, 0x20, 0x24, 0x3F, 0x20, 0x3F, 0x14,
+  0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x3F, 0x14, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x21, 0x3F, 0x20,
+  0x3F, 0x04, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x11, 0x3F, 0x3F, 0x12, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x26,
+  0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x20, 0x3F, 0x11, 0x3F, 0x3F,
+  0x16, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x16, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x26,
+  0x3F, 0x3F, 0x26, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x01, 0x3F, 0x13, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x26, 0x3F, 0x20, 0x3F, 0x12,
+  0x3F, 0x0F, 0x3F, 0x11, 0x3F, 0x11, 0x3F, 0x3F, 0x16, 0x0F, 0x0F, 0x3F, 0x3F, 0x26, 0x3F, 0x16,
+  0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x13, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x24, 0x24, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x11, 0x24, 0x3F, 0x10, 0x3F, 0x14, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x15, 0x20,
+  0x3F, 0x3F, 0x11, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x11, 0x23, 0x3F, 0x10, 0x3F, 0x13, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x11,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x20,
+  0x3F, 0x11, 0x3F, 0x3F, 0x15, 0x0F, 0x3F, 0x3F, 0x00, 0x01, 0x3F, 0x15, 0x3F, 0x15, 0x3F, 0x0F,
+  0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x0F, 0x0F, 0x3F, 0x3F, 0x01, 0x3F, 0x15, 0x15, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x11, 0x3F, 0x3F,
+  0x14, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F,
+  0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x11, 0x3F, 0x3F, 0x13, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x22, 0x3F, 0x22, 0x3F, 0x3F,
+  0x22, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x11, 0x3F,
+  0x10, 0x3F, 0x1F, 0x3F, 0x0F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x24, 0x23, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x20, 0x23, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x23,
+  0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x24, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x14, 0x20, 0x3F, 0x3F, 0x24, 0x24, 0x3F, 0x24,
+  0x3F, 0x14, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x3F, 0x24,
+  0x3F, 0x14, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x13, 0x20,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F, 0x22,
+  0x3F, 0x3F, 0x22, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x3F, 0x20, 0x3F, 0x1F, 0x3F, 0x3F, 0x3F, 0x00, 0x23, 0x3F, 0x13, 0x3F, 0x13, 0x3F, 0x0F,
+  0x3F, 0x00, 0x3F, 0x01, 0x3F, 0x3F, 0x13, 0x0F, 0x0F, 0x3F, 0x3F, 0x23, 0x3F, 0x13, 0x23, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x12, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x24, 0x3F, 0x20, 0x3F, 0x13, 0x3F,
+  0x24, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x24, 0x3F, 0x3F, 0x24, 0x3F, 0x14, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x24, 0x24, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x24, 0x3F, 0x3F,
+  0x24, 0x3F, 0x20, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x13,
+  0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x25, 0x20, 0x3F, 0x3F, 0x20,
+  0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x25, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x3F,
+  0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x22, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x21, 0x3F, 0x20, 0x3F, 0x25, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x01, 0x3F, 0x22, 0x3F, 0x12, 0x3F, 0x0F, 0x3F, 0x25,
+  0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F,
+  0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x24,
+  0x3F, 0x24, 0x3F, 0x03, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24,
+  0x24, 0x3F, 0x22, 0x22, 0x3F, 0x22, 0x3F, 0x0F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x00, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x23, 0x3F, 0x3F, 0x23, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x22, 0x22,
+  0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x0F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F,
+  0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x24, 0x3F, 0x20, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x21, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x24, 0x3F, 0x20, 0x3F, 0x12,
+  0x3F, 0x24, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F, 0x14, 0x14, 0x24, 0x3F, 0x3F, 0x24, 0x3F, 0x14,
+  0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x13, 0x3F, 0x3F, 0x13, 0x20,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x11, 0x3F, 0x3F,
+  0x12, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x1F, 0x20, 0x3F, 0x3F,
+  0x20, 0x3F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x12,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x21, 0x3F, 0x20, 0x3F, 0x1F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x14, 0x22, 0x3F, 0x22, 0x3F, 0x14, 0x3F, 0x14, 0x3F, 0x20, 0x3F, 0x04, 0x3F, 0x3F,
+  0x24, 0x14, 0x26, 0x3F, 0x3F, 0x05, 0x3F, 0x05, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x14,
+  0x3F, 0x3F, 0x24, 0x14, 0x26, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x05,
+  0x26, 0x3F, 0x05, 0x3F, 0x04, 0x3F, 0x26, 0x3F, 0x3F, 0x12, 0x3F, 0x14, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x10, 0x21, 0x3F, 0x20, 0x3F, 0x04, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x05, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x10, 0x23, 0x3F, 0x3F, 0x3F, 0x26, 0x3F,
+  0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x15, 0x15, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x15, 0x3F, 0x3F, 0x3F,
+  0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25,
+  0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x10, 0x21, 0x3F, 0x27, 0x3F, 0x27, 0x3F,
+  0x12, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F, 0x15, 0x3F, 0x27, 0x27,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x21, 0x3F,
+  0x20, 0x3F, 0x0F, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x00,
+  0x26, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x26, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x26,
+  0x3F, 0x3F, 0x26, 0x3F, 0x00, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x14, 0x3F, 0x3F, 0x24, 0x14, 0x23, 0x3F, 0x3F, 0x3F,
+  0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x14, 0x23, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x23, 0x3F,
+  0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x10, 0x11, 0x3F, 0x10, 0x3F,
+  0x02, 0x3F, 0x14, 0x3F, 0x10, 0x3F, 0x01, 0x3F, 0x3F, 0x04, 0x00, 0x14, 0x3F, 0x3F, 0x14, 0x3F,
+  0x14, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x23, 0x23, 0x23,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x16, 0x3F,
+  0x3F, 0x27, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x10, 0x11,
+  0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x16, 0x3F, 0x00, 0x11, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x17, 0x3F,
+  0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x17, 0x3F, 0x3F, 0x16, 0x3F, 0x00, 0x16, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x26, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x00, 0x3F, 0x0F, 0x00, 0x26, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x26, 0x3F, 0x3F, 0x11, 0x3F,
+  0x10, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x17, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x20, 0x21, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x12, 0x26, 0x3F, 0x22, 0x3F, 0x02, 0x3F, 0x26, 0x3F, 0x20, 0x3F, 0x14, 0x3F,
+  0x3F, 0x24, 0x26, 0x26, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x22, 0x3F, 0x27, 0x3F, 0x27, 0x3F,
+  0x12, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x12, 0x3F, 0x3F, 0x27, 0x12, 0x26, 0x3F, 0x3F, 0x3F, 0x26,
+  0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x22, 0x3F, 0x27, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x20, 0x3F, 0x26, 0x3F, 0x26,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x21,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x04, 0x3F, 0x3F,
+  0x24, 0x10, 0x23, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x05, 0x23, 0x3F,
+  0x15, 0x3F, 0x03, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x02, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x20, 0x3F, 0x01, 0x3F, 0x3F, 0x04, 0x20, 0x3F,
+  0x3F, 0x14, 0x22, 0x3F, 0x22, 0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24,
+  0x24, 0x24, 0x3F, 0x3F, 0x15, 0x3F, 0x15, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F,
+  0x01, 0x3F, 0x3F, 0x27, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x0F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x15, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x15, 0x3F, 0x10, 0x23, 0x3F,
+  0x20, 0x3F, 0x0F, 0x3F, 0x23, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x23, 0x3F, 0x3F,
+  0x23, 0x3F, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20,
+  0x3F, 0x0F, 0x3F, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x24, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24,
+  0x23, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x10, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F,
+  0x3F, 0x20, 0x3F, 0x0F, 0x10, 0x3F, 0x14, 0x3F, 0x3F, 0x24, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x10, 0x11, 0x3F, 0x10, 0x3F, 0x14, 0x3F, 0x14, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x11, 0x3F, 0x3F, 0x27, 0x10, 0x17, 0x3F,
+  0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x23, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x00,
+  0x3F, 0x0F, 0x10, 0x23, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x10, 0x11, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x17, 0x3F, 0x10,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x17, 0x3F, 0x3F, 0x11, 0x3F, 0x10, 0x17, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x02, 0x23, 0x3F, 0x22, 0x3F, 0x02, 0x3F, 0x23, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24,
+  0x24, 0x23, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x01, 0x3F,
+  0x3F, 0x02, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x24, 0x0F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x24, 0x21, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x22, 0x22, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20,
+  0x3F, 0x0F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x07, 0x3F, 0x07, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x07, 0x21, 0x3F,
+  0x20, 0x3F, 0x03, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x07,
+  0x07, 0x3F, 0x07, 0x3F, 0x02, 0x3F, 0x07, 0x3F, 0x17, 0x3F, 0x01, 0x3F, 0x3F, 0x04, 0x17, 0x17,
+  0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x17, 0x17, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x17, 0x3F, 0x17, 0x3F,
+  0x01, 0x3F, 0x3F, 0x27, 0x17, 0x17, 0x3F, 0x3F, 0x01, 0x3F, 0x27, 0x27, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x25, 0x25, 0x25, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x17, 0x3F, 0x27, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F,
+  0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x07, 0x17, 0x3F, 0x07, 0x3F, 0x02, 0x3F, 0x17, 0x3F,
+  0x07, 0x3F, 0x01, 0x3F, 0x3F, 0x03, 0x07, 0x17, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x03, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x17, 0x3F,
+  0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x17, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x23, 0x23, 0x23,
+  0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x23, 0x23, 0x3F, 0x23, 0x3F, 0x23,
+  0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x17,
+  0x3F, 0x27, 0x3F, 0x0F, 0x3F, 0x17, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x17, 0x3F,
+  0x3F, 0x17, 0x3F, 0x27, 0x27, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x01, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x02, 0x3F, 0x00, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x0F, 0x00, 0x17, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x17, 0x21,
+  0x3F, 0x20, 0x3F, 0x04, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x27, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x17, 0x21, 0x3F, 0x20, 0x3F, 0x27, 0x3F, 0x17, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x01, 0x3F, 0x27, 0x3F, 0x27, 0x3F, 0x02, 0x3F, 0x17,
+  0x3F, 0x17, 0x3F, 0x3F, 0x27, 0x17, 0x17, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x14,
+  0x3F, 0x3F, 0x24, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x14, 0x05,
+  0x15, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x15, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x10, 0x3F,
+  0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x05, 0x3F, 0x01, 0x3F, 0x3F, 0x24,
+  0x00, 0x26, 0x3F, 0x14, 0x21, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x21, 0x3F, 0x01, 0x3F,
+  0x3F, 0x24, 0x10, 0x14, 0x3F, 0x3F, 0x15, 0x3F, 0x24, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26,
+  0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x00, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F,
+  0x3F, 0x25, 0x3F, 0x0F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F, 0x00,
+  0x12, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x12, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x13,
+  0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F,
+  0x10, 0x26, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x00, 0x26, 0x3F, 0x00,
+  0x3F, 0x0F, 0x3F, 0x26, 0x3F, 0x3F, 0x15, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x05, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x24, 0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x10, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x0F, 0x10, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x10, 0x12, 0x3F, 0x3F,
+  0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x04, 0x10, 0x11, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x14,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x02,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10,
+  0x16, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x10, 0x3F, 0x0F, 0x00, 0x16, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x16, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x00,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x26, 0x3F, 0x10, 0x11, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x12,
+  0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x16, 0x3F, 0x3F, 0x16, 0x3F, 0x00, 0x16, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x02, 0x22, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x21, 0x3F, 0x24, 0x3F,
+  0x3F, 0x24, 0x10, 0x26, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x01, 0x3F, 0x3F, 0x24, 0x12, 0x26, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x14,
+  0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x01, 0x3F, 0x24, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x24, 0x21, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x26, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x12, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x26, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x12, 0x3F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x26, 0x26, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x00, 0x26, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x26, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10,
+  0x26, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x02, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x05, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x00, 0x23,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x24, 0x3F, 0x24, 0x3F,
+  0x3F, 0x24, 0x00, 0x12, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x05, 0x15,
+  0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x00,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x00, 0x15, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x23,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x00, 0x23, 0x3F, 0x00, 0x3F, 0x0F,
+  0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x00, 0x15,
+  0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x15, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x15, 0x3F,
+  0x3F, 0x15, 0x3F, 0x00, 0x15, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F,
+  0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x24, 0x10, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x10, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x10, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x0F, 0x10, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x0F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x10, 0x3F, 0x0F, 0x10, 0x11, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x1F, 0x3F, 0x02, 0x3F, 0x01, 0x3F,
+  0x3F, 0x24, 0x02, 0x23, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x0F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x02,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F,
+  0x3F, 0x3F, 0x00, 0x01, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x02, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F,
+  0x24, 0x24, 0x24, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x0F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x00, 0x23,
+  0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x23, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x23, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x20,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x14,
+  0x21, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x21, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x10, 0x13,
+  0x3F, 0x3F, 0x01, 0x3F, 0x24, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24,
+  0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x14, 0x00, 0x01, 0x3F, 0x24,
+  0x3F, 0x24, 0x3F, 0x04, 0x3F, 0x3F, 0x21, 0x3F, 0x24, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x21,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10,
+  0x3F, 0x13, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F,
+  0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x21, 0x3F, 0x21,
+  0x3F, 0x3F, 0x3F, 0x25, 0x25, 0x3F, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x21,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x15, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x12, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x21, 0x3F, 0x20, 0x3F, 0x0F,
+  0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x12, 0x3F, 0x00,
+  0x3F, 0x0F, 0x3F, 0x12, 0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x15, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x24, 0x3F, 0x01, 0x3F, 0x3F, 0x24, 0x10, 0x12, 0x3F, 0x3F, 0x3F, 0x01, 0x3F, 0x3F,
+  0x3F, 0x10, 0x3F, 0x03, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x14, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x24,
+  0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x10, 0x21, 0x3F, 0x24, 0x3F, 0x0F, 0x3F, 0x12,
+  0x3F, 0x10, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x10, 0x14, 0x3F, 0x3F, 0x14, 0x3F, 0x24, 0x24, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x23, 0x23, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10,
+  0x12, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F, 0x0F, 0x21, 0x21, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x1F, 0x3F, 0x00, 0x12, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x12, 0x3F, 0x10, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x0F, 0x10, 0x13, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x00, 0x12, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x10, 0x3F,
+  0x0F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x12, 0x3F, 0x00, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x10, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x24, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x21,
+  0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x13, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x12, 0x12, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x12, 0x3F, 0x21, 0x3F, 0x14, 0x3F, 0x3F, 0x24, 0x10,
+  0x14, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x21,
+  0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x10, 0x13, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x21, 0x3F, 0x21, 0x3F, 0x3F, 0x3F, 0x12, 0x12, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F, 0x3F,
+  0x10, 0x3F, 0x1F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x21, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x21, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x12, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x21, 0x3F, 0x20, 0x3F,
+  0x0F, 0x3F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x16, 0x22, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x06, 0x21, 0x3F, 0x20, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x03, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x26, 0x26, 0x3F, 0x26, 0x3F, 0x02, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x01, 0x3F,
+  0x3F, 0x04, 0x00, 0x26, 0x3F, 0x3F, 0x26, 0x3F, 0x00, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16, 0x26, 0x3F, 0x16, 0x3F, 0x16, 0x3F,
+  0x26, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F, 0x01, 0x3F, 0x00, 0x03,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x3F, 0x3F, 0x25,
+  0x3F, 0x3F, 0x3F, 0x25, 0x3F, 0x25, 0x25, 0x25, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x25, 0x3F, 0x3F,
+  0x16, 0x3F, 0x16, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x20, 0x3F, 0x26, 0x3F, 0x26,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x05, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x06, 0x26, 0x3F, 0x26, 0x3F,
+  0x02, 0x3F, 0x02, 0x3F, 0x06, 0x3F, 0x01, 0x3F, 0x3F, 0x03, 0x00, 0x03, 0x3F, 0x3F, 0x16, 0x3F,
+  0x16, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x24,
+  0x3F, 0x3F, 0x16, 0x3F, 0x16, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x06, 0x21, 0x3F, 0x20, 0x3F, 0x04,
+  0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x3F,
+  0x3F, 0x23, 0x23, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x23, 0x23,
+  0x3F, 0x23, 0x3F, 0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x16, 0x16, 0x3F, 0x16, 0x3F, 0x16, 0x3F, 0x16, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F,
+  0x26, 0x26, 0x26, 0x3F, 0x3F, 0x16, 0x3F, 0x16, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x01, 0x3F,
+  0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x16, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x26, 0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x00, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x26, 0x3F, 0x00, 0x26, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x3F, 0x00, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x20, 0x3F, 0x04, 0x3F, 0x26, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x01, 0x3F, 0x00, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x26, 0x21, 0x3F, 0x20, 0x3F, 0x26, 0x3F, 0x26,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x26, 0x3F, 0x00, 0x3F, 0x02,
+  0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x26, 0x3F, 0x3F, 0x26, 0x26, 0x26, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21,
+  0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x20, 0x23, 0x3F, 0x20, 0x3F, 0x14, 0x3F, 0x23, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24,
+  0x24, 0x23, 0x3F, 0x3F, 0x23, 0x3F, 0x15, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x24, 0x3F,
+  0x3F, 0x24, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x24, 0x20, 0x3F,
+  0x3F, 0x20, 0x3F, 0x04, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x24, 0x21, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x23, 0x3F, 0x15, 0x3F, 0x15, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20,
+  0x3F, 0x25, 0x3F, 0x3F, 0x25, 0x20, 0x3F, 0x3F, 0x22, 0x22, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x15, 0x3F, 0x15, 0x15, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x20, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x23, 0x3F, 0x3F, 0x3F, 0x24,
+  0x3F, 0x3F, 0x3F, 0x24, 0x3F, 0x24, 0x23, 0x23, 0x3F, 0x23, 0x3F, 0x14, 0x3F, 0x23, 0x3F, 0x3F,
+  0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x24, 0x20, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x20, 0x3F, 0x3F, 0x10, 0x22, 0x3F, 0x22, 0x3F, 0x14,
+  0x3F, 0x14, 0x3F, 0x24, 0x3F, 0x24, 0x3F, 0x3F, 0x24, 0x24, 0x24, 0x3F, 0x3F, 0x11, 0x3F, 0x10,
+  0x14, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x23, 0x3F, 0x3F, 0x23, 0x23, 0x23, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x3F,
+  0x22, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x10, 0x11, 0x3F,
+  0x10, 0x3F, 0x1F, 0x3F, 0x1F, 0x3F, 0x00, 0x23, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x00,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x23, 0x3F, 0x10, 0x23, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x0F, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x11, 0x3F, 0x10,
+  0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x21, 0x3F, 0x20, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x23, 0x3F, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x24, 0x21, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x23, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x20, 0x3F, 0x02, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x24, 0x3F, 0x3F,
+  0x24, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x22, 0x3F, 0x22, 0x3F, 0x22, 0x3F, 0x22,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x22, 0x3F, 0x3F, 0x22, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22,
+  0x3F, 0x22, 0x22, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x22, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x21, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x20, 0x3F, 0x3F,
+  0x20, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F,
+  0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x0F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x0F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x3F, 0x0F,
+  0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x0F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x0F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F,
+  0x3F, 0x3F, 0x3F
+};
+
+#else
+const u16 G_au16AntttCanonicalKeys[ANTTT_CANONICAL_SIZE] =
+{
+  0x0000, 0x0002, 0x0005, 0x0006, 0x0007, 0x0013, 0x0017, 0x0019, 0x002C, 0x0032, 0x0039, 0x003B,
+  0x003D, 0x0046, 0x0049, 0x004B, 0x004C, 0x0053, 0x0057, 0x0059, 0x0065, 0x0068, 0x006A, 0x008C,
+  0x008D, 0x008E, 0x0099, 0x009A, 0x009C, 0x009E, 0x00A0, 0x00A2, 0x00A3, 0x00A5, 0x00A7, 0x00A9,
+  0x00B2, 0x00B5, 0x00B8, 0x00C2, 0x00C8, 0x00CC, 0x00CE, 0x00D2, 0x00D4, 0x00DB, 0x00DC, 0x00E2,
+  0x00E8, 0x00EE, 0x0116, 0x0122, 0x0128, 0x01B2, 0x01B6, 0x01B8, 0x01C4, 0x01C7, 0x01C9, 0x01E7,
+  0x01ED, 0x01F9, 0x01FC, 0x0206, 0x020C, 0x0210, 0x0212, 0x0216, 0x0218, 0x021D, 0x021F, 0x0220,
+  0x0226, 0x022C, 0x0232, 0x023E, 0x024A, 0x0250, 0x0263, 0x0269, 0x026D, 0x026E, 0x0270, 0x0272,
+  0x0274, 0x027D, 0x0280, 0x0283, 0x0289, 0x028C, 0x029E, 0x02A6, 0x02A8, 0x02AC, 0x02AE, 0x02B1,
+  0x02B2, 0x02B3, 0x02B8, 0x02B9, 0x02C2, 0x02C8, 0x02EA, 0x031E, 0x0320, 0x0386, 0x038A, 0x038C,
+  0x03BF, 0x03C0, 0x03C1, 0x0419, 0x041B, 0x0485, 0x0487, 0x04A9, 0x04AB, 0x04B7, 0x04B9, 0x04BB,
+  0x04BD, 0x04CA, 0x04CE, 0x04D0, 0x04FE, 0x0500, 0x0503, 0x0504, 0x0505, 0x056C, 0x056F, 0x0570,
+  0x0571, 0x05A0, 0x05A1, 0x05A3, 0x05A5, 0x05A7, 0x05B5, 0x05B7, 0x05C2, 0x05C5, 0x05C7, 0x05C8,
+  0x05D8, 0x05DC, 0x05DE, 0x05E2, 0x05E4, 0x05EB, 0x05EC, 0x05F2, 0x05F8, 0x05FE, 0x0608, 0x0615,
+  0x0616, 0x0618, 0x061A, 0x061C, 0x062F, 0x0635, 0x063C, 0x063E, 0x0649, 0x064E, 0x064F, 0x0657,
+  0x0658, 0x065E, 0x0664, 0x066A, 0x0678, 0x067A, 0x067D, 0x067E, 0x067F, 0x0684, 0x0685, 0x068E,
+  0x0694, 0x06C2, 0x06C6, 0x06C8, 0x06D2, 0x06D4, 0x06D7, 0x06D8, 0x06D9, 0x0764, 0x0767, 0x0768,
+  0x0769, 0x0774, 0x0775, 0x0777, 0x0779, 0x077B, 0x0799, 0x079B, 0x079C, 0x07A2, 0x07A8, 0x07AE,
+  0x07B6, 0x07B8, 0x07BC, 0x07BE, 0x07C1, 0x07C2, 0x07C3, 0x07C8, 0x07C9, 0x07D2, 0x07D8, 0x07EA,
+  0x07EC, 0x07EE, 0x07F0, 0x07F9, 0x07FC, 0x07FE, 0x07FF, 0x0809, 0x080F, 0x0813, 0x0815, 0x0819,
+  0x081B, 0x0820, 0x0822, 0x0823, 0x0829, 0x082F, 0x0835, 0x083E, 0x0844, 0x0858, 0x0859, 0x085E,
+  0x085F, 0x0861, 0x0863, 0x0865, 0x086B, 0x1004, 0x1119, 0x111B, 0x1126, 0x112C, 0x113C, 0x1140,
+  0x1142, 0x114F, 0x1150, 0x1156, 0x115C, 0x1162, 0x116C, 0x117E, 0x1193, 0x11A0, 0x11A2, 0x11AD,
+  0x11B2, 0x11B3, 0x11BB, 0x11BC, 0x11C2, 0x11C8, 0x11CE, 0x11DC, 0x11DE, 0x11E1, 0x11E2, 0x11E3,
+  0x11F2, 0x11F8, 0x122A, 0x122C, 0x1238, 0x123B, 0x123D, 0x12CB, 0x12CC, 0x12CD, 0x12D9, 0x12DD,
+  0x12DF, 0x12FD, 0x1300, 0x1312, 0x131A, 0x131C, 0x1320, 0x1322, 0x1325, 0x1326, 0x1327, 0x132C,
+  0x132D, 0x1336, 0x133C, 0x134E, 0x1354, 0x1360, 0x1363, 0x136D, 0x1373, 0x1377, 0x1379, 0x137D,
+  0x137F, 0x1386, 0x1387, 0x138D, 0x1393, 0x1399, 0x13A2, 0x13BC, 0x13BD, 0x13C2, 0x13C3, 0x13C5,
+  0x13C7, 0x13C9, 0x13CF, 0x1433, 0x149F, 0x14D3, 0x14D5, 0x14F9, 0x14FB, 0x151D, 0x151F, 0x152B,
+  0x152D, 0x152F, 0x1531, 0x1580, 0x1582, 0x1589, 0x158B, 0x1597, 0x159B, 0x159D, 0x15B0, 0x15B6,
+  0x15BD, 0x15BF, 0x15C1, 0x15C8, 0x15CA, 0x15CD, 0x15CF, 0x15D0, 0x15E0, 0x15E3, 0x15E5, 0x1617,
+  0x1619, 0x161B, 0x1681, 0x1683, 0x1685, 0x1687, 0x16A0, 0x16B9, 0x16CB, 0x16CC, 0x16D2, 0x16D8,
+  0x16DE, 0x16EC, 0x16EE, 0x16F1, 0x16F2, 0x16F3, 0x1702, 0x1708, 0x171C, 0x171E, 0x1729, 0x172E,
+  0x172F, 0x173F, 0x1743, 0x1745, 0x1752, 0x1753, 0x1759, 0x175F, 0x1765, 0x176E, 0x1774, 0x178E,
+  0x178F, 0x1791, 0x1793, 0x1795, 0x17DB, 0x17DD, 0x17E9, 0x17EB, 0x17ED, 0x17EF, 0x1879, 0x187B,
+  0x187D, 0x187F, 0x1888, 0x188B, 0x188D, 0x188E, 0x18B2, 0x18B8, 0x18D2, 0x18D3, 0x18D5, 0x18D7,
+  0x18D9, 0x18DF, 0x1902, 0x1903, 0x1909, 0x190F, 0x1915, 0x1923, 0x1925, 0x1928, 0x1929, 0x192A,
+  0x192F, 0x1930, 0x1939, 0x193F, 0x1975, 0x1977, 0x1F48, 0x2FBC, 0x305E, 0x3343, 0x3349, 0x3355,
+  0x3358, 0x3362, 0x3368, 0x336C, 0x336E, 0x3372, 0x3374, 0x337C, 0x338E, 0x339A, 0x33A6, 0x33AC,
+  0x33BF, 0x33C5, 0x33D0, 0x33DC, 0x33DF, 0x33E5, 0x33E8, 0x33FA, 0x3402, 0x3404, 0x3408, 0x340A,
+  0x340D, 0x340E, 0x340F, 0x3414, 0x3415, 0x341E, 0x3469, 0x34F9, 0x3505, 0x350B, 0x3529, 0x352C,
+  0x353E, 0x3546, 0x3548, 0x354C, 0x354E, 0x3551, 0x3552, 0x3553, 0x3558, 0x3559, 0x3562, 0x357A,
+  0x3580, 0x358C, 0x358F, 0x3599, 0x359F, 0x35A3, 0x35A5, 0x35A9, 0x35AB, 0x35B0, 0x35B3, 0x35C5,
+  0x35CE, 0x35E8, 0x35E9, 0x35EE, 0x35EF, 0x35F1, 0x35F3, 0x35F5, 0x35FB, 0x3626, 0x362C, 0x365F,
+  0x3661, 0x36C8, 0x36CB, 0x36CD, 0x36FF, 0x3701, 0x3703, 0x3725, 0x3727, 0x3749, 0x3757, 0x375B,
+  0x375D, 0x37AC, 0x37AE, 0x37B5, 0x37C3, 0x37C7, 0x37C9, 0x37DC, 0x37E2, 0x37EB, 0x37F4, 0x37F6,
+  0x37F9, 0x37FC, 0x380F, 0x3811, 0x3841, 0x3843, 0x3845, 0x3847, 0x38AD, 0x38AF, 0x38B1, 0x38B3,
+  0x38CC, 0x38E3, 0x38E5, 0x38F7, 0x38F8, 0x38FE, 0x3904, 0x390A, 0x3918, 0x391A, 0x391D, 0x391E,
+  0x391F, 0x3924, 0x3925, 0x392E, 0x3934, 0x3948, 0x394A, 0x3955, 0x3958, 0x395B, 0x396B, 0x396F,
+  0x3971, 0x3975, 0x3977, 0x397E, 0x397F, 0x3985, 0x398B, 0x3991, 0x399A, 0x39A0, 0x39BA, 0x39BB,
+  0x39BD, 0x39BF, 0x39C1, 0x39C7, 0x3A07, 0x3A09, 0x3A15, 0x3A19, 0x3A1B, 0x3AA5, 0x3AA7, 0x3AA9,
+  0x3AAB, 0x3AB4, 0x3AB7, 0x3ABA, 0x3ADE, 0x3AF8, 0x3AF9, 0x3AFE, 0x3AFF, 0x3B01, 0x3B03, 0x3B05,
+  0x3B0B, 0x3B2C, 0x3B2F, 0x3B41, 0x3B49, 0x3B4B, 0x3B4F, 0x3B51, 0x3B54, 0x3B55, 0x3B56, 0x3B5B,
+  0x3B5C, 0x3B65, 0x3B6B, 0x3B9B, 0x3BA1, 0x3BA3, 0x42A4, 0x4346, 0x445C, 0x446E, 0x447C, 0x447E,
+  0x4481, 0x4482, 0x4483, 0x4492, 0x44BF, 0x44CF, 0x44D3, 0x44D5, 0x44E3, 0x44F5, 0x44FE, 0x451E,
+  0x451F, 0x4521, 0x4523, 0x4525, 0x456D, 0x4579, 0x457F, 0x4609, 0x460F, 0x461B, 0x461E, 0x4642,
+  0x465C, 0x465D, 0x4662, 0x4663, 0x4665, 0x4667, 0x4669, 0x466F, 0x4690, 0x4693, 0x46A5, 0x46AD,
+  0x46AF, 0x46B3, 0x46B5, 0x46B8, 0x46B9, 0x46BA, 0x46BF, 0x46C0, 0x46C9, 0x46FF, 0x4705, 0x4707,
+  0x473F, 0x4773, 0x4775, 0x47DF, 0x47E1, 0x4815, 0x483D, 0x4850, 0x4856, 0x485F, 0x4868, 0x486A,
+  0x4870, 0x488E, 0x48B0, 0x48C2, 0x48C4, 0x48D6, 0x48DC, 0x48E6, 0x48F2, 0x48F6, 0x48F8, 0x4900,
+  0x4906, 0x490A, 0x490C, 0x4912, 0x4921, 0x4923, 0x4925, 0x4927, 0x4940, 0x4959, 0x49C3, 0x49C5,
+  0x49E0, 0x49E2, 0x4A0E, 0x4A14, 0x4A2E, 0x4A2F, 0x4A31, 0x4A33, 0x4A35, 0x4A5E, 0x4A5F, 0x4A65,
+  0x4A6B, 0x4A71, 0x4A7F, 0x4A81, 0x4A84, 0x4A85, 0x4A86, 0x4A95, 0x4A9B, 0x4AD1, 0x4AD3, 0x4B19,
+  0x4B1B, 0x4B1D, 0x4B1F, 0x4B28, 0x4B2B, 0x4B2E, 0x4BBB, 0x4BBD, 0x4BBE, 0x4BC4, 0x4BCA, 0x4BD0,
+  0x4C15, 0x4C17, 0x4C45, 0x4C65, 0x4C66, 0x4C68, 0x4C6A, 0x4C6C, 0x4C72
+};
+
+const u8 G_au8AntttCanonicalTable[ANTTT_CANONICAL_SIZE] =
+{
+  0x10, 0x14, 0x13, 0x10, 0x23, 0x23, 0x14, 0x23, 0x24, 0x24, 0x20, 0x06, 0x14, 0x24, 0x14, 0x14,
+  0x24, 0x11, 0x20, 0x12, 0x11, 0x27, 0x28, 0x27, 0x10, 0x28, 0x10, 0x28, 0x27, 0x27, 0x28, 0x10,
+  0x11, 0x10, 0x08, 0x17, 0x17, 0x16, 0x16, 0x18, 0x18, 0x17, 0x05, 0x16, 0x05, 0x05, 0x22, 0x21,
+  0x05, 0x05, 0x24, 0x24, 0x0F, 0x08, 0x07, 0x02, 0x01, 0x06, 0x26, 0x22, 0x26, 0x08, 0x08, 0x12,
+  0x11, 0x26, 0x14, 0x28, 0x18, 0x24, 0x24, 0x22, 0x21, 0x24, 0x04, 0x28, 0x28, 0x28, 0x26, 0x27,
+  0x20, 0x28, 0x27, 0x27, 0x28, 0x26, 0x28, 0x27, 0x13, 0x22, 0x03, 0x20, 0x18, 0x20, 0x18, 0x18,
+  0x17, 0x26, 0x00, 0x26, 0x0F, 0x0F, 0x24, 0x24, 0x24, 0x28, 0x17, 0x03, 0x05, 0x00, 0x05, 0x27,
+  0x28, 0x18, 0x23, 0x28, 0x17, 0x11, 0x10, 0x18, 0x17, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
+  0x24, 0x01, 0x03, 0x00, 0x23, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x20, 0x03, 0x28, 0x04, 0x14, 0x24,
+  0x25, 0x25, 0x25, 0x24, 0x24, 0x20, 0x22, 0x21, 0x28, 0x24, 0x27, 0x11, 0x28, 0x27, 0x27, 0x28,
+  0x25, 0x25, 0x27, 0x0F, 0x28, 0x27, 0x27, 0x02, 0x22, 0x21, 0x17, 0x0F, 0x10, 0x18, 0x18, 0x17,
+  0x17, 0x0F, 0x0F, 0x22, 0x21, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x01, 0x02, 0x00,
+  0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x12, 0x14, 0x22, 0x21, 0x14, 0x03, 0x12, 0x14, 0x10, 0x14,
+  0x14, 0x14, 0x14, 0x00, 0x04, 0x22, 0x21, 0x28, 0x27, 0x27, 0x28, 0x28, 0x28, 0x27, 0x27, 0x27,
+  0x11, 0x10, 0x17, 0x27, 0x27, 0x28, 0x27, 0x22, 0x21, 0x28, 0x27, 0x22, 0x21, 0x12, 0x22, 0x10,
+  0x21, 0x20, 0x18, 0x17, 0x0F, 0x0F, 0x10, 0x16, 0x24, 0x16, 0x24, 0x24, 0x24, 0x16, 0x22, 0x21,
+  0x24, 0x04, 0x13, 0x13, 0x25, 0x20, 0x16, 0x26, 0x16, 0x28, 0x10, 0x22, 0x21, 0x0F, 0x16, 0x11,
+  0x01, 0x18, 0x0F, 0x0F, 0x22, 0x21, 0x24, 0x24, 0x24, 0x24, 0x24, 0x18, 0x0F, 0x0F, 0x26, 0x06,
+  0x0F, 0x22, 0x22, 0x08, 0x20, 0x18, 0x20, 0x14, 0x14, 0x14, 0x26, 0x18, 0x26, 0x22, 0x21, 0x28,
+  0x28, 0x28, 0x28, 0x12, 0x26, 0x26, 0x26, 0x18, 0x18, 0x20, 0x22, 0x21, 0x26, 0x28, 0x22, 0x20,
+  0x22, 0x11, 0x21, 0x20, 0x18, 0x0F, 0x26, 0x24, 0x18, 0x20, 0x05, 0x13, 0x23, 0x22, 0x24, 0x11,
+  0x10, 0x14, 0x14, 0x18, 0x28, 0x18, 0x0F, 0x23, 0x18, 0x0F, 0x0F, 0x18, 0x22, 0x18, 0x0F, 0x28,
+  0x0F, 0x11, 0x10, 0x18, 0x24, 0x24, 0x23, 0x20, 0x24, 0x24, 0x21, 0x20, 0x03, 0x0F, 0x18, 0x0F,
+  0x18, 0x22, 0x21, 0x03, 0x03, 0x28, 0x18, 0x18, 0x00, 0x04, 0x22, 0x21, 0x18, 0x02, 0x28, 0x18,
+  0x28, 0x25, 0x25, 0x25, 0x00, 0x22, 0x21, 0x28, 0x28, 0x22, 0x21, 0x00, 0x21, 0x20, 0x18, 0x0F,
+  0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x01, 0x00, 0x02, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x22, 0x21,
+  0x18, 0x21, 0x20, 0x18, 0x04, 0x04, 0x18, 0x22, 0x21, 0x28, 0x28, 0x18, 0x18, 0x18, 0x18, 0x28,
+  0x18, 0x28, 0x22, 0x21, 0x21, 0x20, 0x0F, 0x24, 0x0F, 0x22, 0x14, 0x05, 0x05, 0x24, 0x24, 0x24,
+  0x24, 0x05, 0x04, 0x22, 0x05, 0x23, 0x15, 0x15, 0x25, 0x25, 0x12, 0x15, 0x27, 0x12, 0x22, 0x03,
+  0x20, 0x0F, 0x20, 0x0F, 0x0F, 0x00, 0x26, 0x00, 0x26, 0x22, 0x24, 0x26, 0x26, 0x26, 0x22, 0x22,
+  0x0F, 0x22, 0x02, 0x20, 0x14, 0x24, 0x26, 0x26, 0x0F, 0x0F, 0x22, 0x22, 0x12, 0x0F, 0x0F, 0x27,
+  0x26, 0x26, 0x26, 0x0F, 0x0F, 0x22, 0x22, 0x0F, 0x22, 0x00, 0x22, 0x20, 0x21, 0x20, 0x0F, 0x26,
+  0x0F, 0x24, 0x24, 0x24, 0x24, 0x0F, 0x0F, 0x23, 0x20, 0x0F, 0x05, 0x24, 0x23, 0x24, 0x11, 0x14,
+  0x14, 0x27, 0x17, 0x0F, 0x23, 0x0F, 0x23, 0x0F, 0x0F, 0x0F, 0x0F, 0x17, 0x11, 0x17, 0x24, 0x23,
+  0x21, 0x20, 0x24, 0x24, 0x21, 0x20, 0x0F, 0x23, 0x0F, 0x0F, 0x0F, 0x07, 0x22, 0x21, 0x17, 0x03,
+  0x17, 0x01, 0x04, 0x17, 0x17, 0x00, 0x04, 0x22, 0x21, 0x27, 0x27, 0x17, 0x01, 0x27, 0x25, 0x25,
+  0x25, 0x25, 0x25, 0x27, 0x22, 0x21, 0x17, 0x27, 0x22, 0x21, 0x00, 0x21, 0x20, 0x0F, 0x17, 0x0F,
+  0x24, 0x24, 0x24, 0x24, 0x24, 0x01, 0x00, 0x0F, 0x02, 0x17, 0x0F, 0x0F, 0x22, 0x00, 0x22, 0x17,
+  0x21, 0x20, 0x04, 0x17, 0x0F, 0x01, 0x22, 0x0F, 0x27, 0x27, 0x17, 0x17, 0x27, 0x17, 0x17, 0x0F,
+  0x0F, 0x22, 0x21, 0x22, 0x21, 0x20, 0x24, 0x0F, 0x22, 0x03, 0x26, 0x01, 0x04, 0x00, 0x26, 0x22,
+  0x03, 0x25, 0x25, 0x25, 0x22, 0x05, 0x22, 0x00, 0x21, 0x20, 0x0F, 0x0F, 0x24, 0x24, 0x24, 0x26,
+  0x0F, 0x26, 0x26, 0x22, 0x00, 0x22, 0x26, 0x21, 0x20, 0x04, 0x26, 0x0F, 0x01, 0x22, 0x0F, 0x00,
+  0x02, 0x26, 0x26, 0x26, 0x26, 0x26, 0x0F, 0x0F, 0x22, 0x22, 0x21, 0x20, 0x24, 0x20, 0x24, 0x20,
+  0x0F, 0x20, 0x23, 0x24, 0x24, 0x14, 0x24, 0x24, 0x14, 0x23, 0x22, 0x1F, 0x1F, 0x0F, 0x23, 0x0F,
+  0x0F, 0x20, 0x0F, 0x22, 0x21, 0x0F, 0x0F, 0x1F, 0x21, 0x20, 0x24, 0x23, 0x24, 0x20, 0x21, 0x20,
+  0x20, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F,
+  0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F
+};
+
+#endif /* ANTTT_TABLE_FULL */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File                                                                                                        */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -28,6 +28,23 @@ u32 Main_u32ErrorCode;
 
 u8 Main_u8TestMessage[] = "9876 test message from ANT";
 
+/* Task table: every module's initialization and state machine, how often it runs, in what order and how many cycles
+a run may take.  A task that can tell how long it has nothing to do gives pfnMsToNext so SystemSleep() can sleep
+through the ticks it does not need.  A new module only adds its row here. */
+static const MainTaskType Main_asTasks[] =
+{
+  /* pfnInitialize      pfnRun               Ms Pri u32BudgetCycles           u8Load             pfnMsToNext */
+  {AntttLoadInitialize, AntttLoadTick,       1, 0,  MAIN_LOAD_BUDGET_CYCLES,  ANTTT_LOAD_SYSTEM, AntttLoadMsToNext},
+  {LedInitialize,       LedUpdate,           1, 1,  MAIN_LED_BUDGET_CYCLES,   ANTTT_LOAD_LEDS,   LedMsToNextEdge},
+  //{AntInitialize,     AntRunActiveState,   1, 2,  MAIN_ANT_BUDGET_CYCLES,   ANTTT_LOAD_ANT,    NULL},
+  {AntttInitialize,     AntttRunActiveState, 1, 3,  MAIN_ANTTT_BUDGET_CYCLES, ANTTT_LOAD_GAME,   AntttMsToNextRun},
+};
+
+#define MAIN_TASKS   (u8)(sizeof(Main_asTasks) / sizeof(MainTaskType))
+
+static MainTaskStatsType Main_asTaskStats[MAIN_TASKS];  /* Run time of each task (MainGetTaskStats()) */
+static u8 Main_au8TaskOrder[MAIN_TASKS];                /* Task indexes sorted by priority */
+
 /***********************************************************************************************************************
 Main Program
 Main has two sections:
@@ -54,12 +71,8 @@ void main(void)
   WatchDogSetup(); /* During development, set to not reset processor if timeout */
   SysTickSetup();
 
-  /* Driver initialization */
-  LedInitialize();
-  //AntInitialize();
-
-  /* Application initialization */
-  AntttInitialize();
+  /* Driver and application initialization */
+  MainSchedulerInitialize();
   
   /* Exit initialization */
   G_u32SystemFlags &= ~_SYSTEM_INITIALIZING;
@@ -68,8 +81,7 @@ void main(void)
   /* Main loop */  
   while(1)
   {
-    LedUpdate();
-    
+    MainRunTasks();
         
     /* System sleep*/
     SystemSleep();
@@ -79,6 +91,185 @@ void main(void)
 } /* end main() */
 
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MainGetTaskStats
+
+Description:
+Returns what the scheduler has recorded about one task.
+
+Requires:
+  - u8Task_ is the task's row in Main_asTasks
+
+Promises:
+  - Returns a pointer to the task's statistics (read-only), or NULL if there is no such task
+*/
+const MainTaskStatsType* MainGetTaskStats(u8 u8Task_)
+{
+  if(u8Task_ >= MAIN_TASKS)
+  {
+    return(NULL);
+  }
+  
+  return(&Main_asTaskStats[u8Task_]);
+
+} /* end MainGetTaskStats() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MainMsToNextTask
+
+Description:
+Reports how many ticks can pass before any task needs to run: each task's pfnMsToNext if it has one, otherwise the
+time to its next due run.  SystemSleep() sleeps through that many ticks.
+
+Requires:
+  - Called after MainRunTasks() in the same pass
+
+Promises:
+  - Returns the ms from now (G_u32SystemTime1ms) that can pass with no task due; 0 if one is due on the next tick
+*/
+u32 MainMsToNextTask(void)
+{
+  u8 u8Task;
+  u32 u32Wait;
+  u32 u32Sleep = 0xFFFFFFFF;
+  s32 s32Due;
+  const MainTaskType* psTask = &Main_asTasks[0];
+
+  for(u8Task = 0; u8Task < MAIN_TASKS; u8Task++, psTask++)
+  {
+    if(psTask->pfnMsToNext != NULL)
+    {
+      u32Wait = psTask->pfnMsToNext();
+    }
+    else
+    {
+      s32Due = (s32)(Main_asTaskStats[u8Task].u32NextRunMs - G_u32SystemTime1ms) - 1;
+      u32Wait = (s32Due > 0) ? (u32)s32Due : 0;
+    }
+
+    if(u32Wait < u32Sleep)
+    {
+      u32Sleep = u32Wait;
+    }
+  }
+
+  return(u32Sleep);
+
+} /* end MainMsToNextTask() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MainSchedulerInitialize
+
+Description:
+Initializes every task in the table in priority order and makes them all due on the first pass.
+
+Requires:
+  - Low level initialization is done (the tick is running)
+
+Promises:
+  - Main_au8TaskOrder lists the tasks by priority (table order for equal priorities)
+  - Each task's pfnInitialize has been called
+*/
+void MainSchedulerInitialize(void)
+{
+  u8 u8Index;
+  u8 u8Insert;
+  
+  /* Insertion sort of the task indexes: the table is a handful of entries */
+  for(u8Index = 0; u8Index < MAIN_TASKS; u8Index++)
+  {
+    u8Insert = u8Index;
+    while( (u8Insert > 0) && 
+           (Main_asTasks[Main_au8TaskOrder[u8Insert - 1]].u8Priority > Main_asTasks[u8Index].u8Priority) )
+    {
+      Main_au8TaskOrder[u8Insert] = Main_au8TaskOrder[u8Insert - 1];
+      u8Insert--;
+    }
+    Main_au8TaskOrder[u8Insert] = u8Index;
+  }
+  
+  for(u8Index = 0; u8Index < MAIN_TASKS; u8Index++)
+  {
+    if(Main_asTasks[Main_au8TaskOrder[u8Index]].pfnInitialize != NULL)
+    {
+      Main_asTasks[Main_au8TaskOrder[u8Index]].pfnInitialize();
+    }
+    Main_asTaskStats[Main_au8TaskOrder[u8Index]].u32NextRunMs = G_u32SystemTime1ms;
+  }
+
+} /* end MainSchedulerInitialize() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: MainRunTasks
+
+Description:
+One pass of the scheduler: runs each task that is due, in priority order, and times it with TIMER1
+(SystemCyclesSince(), which reads the ms count and the cycle capture as one pair so a tick between them cannot
+wrap the result).  The time is charged to the task's subsystem in anttt_load.c.  A run that takes longer than its
+budget is counted and flagged with _SYSTEM_TASK_OVERRUN.  A task that has fallen more than a period behind is not
+run repeatedly to catch up; it is next due one period from now.
+
+Requires:
+  - MainSchedulerInitialize() has run
+
+Promises:
+  - Every due task has run once and its statistics and next due time are updated
+*/
+void MainRunTasks(void)
+{
+  u8 u8Index;
+  u8 u8Task;
+  u32 u32StartMs;
+  u32 u32StartCycle;
+  u32 u32Cycles;
+  const MainTaskType* psTask;
+  MainTaskStatsType* psStats;
+  
+  for(u8Index = 0; u8Index < MAIN_TASKS; u8Index++)
+  {
+    u8Task  = Main_au8TaskOrder[u8Index];
+    psTask  = &Main_asTasks[u8Task];
+    psStats = &Main_asTaskStats[u8Task];
+    
+    if( (s32)(G_u32SystemTime1ms - psStats->u32NextRunMs) < 0 )
+    {
+      continue;
+    }
+    
+    SystemTimeCapture(&u32StartMs, &u32StartCycle);
+    psTask->pfnRun();
+    u32Cycles = SystemCyclesSince(u32StartMs, u32StartCycle);
+    
+    AntttLoadAdd( (AntttLoadSubsystemType)psTask->u8Load, u32Cycles );
+    psStats->u32Runs++;
+    psStats->u32LastCycles = u32Cycles;
+    if(u32Cycles > psStats->u32WorstCycles)
+    {
+      psStats->u32WorstCycles = u32Cycles;
+    }
+    if(u32Cycles > psTask->u32BudgetCycles)
+    {
+      psStats->u32Overruns++;
+      G_u32SystemFlags |= _SYSTEM_TASK_OVERRUN;
+    }
+    
+    psStats->u32NextRunMs += psTask->u16PeriodMs;
+    if( (s32)(G_u32SystemTime1ms - psStats->u32NextRunMs) >= 0 )
+    {
+      psStats->u32NextRunMs = G_u32SystemTime1ms + psTask->u16PeriodMs;
+    }
+  }
+
+} /* end MainRunTasks() */
+
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* End of File */
 /*--------------------------------------------------------------------------------------------------------------------*/
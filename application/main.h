@@ -17,11 +17,43 @@ Header file for main.c.
 #define FIRMWARE_SUB_REV2               '1'
 
 
+/***********************************************************************************************************************
+* Type Definitions
+***********************************************************************************************************************/
+/* How many ms a task can go without running (MainTaskType pfnMsToNext) */
+typedef u32(*fnMsToNext_type)(void);
+
+/* One entry of the task table (Main_asTasks in main.c) */
+typedef struct
+{
+  fnCode_type pfnInitialize;    /* Called once at start-up (NULL for none) */
+  fnCode_type pfnRun;           /* Module state machine, called each time the task is due */
+  u16 u16PeriodMs;              /* The task is due every u16PeriodMs ticks */
+  u8 u8Priority;                /* Due tasks run in priority order, 0 first */
+  u32 u32BudgetCycles;          /* Longest a run may take before it counts as an overrun */
+  u8 u8Load;                    /* AntttLoadSubsystemType its run time is charged to */
+  fnMsToNext_type pfnMsToNext;  /* NULL, or the ms the task can be left for, used instead of the period for sleep */
+} MainTaskType;
+
+/* What the scheduler records about each task */
+typedef struct
+{
+  u32 u32NextRunMs;             /* G_u32SystemTime1ms when the task is next due */
+  u32 u32Runs;                  /* Times the task has run */
+  u32 u32LastCycles;            /* Cycles taken by the last run */
+  u32 u32WorstCycles;           /* Longest run */
+  u32 u32Overruns;              /* Runs longer than u32BudgetCycles */
+} MainTaskStatsType;
+
+
 /***********************************************************************************************************************
 * Constant Definitions
 ***********************************************************************************************************************/
 /* G_u32SystemFlags */
 #define _SYSTEM_HFCLK_NO_START          0x00000001        /* Set if the main oscilator does not start as expected */
+#define _SYSTEM_TASK_OVERRUN            0x00000100        /* Set when a task runs past its cycle budget (cleared by the reader) */
+#define _SYSTEM_LOOP_OVERRUN            0x00000200        /* Set when a main loop pass runs past its tick (cleared by the reader) */
+#define _SYSTEM_WAKE_LATE               0x00000400        /* Set when the loop wakes late after a tick (cleared by the reader) */
 
 #define _SYSTEM_ANT_EVENT               0x00010000        /* Set when at least one Soft Device event needs to be processed */
 
@@ -31,9 +63,25 @@ Header file for main.c.
 
 #define M3_MESSAGE_PERIOD               (u32)1000         /* Time in ms between polls to M3 processor */
 
+/* Task cycle budgets (16 cycles per us).  The game's budget is its search slice plus the rest of its pass. */
+#define MAIN_LED_BUDGET_CYCLES          (u32)3200                                     /* 200us */
+#define MAIN_ANTTT_BUDGET_CYCLES        (u32)((ANTTT_SEARCH_BUDGET_US + 100) * 16)    /* 400us */
+#define MAIN_LOAD_BUDGET_CYCLES         (u32)800                                      /* 50us */
+
 /***********************************************************************************************************************
 * Function Declarations
 ***********************************************************************************************************************/
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Public functions                                                                                                   */
+/*--------------------------------------------------------------------------------------------------------------------*/
+const MainTaskStatsType* MainGetTaskStats(u8 u8Task_);
+u32 MainMsToNextTask(void);
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions                                                                                                  */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void MainSchedulerInitialize(void);
+void MainRunTasks(void);
 
 
 #endif /* __MAIN_H */
\ No newline at end of file
@@ -15,17 +15,23 @@ typedef char CHAR;              /* Signed 8-bits */
 typedef unsigned char UCHAR;    /* Unsigned 8-bits */
 typedef short SHORT;            /* Signed 16-bits */
 typedef unsigned short USHORT;  /* Unsigned 16-bits */
+#ifdef __LP64__
+/* Host builds on 64-bit Linux: long is 64 bits there, so use int to keep 32-bit types */
+typedef int LONG;               /* Signed 32-bits */
+typedef unsigned int ULONG;     /* Unsigned 32-bits */
+#else
 typedef long LONG;              /* Signed 32-bits */
 typedef unsigned long ULONG;    /* Unsigned 32-bits */
+#endif
 typedef unsigned char BOOL;     /* Boolean */
 
 
 /* Standard Peripheral Library old types (maintained for legacy purpose) */
-typedef long s32;
+typedef LONG s32;
 typedef short s16;
 typedef signed char  s8;
 
-typedef const long sc32;  /*!< Read Only */
+typedef const LONG sc32;  /*!< Read Only */
 typedef const short sc16;  /*!< Read Only */
 typedef const char sc8;   /*!< Read Only */
 
@@ -24,6 +24,39 @@ extern volatile u32 G_u32SystemFlags;                 /* From main.c */
 Global variable definitions with scope limited to this local application.
 Variable names shall start with "Anttt_" and be declared as static.
 ***********************************************************************************************************************/
+static SystemIdleStatsType Anttt_sIdleStats;           /* Sleep accounting (SystemGetIdleStats()) */
+static u32 Anttt_u32LastWake;                          /* G_u32SystemTime1ms when SystemSleep() last returned */
+static u32 Anttt_u32WindowStart;                       /* G_u32SystemTime1ms at the start of the idle window */
+static u32 Anttt_u32AwakeCycles;                       /* Cycles awake so far in the idle window */
+static SystemLoopStatsType Anttt_sLoopStats;           /* Loop time and wake latency (SystemGetLoopStats()) */
+static u32 Anttt_u32LoopStart;                         /* TIMER1 count paired with Anttt_u32LastWake */
+
+/* floor(log2()) of a byte (0 for 0), for SystemHistogramAdd() */
+static const u8 Anttt_au8Log2[256] =
+{
+  0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
+};
+
+#ifdef SYSTEM_LOW_POWER
+static fnCode_type Anttt_pfnCalibration;               /* LFCLK RC calibration state machine, run from SystemSleep() */
+static u32 Anttt_u32CalTimer;                          /* Start of the current SYSTEM_CAL_CHECK_MS period */
+static s32 Anttt_s32Temperature;                       /* Latest die temperature, 0.25C units */
+#endif /* SYSTEM_LOW_POWER */
 
 
 /***********************************************************************************************************************
@@ -34,6 +67,150 @@ Function Definitions
 /* Public Functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemCycleCapture
+
+Description:
+Captures the current TIMER1 count.  TIMER1 runs from the 16MHz HFCLK with no prescaler, so one count is one
+CPU cycle.  The counter is cleared every 1ms by the system tick compare, so captured values are 0 to TIMER_COUNT_1MS.
+
+Requires:
+  - SysTickSetup() has started TIMER1
+
+Promises:
+  - Returns the current cycle count within the current 1ms tick
+*/
+u32 SystemCycleCapture(void)
+{
+  NRF_TIMER1->TASKS_CAPTURE[TIMER1_CAPTURE_CC] = 1;
+  return(NRF_TIMER1->CC[TIMER1_CAPTURE_CC]);
+
+} /* end SystemCycleCapture() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemCyclesElapsed
+
+Description:
+Returns the number of CPU cycles since a count taken with SystemCycleCapture().  Handles one roll of
+TIMER1 at the 1ms tick, so the measured interval must be shorter than 1ms.
+
+Requires:
+  - u32StartCycle_ is a value returned by SystemCycleCapture()
+
+Promises:
+  - Returns the cycles elapsed since u32StartCycle_
+*/
+u32 SystemCyclesElapsed(u32 u32StartCycle_)
+{
+  u32 u32Now = SystemCycleCapture();
+  
+  if(u32Now >= u32StartCycle_)
+  {
+    return(u32Now - u32StartCycle_);
+  }
+  
+  return(u32Now + TIMER_COUNT_1MS - u32StartCycle_);
+
+} /* end SystemCyclesElapsed() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemTimeCapture
+
+Description:
+Reads G_u32SystemTime1ms and a TIMER1 capture as a pair from the same tick.  A tick that lands between the two reads,
+or whose interrupt has not run yet, would pair a new cycle count with the old ms count, so the pair is read again
+until the ms count is unchanged across the capture and no tick is waiting to be counted.
+
+Requires:
+  - Called from the main loop with interrupts enabled (the tick interrupt must be able to run)
+
+Promises:
+  - *pu32Ms_ is G_u32SystemTime1ms and *pu32Cycle_ is the TIMER1 count within that tick
+*/
+void SystemTimeCapture(u32* pu32Ms_, u32* pu32Cycle_)
+{
+  u32 u32Ms;
+  
+  do
+  {
+    u32Ms = G_u32SystemTime1ms;
+    *pu32Cycle_ = SystemCycleCapture();
+  } while( (u32Ms != G_u32SystemTime1ms) || SYSTEM_TICK_PENDING() );
+  
+  *pu32Ms_ = u32Ms;
+
+} /* end SystemTimeCapture() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemCyclesSince
+
+Description:
+Returns the CPU cycles since a pair taken with SystemTimeCapture(), for intervals of any length.  Within one tick it
+is SystemCyclesElapsed(), which allows one roll of TIMER1: with SYSTEM_LOW_POWER the tick is RTC1's and TIMER1
+rolls on its own 1ms from its restart at wake-up, so it can roll with no tick counted.  Longer intervals are whole
+ticks from the ms count corrected by the two captures; the captures differ by less than one roll, so the result
+stays above (ticks - 1) * TIMER_COUNT_1MS and never wraps.  With SYSTEM_LOW_POWER, RTC ticks and TIMER1 rolls are
+not aligned, so an interval of more than one tick is only good to one tick.
+
+Requires:
+  - u32StartMs_ and u32StartCycle_ were read together by SystemTimeCapture()
+  - Called from the main loop with interrupts enabled
+
+Promises:
+  - Returns the cycles elapsed since the pair was taken
+*/
+u32 SystemCyclesSince(u32 u32StartMs_, u32 u32StartCycle_)
+{
+  u32 u32Ms;
+  u32 u32Cycle;
+  
+  SystemTimeCapture(&u32Ms, &u32Cycle);
+  return( SystemCyclesBetween(u32StartMs_, u32StartCycle_, u32Ms, u32Cycle) );
+
+} /* end SystemCyclesSince() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemGetIdleStats
+
+Description:
+Returns the sleep accounting kept by SystemSleep().
+
+Requires:
+  - 
+
+Promises:
+  - Returns a pointer to the statistics (read-only)
+*/
+const SystemIdleStatsType* SystemGetIdleStats(void)
+{
+  return(&Anttt_sIdleStats);
+
+} /* end SystemGetIdleStats() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemGetLoopStats
+
+Description:
+Returns the main loop timing kept by SystemSleep(): how long each pass takes and how late it starts after the tick.
+
+Requires:
+  - 
+
+Promises:
+  - Returns a pointer to the statistics (read-only)
+*/
+const SystemLoopStatsType* SystemGetLoopStats(void)
+{
+  return(&Anttt_sLoopStats);
+
+} /* end SystemGetLoopStats() */
+
+
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Protected Functions */
@@ -75,38 +252,10 @@ Promises:
 */
 void GpioSetup(void)
 {
-  /* Set all of the pin function registers in port 0 */
-  NRF_GPIO->PIN_CNF[P0_30_INDEX] = P0_30_LED_HOME_3_CNF;
-  NRF_GPIO->PIN_CNF[P0_29_INDEX] = P0_29_LED_HOME_6_CNF;
-  NRF_GPIO->PIN_CNF[P0_28_INDEX] = P0_28_LED_AWAY_3_CNF;
-  NRF_GPIO->PIN_CNF[P0_27_INDEX] = P0_27_NC_CNF;
-  NRF_GPIO->PIN_CNF[P0_26_INDEX] = P0_26_SW_ROW1_CNF;
-  NRF_GPIO->PIN_CNF[P0_25_INDEX] = P0_25_NC_CNF;
-  NRF_GPIO->PIN_CNF[P0_24_INDEX] = P0_24_LED_AWAY_9_CNF;
-  NRF_GPIO->PIN_CNF[P0_23_INDEX] = P0_23_COLUMN3_CNF;
-  NRF_GPIO->PIN_CNF[P0_22_INDEX] = P0_22_LED_HOME_9_CNF;
-  NRF_GPIO->PIN_CNF[P0_21_INDEX] = P0_21_LED_AWAY_6_CNF;
-  NRF_GPIO->PIN_CNF[P0_20_INDEX] = P0_20_LED_HOME_1_CNF;
-  NRF_GPIO->PIN_CNF[P0_19_INDEX] = P0_19_LED_AWAY_1_CNF;
-  NRF_GPIO->PIN_CNF[P0_18_INDEX] = P0_18_LED_AWAY_2_CNF;
-  NRF_GPIO->PIN_CNF[P0_17_INDEX] = P0_17_LED_HOME_2_CNF;
-  NRF_GPIO->PIN_CNF[P0_16_INDEX] = P0_16_BUZZER_CNF;
-  NRF_GPIO->PIN_CNF[P0_15_INDEX] = P0_15_COLUMN2_CNF;
-  NRF_GPIO->PIN_CNF[P0_14_INDEX] = P0_14_COLUMN1_CNF;
-  NRF_GPIO->PIN_CNF[P0_13_INDEX] = P0_13_LED_AWAY_4_CNF;
-  NRF_GPIO->PIN_CNF[P0_12_INDEX] = P0_12_LED_HOME_4_CNF;
-  NRF_GPIO->PIN_CNF[P0_11_INDEX] = P0_11_LED_AWAY_7_CNF;
-  NRF_GPIO->PIN_CNF[P0_10_INDEX] = P0_10_LED_HOME_7_CNF;
-  NRF_GPIO->PIN_CNF[P0_09_INDEX] = P0_09_SW_ROW3_CNF;
-  NRF_GPIO->PIN_CNF[P0_08_INDEX] = P0_08_SW_ROW2_CNF;
-  NRF_GPIO->PIN_CNF[P0_07_INDEX] = P0_07_LED_AWAY_5_CNF;
-  NRF_GPIO->PIN_CNF[P0_06_INDEX] = P0_06_LED_HOME_5_CNF;
-  NRF_GPIO->PIN_CNF[P0_05_INDEX] = P0_05_LED_STATUS_RED_CNF;
-  NRF_GPIO->PIN_CNF[P0_04_INDEX] = P0_04_LED_STATUS_YLW_CNF;
-  NRF_GPIO->PIN_CNF[P0_03_INDEX] = P0_03_LED_STATUS_GRN_CNF;
-  NRF_GPIO->PIN_CNF[P0_02_INDEX] = P0_02_LED_AWAY_8_CNF;
-  NRF_GPIO->PIN_CNF[P0_01_INDEX] = P0_01_LED_HOME_8_CNF;
-  NRF_GPIO->PIN_CNF[P0_00_INDEX] = P0_00_GND_CNF;
+  /* Set all of the pin function registers in port 0 from the board description */
+#define GPIO_SETUP_PIN(pin, name, role, cnf)  NRF_GPIO->PIN_CNF[(pin)] = (cnf);
+  ANTTT_BOARD_PINS(GPIO_SETUP_PIN)
+#undef GPIO_SETUP_PIN
    
 } /* end GpioSetup() */
 
@@ -141,6 +290,10 @@ Loads all registers required to set up the processor clocks.  The main clock, HF
 16MHz crystal.  The slow clock, LFCLK, will be synthesized from the 16MHz and configured to provide
 a 1ms system tick.
 
+With SYSTEM_LOW_POWER, LFCLK comes from the RC oscillator instead so RTC1 can give the tick with HFCLK stopped.
+The RC is calibrated once against the crystal here (start-up has no timing constraint), then the crystal is
+stopped; the CPU runs from the internal 16MHz RC until a calibration needs the crystal again.
+
 Requires:
   - 
 
@@ -165,8 +318,13 @@ void ClockSetup(void)
   NRF_CLOCK->EVENTS_HFCLKSTARTED = 0;
    
   
+#ifdef SYSTEM_LOW_POWER
+  /* Setup and start the 32.768kHz (LFCLK) clock from the RC oscillator */
+  NRF_CLOCK->LFCLKSRC = (CLOCK_LFCLKSRC_SRC_RC << CLOCK_LFCLKSRC_SRC_Pos);
+#else
   /* Setup and start the 32.768kHz (LFCLK) clock (synthesized from HFCLK) */
   NRF_CLOCK->LFCLKSRC = (CLOCK_LFCLKSRC_SRC_Synth << CLOCK_LFCLKSRC_SRC_Pos);
+#endif /* SYSTEM_LOW_POWER */
   NRF_CLOCK->EVENTS_LFCLKSTARTED = 0;
   NRF_CLOCK->TASKS_LFCLKSTART = 1;
   
@@ -174,17 +332,29 @@ void ClockSetup(void)
   while (NRF_CLOCK->EVENTS_LFCLKSTARTED == 0);
   NRF_CLOCK->EVENTS_LFCLKSTARTED = 0;
  
-#if 0  /* Can't use RTC because we synthesize LFCLK and therefore RTC would not be clocked when HFCLK is sleeping */  
-  /* Configure the RTC to give a 1ms tick */
-  NRF_RTC1->STOP = 1;
-  NRF_RTC1->PRESCALER = RTC_PRESCALE_INIT;
-  NRF_RTC1->EVTENSET = (1 << RTC_EVTEN_TICK_Pos);
-  NRF_RTC1->INTENSET = (1 << RTC_INTENSET_TICK_Pos);
-  
-  /* Clear then start the RTC */
-  NRF_RTC1->CLEAR = 1;
-  NRF_RTC1->START = 1;
-#endif
+#ifdef SYSTEM_LOW_POWER
+  /* Note the die temperature and calibrate the RC against the crystal (if it started) */
+  nrf_temp_init();
+  NRF_TEMP->EVENTS_DATARDY = 0;
+  NRF_TEMP->TASKS_START = 1;
+  while(NRF_TEMP->EVENTS_DATARDY == 0);
+  NRF_TEMP->EVENTS_DATARDY = 0;
+  Anttt_s32Temperature = nrf_temp_read();
+  NRF_TEMP->TASKS_STOP = 1;
+  Anttt_sIdleStats.s32CalTemperature = Anttt_s32Temperature;
+
+  if( !(G_u32SystemFlags & _SYSTEM_HFCLK_NO_START) )
+  {
+    NRF_CLOCK->EVENTS_DONE = 0;
+    NRF_CLOCK->TASKS_CAL = 1;
+    while(NRF_CLOCK->EVENTS_DONE == 0);
+    NRF_CLOCK->EVENTS_DONE = 0;
+  }
+  
+  /* The crystal is only needed again for calibration */
+  NRF_CLOCK->TASKS_HFCLKSTOP = 1;
+  Anttt_pfnCalibration = SystemCalSM_Idle;
+#endif /* SYSTEM_LOW_POWER */
   
 } /* end ClockSetup */
 
@@ -214,7 +384,11 @@ Function: SysTickSetup
 Description:
 Initializes the 1ms and 1s System Ticks from the TIMER1 peripheral.
 Since this application is not concerned about power, we can keep the 16MHz clock
-on and power TIMER1 all the time.  
+on and power TIMER1 all the time.  TIMER1_IRQHandler() (interrupts.c) counts the ticks.
+
+With SYSTEM_LOW_POWER, RTC1 gives the tick instead (RTC1_IRQHandler()) and TIMER1 still runs while the CPU is awake
+so SystemCycleCapture() works, but without its interrupt.  RTC1's compare is normally the next tick; SystemSleep()
+moves it further out when nothing needs the ticks in between.
 
 Requires:
   -
@@ -233,11 +407,30 @@ void SysTickSetup(void)
   NRF_TIMER1->PRESCALER = 0;
   NRF_TIMER1->SHORTS    = TIMER_SHORTS_COMPARE0_CLEAR_Enabled << TIMER_SHORTS_COMPARE0_CLEAR_Pos;
   NRF_TIMER1->CC[0]     = TIMER_COUNT_1MS;
+
+#ifdef SYSTEM_LOW_POWER
+  /* RTC1 counts LFCLK with no prescaler; the first tick is 1ms after the clear */
+  NRF_RTC1->TASKS_STOP  = 1;
+  NRF_RTC1->PRESCALER   = 0;
+  NRF_RTC1->CC[0]       = RTC_COUNTS_PER_MS;
+  NRF_RTC1->EVTENSET    = RTC_EVTENSET_COMPARE0_Enabled << RTC_EVTENSET_COMPARE0_Pos;
+  NRF_RTC1->INTENSET    = RTC_INTENSET_COMPARE0_Enabled << RTC_INTENSET_COMPARE0_Pos;
+  
+  NVIC_SetPriority(RTC1_IRQn, RTC_IRQ_PRIORITY);
+  NVIC_ClearPendingIRQ(RTC1_IRQn);
+  NVIC_EnableIRQ(RTC1_IRQn);
+  
+  NRF_RTC1->TASKS_CLEAR = 1;
+  NRF_RTC1->TASKS_START = 1;
+  Anttt_u32CalTimer = G_u32SystemTime1ms;
+#else
   NRF_TIMER1->INTENSET  = TIMER_INTENSET_COMPARE0_Enabled << TIMER_INTENSET_COMPARE0_Pos;
   
   /* Enable TIMER1 interrupt */
-  NVIC_SetPriority(TIMER1_IRQn, 0);
-  //NVIC_EnableIRQ(TIMER1_IRQn);
+  NVIC_SetPriority(TIMER1_IRQn, TIMER1_IRQ_PRIORITY);
+  NVIC_ClearPendingIRQ(TIMER1_IRQn);
+  NVIC_EnableIRQ(TIMER1_IRQn);
+#endif /* SYSTEM_LOW_POWER */
   
   /* Start timer */
   NRF_TIMER1->TASKS_START = 1;
@@ -250,71 +443,370 @@ void SysTickSetup(void)
 Function: SystemSleep
 
 Description:
-Puts the system into sleep mode. 
-
-TBD
+Puts the system into sleep mode until the next tick a task needs.  MainMsToNextTask() says how many ticks can pass
+with no task due (the LED task asks LedMsToNextEdge(), so a tickless LED timeline can be slept through between its
+edges), up to SYSTEM_SLEEP_MAX_MS.  The CPU waits with WFE, so any interrupt wakes it; an interrupt other than the
+tick (e.g. the LED BAM timer) leaves _SYSTEM_SLEEPING set and the CPU goes back to sleep, and so does a tick before
+the wake-up one.  The flag is set before the time is tested, and WFE rather than WFI closes the race with a tick
+that arrives between the flag test and the sleep: the interrupt sets the event register, so that WFE returns at
+once and the loop sees the flag cleared.
+
+The cycles spent awake before each call are added up over SYSTEM_IDLE_WINDOW_MS or more to give the idle fraction
+and an estimate of the average current (SystemGetIdleStats()).  The time from entry to the wake-up tick is charged
+to ANTTT_LOAD_SLEEP.
+
+The main loop starts each pass when this returns, so a tick/cycle pair is taken with SystemTimeCapture() at entry
+(end of the pass) and at wake-up (start of the next one); the loop time is SystemCyclesBetween() the two, so a pass
+that runs over a tick is timed whole.  The loop time and the wake latency each go into a SystemHistogramType
+(SystemGetLoopStats()) for about 60 cycles, so the instrumentation can stay in production builds; the cycles spent
+recording them each pass are kept in u32RecordCycles.  A pass that ends after its tick sets _SYSTEM_LOOP_OVERRUN
+and a wake-up later than SYSTEM_WAKE_LATE_CYCLES sets _SYSTEM_WAKE_LATE.
+
+With SYSTEM_LOW_POWER the tick is RTC1's and TIMER1 is stopped while asleep so nothing holds HFCLK on; it is cleared
+and restarted on wake, so the sleep and the latency are counted on RTC1 (SYSTEM_CYCLES_PER_RTC_COUNT each) and a
+pass is timed from TIMER1's restart.  One step of the RC calibration
+state machine runs before each sleep, so its next step (SystemCalMsToNext()) also limits the wake-up tick.  RTC1's
+compare is then moved straight to that tick (InterruptsRtcWakeAt()) and the ticks in between never interrupt; the
+compare's interrupt counts them all into the system time when it fires.
 
 Requires:
-  - TBD
+  - SysTickSetup() has started TIMER1 with its interrupt enabled
+  - Called once per pass of the main loop
 
 Promises:
-  - Configures processor for maximum sleep while still allowing any required
-    interrupt to wake it up.
+  - Returns after the next 1ms tick, or later if MainMsToNextTask() allows
+  - Anttt_sIdleStats is updated at the end of each idle window
 */
 void SystemSleep(void)
 {    
-  /* Set the system control register for Sleep (but not Deep Sleep) */
-   
-   /* Set the sleep flag (cleared only in SysTick ISR */
-   G_u32SystemFlags |= _SYSTEM_SLEEPING;
-
-   while(NRF_TIMER1->EVENTS_COMPARE[0] == 0);
-   NRF_TIMER1->EVENTS_COMPARE[0] = 0;
-   
-  /* Now sleep until an event wakes us up */
-   //while(G_u32SystemFlags & _SYSTEM_SLEEPING)
-   {
-   }
+  u32 u32Now;
+  u32 u32Capture;
+  u32 u32LoopCycles;
+  u32 u32RecordCycles;
+  u32 u32Latency;
+  u32 u32IdlePerMille;
+  u32 u32WakeMs;
+  u32 u32Wait;
+#ifdef SYSTEM_LOW_POWER
+  u32 u32SleepCount;
+  u32 u32Deadline;
+  u32 u32CalWait;
+#endif /* SYSTEM_LOW_POWER */
+  
+  /* The pass ends here and began at the pair taken at the last wake-up: whole ticks if it overran, plus cycles */
+  SystemTimeCapture(&u32Now, &u32Capture);
+  u32LoopCycles = SystemCyclesBetween(Anttt_u32LastWake, Anttt_u32LoopStart, u32Now, u32Capture);
+  if(u32Now != Anttt_u32LastWake)
+  {
+    Anttt_sIdleStats.u32Overruns++;
+    Anttt_sLoopStats.u32LoopOverruns++;
+    G_u32SystemFlags |= _SYSTEM_LOOP_OVERRUN;
+  }
+  Anttt_u32AwakeCycles += u32LoopCycles;
+  Anttt_sIdleStats.u32Sleeps++;
+  SystemHistogramAdd(&Anttt_sLoopStats.sLoopCycles, u32LoopCycles);
+  u32RecordCycles = SystemCyclesElapsed(u32Capture);
+  
+#ifdef SYSTEM_LOW_POWER
+  Anttt_pfnCalibration();
+  NRF_TIMER1->TASKS_STOP = 1;
+  u32SleepCount = NRF_RTC1->COUNTER;
+#endif /* SYSTEM_LOW_POWER */
+
+  /* The first tick that any task (or the RC calibration) needs */
+  u32WakeMs = G_u32SystemTime1ms + 1;
+  u32Wait = MainMsToNextTask();
+#ifdef SYSTEM_LOW_POWER
+  u32CalWait = SystemCalMsToNext();
+  if(u32CalWait < u32Wait)
+  {
+    u32Wait = u32CalWait;
+  }
+#endif /* SYSTEM_LOW_POWER */
+  u32WakeMs += (u32Wait < SYSTEM_SLEEP_MAX_MS) ? u32Wait : SYSTEM_SLEEP_MAX_MS;
+
+  /* Set the sleep flag (cleared only in the tick ISR) and sleep until it is cleared at the wake-up tick */
+  G_u32SystemFlags |= _SYSTEM_SLEEPING;
+#ifdef SYSTEM_LOW_POWER
+  InterruptsRtcWakeAt(u32WakeMs);
+  u32Deadline = u32SleepCount;
+#endif /* SYSTEM_LOW_POWER */
+  while( (s32)(G_u32SystemTime1ms - u32WakeMs) < 0 )
+  {
+#ifdef SYSTEM_LOW_POWER
+    u32Deadline = NRF_RTC1->CC[0];
+#endif /* SYSTEM_LOW_POWER */
+    while(G_u32SystemFlags & _SYSTEM_SLEEPING)
+    {
+      __WFE();
+    }
+    G_u32SystemFlags |= _SYSTEM_SLEEPING;
+  }
+  G_u32SystemFlags &= ~_SYSTEM_SLEEPING;
+  
+#ifdef SYSTEM_LOW_POWER
+  /* TIMER1 was stopped, so the sleep (to the wake-up compare) and the latency are read from RTC1 at its coarser
+  resolution; TIMER1 restarts from 0 and the new pass starts from it */
+  u32Latency = (NRF_RTC1->COUNTER - u32Deadline) & RTC_COUNTER_MASK;
+  u32Wait = (u32Deadline - u32SleepCount) & RTC_COUNTER_MASK;
+  NRF_TIMER1->TASKS_CLEAR = 1;
+  NRF_TIMER1->TASKS_START = 1;
+  SystemTimeCapture(&Anttt_u32LastWake, &Anttt_u32LoopStart);
+  
+  if(u32Latency > (RTC_COUNTER_MASK >> 1))
+  {
+    u32Latency = 0;
+  }
+  if(u32Wait > (RTC_COUNTER_MASK >> 1))
+  {
+    u32Wait = 0;
+  }
+  u32Latency *= SYSTEM_CYCLES_PER_RTC_COUNT;
+  AntttLoadAdd(ANTTT_LOAD_SLEEP, u32Wait * SYSTEM_CYCLES_PER_RTC_COUNT);
+#else
+  /* The wake-up tick cleared TIMER1, so the latency is the capture plus any ticks counted since; the sleep ran from
+  the entry pair to the wake-up tick, and the CPU is awake for the latency */
+  SystemTimeCapture(&Anttt_u32LastWake, &Anttt_u32LoopStart);
+  u32Latency = ((Anttt_u32LastWake - u32WakeMs) * TIMER_COUNT_1MS) + Anttt_u32LoopStart;
+  AntttLoadAdd(ANTTT_LOAD_SLEEP, ((u32WakeMs - u32Now) * TIMER_COUNT_1MS) - u32Capture);
+  Anttt_u32AwakeCycles += u32Latency;
+#endif /* SYSTEM_LOW_POWER */
+
+  SystemHistogramAdd(&Anttt_sLoopStats.sWakeLatency, u32Latency);
+  if(u32Latency > SYSTEM_WAKE_LATE_CYCLES)
+  {
+    Anttt_sLoopStats.u32LateWakes++;
+    G_u32SystemFlags |= _SYSTEM_WAKE_LATE;
+  }
+  Anttt_sLoopStats.u32RecordCycles = u32RecordCycles + SystemCyclesElapsed(Anttt_u32LoopStart);
 
-  /* Clear the sleep mode status flags */
+  /* Report the window: a sleep can carry it past SYSTEM_IDLE_WINDOW_MS, so its length is divided out (one divide
+  per window; a per-mille of 1ms is TIMER_COUNT_1MS / 1000 cycles) */
+  u32Wait = Anttt_u32LastWake - Anttt_u32WindowStart;
+  if(u32Wait >= SYSTEM_IDLE_WINDOW_MS)
+  {
+    u32IdlePerMille = Anttt_u32AwakeCycles / (u32Wait * (TIMER_COUNT_1MS / 1000));
+    if(u32IdlePerMille > 1000)
+    {
+      u32IdlePerMille = 1000;
+    }
+    u32IdlePerMille = 1000 - u32IdlePerMille;
+    
+    Anttt_sIdleStats.u32IdlePerMille = u32IdlePerMille;
+    Anttt_sIdleStats.u32AverageCurrentUa = ( (u32IdlePerMille * SYSTEM_SLEEP_CURRENT_UA) + 
+                                             ((1000 - u32IdlePerMille) * SYSTEM_RUN_CURRENT_UA) ) / 1000;
+#ifdef SYSTEM_LOW_POWER
+    Anttt_sIdleStats.u32SavedCurrentUa = (u32IdlePerMille * 
+                                          (SYSTEM_IDLE_CURRENT_UA - SYSTEM_RTC_IDLE_CURRENT_UA)) / 1000;
+#endif /* SYSTEM_LOW_POWER */
+    
+    Anttt_u32WindowStart = Anttt_u32LastWake;
+    Anttt_u32AwakeCycles = 0;
+  }
     
 } /* end SystemSleep(void) */
 
-#if 0
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private Functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
 /*----------------------------------------------------------------------------------------------------------------------
-Function: SystemSleep
+Function: SystemCyclesBetween
 
 Description:
-Puts the system into sleep mode. 
+CPU cycles between two pairs taken with SystemTimeCapture(), as described for SystemCyclesSince().
+
+Requires:
+  - Each pair was read together by SystemTimeCapture(), the end pair no earlier than the start pair
+
+Promises:
+  - Returns the cycles from the start pair to the end pair
+*/
+u32 SystemCyclesBetween(u32 u32StartMs_, u32 u32StartCycle_, u32 u32EndMs_, u32 u32EndCycle_)
+{
+  u32 u32Ticks = u32EndMs_ - u32StartMs_;
+  
+  if(u32Ticks == 0)
+  {
+    if(u32EndCycle_ >= u32StartCycle_)
+    {
+      return(u32EndCycle_ - u32StartCycle_);
+    }
+    return(u32EndCycle_ + TIMER_COUNT_1MS - u32StartCycle_);
+  }
+  
+  /* Both captures are below TIMER_COUNT_1MS, so this is at least (u32Ticks - 1) ticks */
+  return( (u32Ticks * TIMER_COUNT_1MS) + u32EndCycle_ - u32StartCycle_ );
+
+} /* end SystemCyclesBetween() */
 
-TBD
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemHistogramAdd
+
+Description:
+Records one value, twice per pass of the main loop, so it is kept short.  The Cortex-M0 has no CLZ, so the log2
+bin comes from a byte table instead of a chain of halving tests, and the mean is left to the reader as a sum (64
+bits: 1ms passes would wrap 32 bits in under five minutes).  Counting the thumb code on the M0 (loads 2 cycles,
+taken branches 3) this is about 60 cycles with the call, where four halving tests instead of the table made it
+about 80.
 
 Requires:
-  - TBD
+  - psHistogram_ points to the histogram to update
 
 Promises:
-  - Configures processor for maximum sleep while still allowing any required
-    interrupt to wake it up.
+  - Count, min, max, sum and the value's log2 bin are updated
 */
-void SystemSleep(void)
-{    
-  /* Set the system control register for Sleep (but not Deep Sleep) */
-   
-   /* Set the sleep flag (cleared only in SysTick ISR */
-   G_u32SystemFlags |= _SYSTEM_SLEEPING;
+void SystemHistogramAdd(SystemHistogramType* psHistogram_, u32 u32Value_)
+{
+  u32 u32Bin = SYSTEM_HISTOGRAM_BINS - 1;
+  
+  if( (psHistogram_->u32Count == 0) || (u32Value_ < psHistogram_->u32Min) )
+  {
+    psHistogram_->u32Min = u32Value_;
+  }
+  if(u32Value_ > psHistogram_->u32Max)
+  {
+    psHistogram_->u32Max = u32Value_;
+  }
+  psHistogram_->u32Count++;
+  psHistogram_->u64Sum += u32Value_;
+  
+  /* floor(log2()) of the value, with everything from 2^15 up in the last bin */
+  if(u32Value_ < ((u32)1 << (SYSTEM_HISTOGRAM_BINS - 1)))
+  {
+    if(u32Value_ >> 8)
+    {
+      u32Bin = 8 + Anttt_au8Log2[u32Value_ >> 8];
+    }
+    else
+    {
+      u32Bin = Anttt_au8Log2[u32Value_];
+    }
+  }
+  psHistogram_->au32Histogram[u32Bin]++;
+  
+} /* end SystemHistogramAdd() */
 
-   while(NRF_TIMER1->EVENTS_COMPARE[0] == 0);
-   NRF_TIMER1->EVENTS_COMPARE[0] = 0;
-   
-  /* Now sleep until an event wakes us up */
-   //while(G_u32SystemFlags & _SYSTEM_SLEEPING)
-   {
-   }
 
-  /* Clear the sleep mode status flags */
+#ifdef SYSTEM_LOW_POWER
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemCalMsToNext
+
+Description:
+Ticks that can pass before the RC calibration state machine needs its next step: until the next SYSTEM_CAL_CHECK_MS
+check when it is idle, none while a measurement or calibration is being polled.
+
+Requires:
+  - Called from SystemSleep() before it picks the wake-up tick
+
+Promises:
+  - Returns the number of ticks SystemSleep() may skip for the calibration
+*/
+u32 SystemCalMsToNext(void)
+{
+  s32 s32Wait;
+  
+  if(Anttt_pfnCalibration != SystemCalSM_Idle)
+  {
+    return(0);
+  }
+  
+  /* SystemCalSM_Idle() next runs at the wake-up tick, and is due SYSTEM_CAL_CHECK_MS after Anttt_u32CalTimer */
+  s32Wait = (s32)(Anttt_u32CalTimer + SYSTEM_CAL_CHECK_MS - G_u32SystemTime1ms) - 1;
+  return( (s32Wait > 0) ? (u32)s32Wait : 0 );
+  
+} /* end SystemCalMsToNext() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* State Machine definitions                                                                                          */
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* The LFCLK RC calibration runs one step per SystemSleep() and never waits: each state polls the event it started. */
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SystemCalSM_Idle
+Every SYSTEM_CAL_CHECK_MS, start a die temperature measurement.
+*/
+void SystemCalSM_Idle(void)
+{
+  if( IsTimeUp(&Anttt_u32CalTimer, SYSTEM_CAL_CHECK_MS) )
+  {
+    Anttt_u32CalTimer = G_u32SystemTime1ms;
+    NRF_TEMP->EVENTS_DATARDY = 0;
+    NRF_TEMP->TASKS_START = 1;
+    Anttt_pfnCalibration = SystemCalSM_Temperature;
+  }
+
+} /* end SystemCalSM_Idle() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SystemCalSM_Temperature
+Wait for the temperature; start the crystal if it has moved SYSTEM_CAL_TEMP_STEP since the last calibration.
+*/
+void SystemCalSM_Temperature(void)
+{
+  s32 s32Change;
+  
+  if(NRF_TEMP->EVENTS_DATARDY)
+  {
+    NRF_TEMP->EVENTS_DATARDY = 0;
+    Anttt_s32Temperature = nrf_temp_read();
+    NRF_TEMP->TASKS_STOP = 1;
     
-} /* end SystemSleep(void) */
-#endif
+    s32Change = Anttt_s32Temperature - Anttt_sIdleStats.s32CalTemperature;
+    if( (s32Change >= SYSTEM_CAL_TEMP_STEP) || (s32Change <= -SYSTEM_CAL_TEMP_STEP) )
+    {
+      NRF_CLOCK->EVENTS_HFCLKSTARTED = 0;
+      NRF_CLOCK->TASKS_HFCLKSTART = 1;
+      Anttt_pfnCalibration = SystemCalSM_CrystalStart;
+    }
+    else
+    {
+      Anttt_pfnCalibration = SystemCalSM_Idle;
+    }
+  }
+
+} /* end SystemCalSM_Temperature() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SystemCalSM_CrystalStart
+Wait for the crystal (about 1ms), then calibrate the RC against it.
+*/
+void SystemCalSM_CrystalStart(void)
+{
+  if(NRF_CLOCK->EVENTS_HFCLKSTARTED)
+  {
+    NRF_CLOCK->EVENTS_HFCLKSTARTED = 0;
+    NRF_CLOCK->EVENTS_DONE = 0;
+    NRF_CLOCK->TASKS_CAL = 1;
+    Anttt_pfnCalibration = SystemCalSM_Calibrate;
+  }
+
+} /* end SystemCalSM_CrystalStart() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: SystemCalSM_Calibrate
+Wait for the calibration to finish, then stop the crystal again.
+*/
+void SystemCalSM_Calibrate(void)
+{
+  if(NRF_CLOCK->EVENTS_DONE)
+  {
+    NRF_CLOCK->EVENTS_DONE = 0;
+    NRF_CLOCK->TASKS_HFCLKSTOP = 1;
+    
+    Anttt_sIdleStats.u32Calibrations++;
+    Anttt_sIdleStats.s32CalTemperature = Anttt_s32Temperature;
+    Anttt_pfnCalibration = SystemCalSM_Idle;
+  }
+
+} /* end SystemCalSM_Calibrate() */
+#endif /* SYSTEM_LOW_POWER */
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* End of File */
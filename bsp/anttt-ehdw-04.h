@@ -5,12 +5,43 @@
 * This file provides header information for the board support functions for nRF51422 processor on the anttt-ehdw-04 board.
 ***********************************************************************************************************************/
 
-#ifndef __ANTTT_H
-#define __ANTTT_H
+#ifndef __ANTTT_EHDW_04_H
+#define __ANTTT_EHDW_04_H
 
 /***********************************************************************************************************************
 Type Definitions
 ***********************************************************************************************************************/
+#define SYSTEM_HISTOGRAM_BINS   (u8)16             /* log2 bins: the last one holds 2^15 cycles (~2ms) and up */
+
+typedef struct
+{
+  u32 u32Sleeps;                /* SystemSleep() calls */
+  u32 u32Overruns;              /* Calls that arrived after the tick they started in had already ended */
+  u32 u32IdlePerMille;          /* Time spent asleep in the last SYSTEM_IDLE_WINDOW_MS window (0-1000) */
+  u32 u32AverageCurrentUa;      /* Estimated average current over that window */
+  u32 u32SavedCurrentUa;        /* Estimated current saved by SYSTEM_LOW_POWER over that window (0 without it) */
+  u32 u32Calibrations;          /* LFCLK RC calibrations run after start-up (SYSTEM_LOW_POWER) */
+  s32 s32CalTemperature;        /* Die temperature at the last calibration, 0.25C units */
+} SystemIdleStatsType;
+
+/* Distribution of one loop measurement in cycles */
+typedef struct
+{
+  u32 u32Count;                 /* Values recorded */
+  u32 u32Min;
+  u32 u32Max;
+  uint64_t u64Sum;              /* Sum of the values recorded (mean = u64Sum / u32Count) */
+  u32 au32Histogram[SYSTEM_HISTOGRAM_BINS];   /* Bin n counts 2^n to 2^(n+1) - 1 (0 in bin 0, last bin open-ended) */
+} SystemHistogramType;
+
+typedef struct
+{
+  SystemHistogramType sLoopCycles;    /* Wake-up to the next SystemSleep(): one pass of the main loop */
+  SystemHistogramType sWakeLatency;   /* Tick to wake-up */
+  u32 u32LoopOverruns;                /* Passes that ran past the end of their tick (_SYSTEM_LOOP_OVERRUN) */
+  u32 u32LateWakes;                   /* Wake-ups later than SYSTEM_WAKE_LATE_CYCLES (_SYSTEM_WAKE_LATE) */
+  u32 u32RecordCycles;                /* Cycles SystemSleep() spent recording the last pass (TIMER1 captures) */
+} SystemLoopStatsType;
 
 /***********************************************************************************************************************
 * Constants
@@ -28,7 +59,12 @@ Type Definitions
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Public Functions */
 /*--------------------------------------------------------------------------------------------------------------------*/
-
+u32 SystemCycleCapture(void);
+u32 SystemCyclesElapsed(u32 u32StartCycle_);
+void SystemTimeCapture(u32* pu32Ms_, u32* pu32Cycle_);
+u32 SystemCyclesSince(u32 u32StartMs_, u32 u32StartCycle_);
+const SystemIdleStatsType* SystemGetIdleStats(void);
+const SystemLoopStatsType* SystemGetLoopStats(void);
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Protected Functions */
@@ -41,6 +77,19 @@ void InterruptSetup(void);
 void SysTickSetup(void);
 void SystemSleep(void);
 
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private Functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+u32 SystemCyclesBetween(u32 u32StartMs_, u32 u32StartCycle_, u32 u32EndMs_, u32 u32EndCycle_);
+void SystemHistogramAdd(SystemHistogramType* psHistogram_, u32 u32Value_);
+#ifdef SYSTEM_LOW_POWER
+u32 SystemCalMsToNext(void);
+void SystemCalSM_Idle(void);
+void SystemCalSM_Temperature(void);
+void SystemCalSM_CrystalStart(void);
+void SystemCalSM_Calibrate(void);
+#endif /* SYSTEM_LOW_POWER */
+
 
 /***********************************************************************************************************************
 Perihperal Setup Initializations
@@ -76,79 +125,149 @@ The built-in timer will provide the system tick
 It is clocked from HFCLK.  To get the desired 1ms tick use a compare period of 0.001 / (1/HFCLK) or HFCLK/1000.
 */
 #define TIMER_COUNT_1MS        (u32)(HFCLK_FREQ / 1000)
+#define TIMER1_CAPTURE_CC      (u8)1              /* TIMER1 CC register used by SystemCycleCapture() */
+
+/* Set from the tick's compare until its interrupt has counted it (SystemTimeCapture()) */
+#ifdef SYSTEM_LOW_POWER
+#define SYSTEM_TICK_PENDING()  (NRF_RTC1->EVENTS_COMPARE[0] != 0)
+#else
+#define SYSTEM_TICK_PENDING()  (NRF_TIMER1->EVENTS_COMPARE[0] != 0)
+#endif /* SYSTEM_LOW_POWER */
+
+/* Idle accounting
+SystemSleep() adds up the cycles the CPU is awake over a window of at least 1024 ticks (a sleep that skips ticks can
+carry it further) and divides by the window's length to give the awake time in per-mille.  The currents are
+nRF51422 datasheet figures, not measurements: running from flash at 16MHz, and asleep with the HFCLK crystal and
+TIMER1 still running for the tick. */
+#define SYSTEM_IDLE_WINDOW_MS   (u32)1024
+#define SYSTEM_SLEEP_MAX_MS     (u32)1000          /* Most ticks SystemSleep() skips when nothing is due sooner */
+#define SYSTEM_RUN_CURRENT_UA   (u32)4400          /* CPU running from flash, 16MHz */
+#define SYSTEM_IDLE_CURRENT_UA  (u32)550           /* System ON sleep, HFXO + TIMER1 */
+
+/* Low-power timebase (SYSTEM_LOW_POWER in configuration.h)
+LFCLK runs from the 32kHz RC oscillator instead of being synthesized, so RTC1 keeps counting with HFCLK stopped and
+gives the 1ms tick; the crystal is stopped after start-up and TIMER1 is stopped while asleep.  1ms is 32.768 RTC
+counts: each tick's compare is 32 counts after the last plus a carry of 768/1000 counts, so tick n lands on
+n * 32768 / 1000 counts and G_u32SystemTime1ms keeps its meaning.  The RC is only accurate to 250ppm while it is
+calibrated against the crystal, and it drifts with temperature: every SYSTEM_CAL_CHECK_MS the die temperature is
+read and a calibration is run if it has moved SYSTEM_CAL_TEMP_STEP since the last one. */
+#define RTC_COUNTS_PER_MS       (u32)(LFCLK_FREQ / 1000)    /* 32 */
+#define RTC_CARRY_PER_MS        (u32)(LFCLK_FREQ % 1000)    /* 768 thousandths of a count */
+#define RTC_COUNTER_MASK        (u32)0x00FFFFFF             /* 24-bit COUNTER */
+#define RTC_MIN_LEAD            (u32)2                      /* A compare closer than this to COUNTER may not fire */
+#define RTC_IRQ_PRIORITY        TIMER1_IRQ_PRIORITY         /* The tick runs at the same level either way */
+#define SYSTEM_CAL_CHECK_MS     (u32)4000
+#define SYSTEM_CAL_TEMP_STEP    (s32)2                      /* 0.5C in TEMP register units */
+#define SYSTEM_RTC_IDLE_CURRENT_UA (u32)4                   /* System ON sleep, LFRC + RTC1 only */
+
+#ifdef SYSTEM_LOW_POWER
+#define SYSTEM_SLEEP_CURRENT_UA SYSTEM_RTC_IDLE_CURRENT_UA
+#else
+#define SYSTEM_SLEEP_CURRENT_UA SYSTEM_IDLE_CURRENT_UA
+#endif
+
+/* Loop instrumentation: SystemSleep() times each pass of the main loop and how late it woke after the tick */
+#define SYSTEM_WAKE_LATE_CYCLES     (u32)1600                     /* 100us */
+#define SYSTEM_CYCLES_PER_RTC_COUNT (u32)(HFCLK_FREQ / LFCLK_FREQ) /* 488: wake latency steps with SYSTEM_LOW_POWER */
 
 
 /***********************************************************************************************************************
 !!!!! GPIO pin names
 ***********************************************************************************************************************/
-/* Hardware Definition for nRF51422 on ANTTT-EHDW-01 */
-
-/* Port 0 bit positions */
-#define P0_31_               (u32)0x80000000
-#define P0_30_LED_HOME_3     (u32)0x40000000
-#define P0_29_LED_HOME_6     (u32)0x20000000
-#define P0_28_LED_AWAY_3     (u32)0x10000000
-#define P0_27_NC             (u32)0x08000000
-#define P0_26_SW_ROW1        (u32)0x04000000 
-#define P0_25_NC             (u32)0x02000000
-#define P0_24_LED_AWAY_9     (u32)0x01000000
-#define P0_23_COLUMN3        (u32)0x00800000
-#define P0_22_LED_HOME_9     (u32)0x00400000 
-#define P0_21_LED_AWAY_6     (u32)0x00200000
-#define P0_20_LED_HOME_1     (u32)0x00100000
-#define P0_19_LED_AWAY_1     (u32)0x00080000
-#define P0_18_LED_AWAY_2     (u32)0x00040000
-#define P0_17_LED_HOME_2     (u32)0x00020000
-#define P0_16_BUZZER         (u32)0x00010000
-#define P0_15_COLUMN2        (u32)0x00008000
-#define P0_14_COLUMN1        (u32)0x00004000
-#define P0_13_LED_AWAY_4     (u32)0x00002000
-#define P0_12_LED_HOME_4     (u32)0x00001000
-#define P0_11_LED_AWAY_7     (u32)0x00000800
-#define P0_10_LED_HOME_7     (u32)0x00000400
-#define P0_09_SW_ROW3        (u32)0x00000200
-#define P0_08_SW_ROW2        (u32)0x00000100
-#define P0_07_LED_AWAY_5     (u32)0x00000080
-#define P0_06_LED_HOME_5     (u32)0x00000040
-#define P0_05_LED_STATUS_RED (u32)0x00000020
-#define P0_04_LED_STATUS_YLW (u32)0x00000010
-#define P0_03_LED_STATUS_GRN (u32)0x00000008
-#define P0_02_LED_AWAY_8     (u32)0x00000004
-#define P0_01_LED_HOME_8     (u32)0x00000002 
-#define P0_00_GND            (u32)0x00000001 
-
-#define P0_31_INDEX          (u32)31
-#define P0_30_INDEX          (u32)30
-#define P0_29_INDEX          (u32)29
-#define P0_28_INDEX          (u32)28
-#define P0_27_INDEX          (u32)27
-#define P0_26_INDEX          (u32)26
-#define P0_25_INDEX          (u32)25
-#define P0_24_INDEX          (u32)24
-#define P0_23_INDEX          (u32)23
-#define P0_22_INDEX          (u32)22
-#define P0_21_INDEX          (u32)21
-#define P0_20_INDEX          (u32)20
-#define P0_19_INDEX          (u32)19
-#define P0_18_INDEX          (u32)18
-#define P0_17_INDEX          (u32)17
-#define P0_16_INDEX          (u32)16
-#define P0_15_INDEX          (u32)15
-#define P0_14_INDEX          (u32)14
-#define P0_13_INDEX          (u32)13
-#define P0_12_INDEX          (u32)12
-#define P0_11_INDEX          (u32)11
-#define P0_10_INDEX          (u32)10
-#define P0_09_INDEX          (u32)9
-#define P0_08_INDEX          (u32)8
-#define P0_07_INDEX          (u32)7
-#define P0_06_INDEX          (u32)6
-#define P0_05_INDEX          (u32)5
-#define P0_04_INDEX          (u32)4
-#define P0_03_INDEX          (u32)3
-#define P0_02_INDEX          (u32)2
-#define P0_01_INDEX          (u32)1
-#define P0_00_INDEX          (u32)0
+/* Hardware Definition for nRF51422 on ANTTT-EHDW-04
+
+This is the only description of the board: every table that depends on the pin-out is generated from the two lists
+below by the compiler, so a new hardware revision only needs its own copy of this file.
+
+ANTTT_BOARD_PINS lists every configured port 0 pin as X(pin number, name, role, PIN_CNF value).  From it come:
+  - BOARD_PIN_<name>: the pin number (BoardPinType) and BOARD_MASK(<name>): its port bit
+  - BOARD_<role>_MASK: the port bits of all the pins of a role (LEDs, switch rows and columns, ...)
+  - GpioSetup(): one PIN_CNF write per pin
+
+ANTTT_BOARD_LEDS lists the LEDs as X(LedNumberType name, pin name, LedActiveType) in LedNumberType order, which
+generates LedNumberType, TOTAL_LEDS and the LED driver's pin tables (leds_anttt.c).  HOME1-HOME9 and AWAY1-AWAY9
+must each stay consecutive and in cell order: cell masks are shifted straight onto them. */
+
+/* Pin roles */
+#define BOARD_ROLE_LED        0
+#define BOARD_ROLE_SW_ROW     1
+#define BOARD_ROLE_SW_COLUMN  2
+#define BOARD_ROLE_BUZZER     3
+#define BOARD_ROLE_UNUSED     4
+
+/*                        Pin Name            Role                  PIN_CNF */
+#define ANTTT_BOARD_PINS(X) \
+                        X(30, LED_HOME_3,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(29, LED_HOME_6,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(28, LED_AWAY_3,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(27, NC_27,          BOARD_ROLE_UNUSED,    BOARD_CNF_INPUT_PULLUP)     \
+                        X(26, SW_ROW1,        BOARD_ROLE_SW_ROW,    BOARD_CNF_INPUT)            \
+                        X(25, NC_25,          BOARD_ROLE_UNUSED,    BOARD_CNF_INPUT_PULLUP)     \
+                        X(24, LED_AWAY_9,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(23, COLUMN3,        BOARD_ROLE_SW_COLUMN, BOARD_CNF_OUTPUT)           \
+                        X(22, LED_HOME_9,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(21, LED_AWAY_6,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(20, LED_HOME_1,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(19, LED_AWAY_1,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(18, LED_AWAY_2,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(17, LED_HOME_2,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT_PULLDOWN)  \
+                        X(16, BUZZER,         BOARD_ROLE_BUZZER,    BOARD_CNF_OUTPUT)           \
+                        X(15, COLUMN2,        BOARD_ROLE_SW_COLUMN, BOARD_CNF_OUTPUT)           \
+                        X(14, COLUMN1,        BOARD_ROLE_SW_COLUMN, BOARD_CNF_OUTPUT)           \
+                        X(13, LED_AWAY_4,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(12, LED_HOME_4,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(11, LED_AWAY_7,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X(10, LED_HOME_7,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 9, SW_ROW3,        BOARD_ROLE_SW_ROW,    BOARD_CNF_INPUT)            \
+                        X( 8, SW_ROW2,        BOARD_ROLE_SW_ROW,    BOARD_CNF_INPUT)            \
+                        X( 7, LED_AWAY_5,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 6, LED_HOME_5,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 5, LED_STATUS_RED, BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 4, LED_STATUS_YLW, BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 3, LED_STATUS_GRN, BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 2, LED_AWAY_8,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 1, LED_HOME_8,     BOARD_ROLE_LED,       BOARD_CNF_OUTPUT)           \
+                        X( 0, GND,            BOARD_ROLE_UNUSED,    BOARD_CNF_OUTPUT)
+
+/*                        LED         Pin             Active */
+#define ANTTT_BOARD_LEDS(X) \
+                        X(HOME1,      LED_HOME_1,     LED_ACTIVE_HIGH) \
+                        X(HOME2,      LED_HOME_2,     LED_ACTIVE_HIGH) \
+                        X(HOME3,      LED_HOME_3,     LED_ACTIVE_HIGH) \
+                        X(HOME4,      LED_HOME_4,     LED_ACTIVE_HIGH) \
+                        X(HOME5,      LED_HOME_5,     LED_ACTIVE_HIGH) \
+                        X(HOME6,      LED_HOME_6,     LED_ACTIVE_HIGH) \
+                        X(HOME7,      LED_HOME_7,     LED_ACTIVE_HIGH) \
+                        X(HOME8,      LED_HOME_8,     LED_ACTIVE_HIGH) \
+                        X(HOME9,      LED_HOME_9,     LED_ACTIVE_HIGH) \
+                        X(AWAY1,      LED_AWAY_1,     LED_ACTIVE_HIGH) \
+                        X(AWAY2,      LED_AWAY_2,     LED_ACTIVE_HIGH) \
+                        X(AWAY3,      LED_AWAY_3,     LED_ACTIVE_HIGH) \
+                        X(AWAY4,      LED_AWAY_4,     LED_ACTIVE_HIGH) \
+                        X(AWAY5,      LED_AWAY_5,     LED_ACTIVE_HIGH) \
+                        X(AWAY6,      LED_AWAY_6,     LED_ACTIVE_HIGH) \
+                        X(AWAY7,      LED_AWAY_7,     LED_ACTIVE_HIGH) \
+                        X(AWAY8,      LED_AWAY_8,     LED_ACTIVE_HIGH) \
+                        X(AWAY9,      LED_AWAY_9,     LED_ACTIVE_HIGH) \
+                        X(STATUS_RED, LED_STATUS_RED, LED_ACTIVE_HIGH) \
+                        X(STATUS_YLW, LED_STATUS_YLW, LED_ACTIVE_HIGH) \
+                        X(STATUS_GRN, LED_STATUS_GRN, LED_ACTIVE_HIGH)
+
+/* Pin numbers: BOARD_PIN_LED_HOME_1, BOARD_PIN_SW_ROW1, ... */
+#define BOARD_PIN_ENUM(pin, name, role, cnf)   BOARD_PIN_##name = (pin),
+typedef enum {ANTTT_BOARD_PINS(BOARD_PIN_ENUM)} BoardPinType;
+
+#define BOARD_MASK(name)                       ((u32)1 << BOARD_PIN_##name)
+
+/* Port bits of every pin with a role: ORed at compile time */
+#define BOARD_ROLE_MASK(sel)                   ((u32)(0 ANTTT_BOARD_PINS(BOARD_ROLE_BIT_##sel)))
+#define BOARD_ROLE_BIT_LED(p, n, r, c)         | (((r) == BOARD_ROLE_LED) ? ((u32)1 << (p)) : 0)
+#define BOARD_ROLE_BIT_SW_ROW(p, n, r, c)      | (((r) == BOARD_ROLE_SW_ROW) ? ((u32)1 << (p)) : 0)
+#define BOARD_ROLE_BIT_SW_COLUMN(p, n, r, c)   | (((r) == BOARD_ROLE_SW_COLUMN) ? ((u32)1 << (p)) : 0)
+
+#define BOARD_LED_MASK                         BOARD_ROLE_MASK(LED)
+#define BOARD_SW_ROW_MASK                      BOARD_ROLE_MASK(SW_ROW)
+#define BOARD_SW_COLUMN_MASK                   BOARD_ROLE_MASK(SW_COLUMN)
 
 
 
@@ -156,193 +275,18 @@ It is clocked from HFCLK.  To get the desired 1ms tick use a compare period of 0
 ##### GPIO setup values
 ***********************************************************************************************************************/
 
-/* Pin configuration (pg. 58) - Pins are set up using the PIN_CNF registers (one register per pin)
-*/
-#define P0_30_LED_HOME_3_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_29_LED_HOME_6_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_28_LED_AWAY_3_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_27_NC_CNF          ( (GPIO_PIN_CNF_DIR_Input        << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Connect    << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Pullup      << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_26_SW_ROW1_CNF     ( (GPIO_PIN_CNF_DIR_Input        << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Connect    << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_25_NC_CNF          ( (GPIO_PIN_CNF_DIR_Input        << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Connect    << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Pullup      << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_24_LED_AWAY_9_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_23_COLUMN3_CNF     ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_22_LED_HOME_9_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_21_LED_AWAY_6_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_20_LED_HOME_1_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_19_LED_AWAY_1_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_18_LED_AWAY_2_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_17_LED_HOME_2_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Pulldown    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_16_BUZZER_CNF      ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_15_COLUMN2_CNF     ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_14_COLUMN1_CNF     ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_13_LED_AWAY_4_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_12_LED_HOME_4_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_11_LED_AWAY_7_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_10_LED_HOME_7_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_09_SW_ROW3_CNF     ( (GPIO_PIN_CNF_DIR_Input        << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Connect    << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_08_SW_ROW2_CNF     ( (GPIO_PIN_CNF_DIR_Input        << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Connect    << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_07_LED_AWAY_5_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_06_LED_HOME_5_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_05_LED_STATUS_RED_CNF ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_04_LED_STATUS_YLW_CNF ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_03_LED_STATUS_GRN_CNF ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_02_LED_AWAY_8_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_01_LED_HOME_8_CNF  ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
-
-#define P0_00_GND_CNF         ( (GPIO_PIN_CNF_DIR_Output       << GPIO_PIN_CNF_DIR_Pos)   | \
-                                (GPIO_PIN_CNF_INPUT_Disconnect << GPIO_PIN_CNF_INPUT_Pos) | \
-                                (GPIO_PIN_CNF_PULL_Disabled    << GPIO_PIN_CNF_PULL_Pos)  | \
-                                (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
-                                (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
+/* Pin configuration (pg. 58) - Pins are set up using the PIN_CNF registers (one register per pin).  Each pin in
+ANTTT_BOARD_PINS uses one of these. */
+#define BOARD_CNF(dir, input, pull) ( (GPIO_PIN_CNF_DIR_##dir        << GPIO_PIN_CNF_DIR_Pos)   | \
+                                      (GPIO_PIN_CNF_INPUT_##input    << GPIO_PIN_CNF_INPUT_Pos) | \
+                                      (GPIO_PIN_CNF_PULL_##pull      << GPIO_PIN_CNF_PULL_Pos)  | \
+                                      (GPIO_PIN_CNF_DRIVE_S0S1       << GPIO_PIN_CNF_DRIVE_Pos) | \
+                                      (GPIO_PIN_CNF_SENSE_Disabled   << GPIO_PIN_CNF_SENSE_Pos) )
+
+#define BOARD_CNF_OUTPUT              BOARD_CNF(Output, Disconnect, Disabled)
+#define BOARD_CNF_OUTPUT_PULLDOWN     BOARD_CNF(Output, Disconnect, Pulldown)
+#define BOARD_CNF_INPUT               BOARD_CNF(Input,  Connect,    Disabled)
+#define BOARD_CNF_INPUT_PULLUP        BOARD_CNF(Input,  Connect,    Pullup)
 
                                 
                                 
@@ -396,8 +340,47 @@ It is clocked from HFCLK.  To get the desired 1ms tick use a compare period of 0
 
 
 
-
-#endif /* __ANTTT_H */
+/***********************************************************************************************************************
+$$$$$ PWM setup values
+***********************************************************************************************************************/
+/* Hardware LED PWM (leds_anttt.c)
+TIMER2 counts at 1MHz (prescaler 2^4) and clears itself at CC[3], giving a 1kHz PWM period.  Each GPIOTE channel n
+drives one LED pin in toggle mode: PPI channel 2n connects COMPARE[n] and PPI channel 2n+1 connects COMPARE[3] (end
+of the period) to TASKS_OUT[n].  Even channels start at the LED's on level and odd channels at its off level, so
+odd channels are lit at the end of the period and overlap the others as little as possible.  CC[0..2] are the duty
+edges, so three LEDs can be driven at once.  PPI channels 0-7 are free for the application under the ANT SoftDevice. */
+#define LED_HW_PWM_TIMER_PRESCALER  (u32)4                  /* 16MHz / 2^4 = 1MHz */
+#define LED_HW_PWM_TOP              (u16)1000               /* Counts per PWM period (1kHz) */
+#define LED_HW_PWM_PERIOD_CC        (u8)3                   /* TIMER2 CC register that ends the period */
+#define LED_HW_PWM_CHANNELS         (u8)3                   /* GPIOTE channels / TIMER2 duty CCs used */
+#define LED_HW_PWM_PPI_FIRST        (u8)0                   /* First of the 2 * LED_HW_PWM_CHANNELS PPI channels */
+#define LED_HW_PWM_PPI_MASK         (u32)(0x3F << LED_HW_PWM_PPI_FIRST)
+
+/* Bit-angle modulation (LED_BAM in configuration.h) uses TIMER2 instead, so it replaces hardware PWM.
+TIMER2 counts at 1MHz and clears itself at CC[0]; bit plane n is shown for LED_BAM_UNIT << n counts, so a frame of
+all 8 planes is 255 * 8us = 2.04ms (490Hz refresh) with 8 interrupts.  The shortest plane (8us = 128 cycles) must
+be longer than the handler's latency plus run time. */
+#define LED_BAM_TIMER_PRESCALER     (u32)4                  /* 16MHz / 2^4 = 1MHz */
+#define LED_BAM_UNIT                (u32)8                  /* Counts in bit plane 0 */
+#define LED_BAM_PLANES              (u8)8                   /* 8-bit levels */
+#define LED_BAM_IRQ_PRIORITY        (u32)1                  /* Application high priority */
+
+/* The 1ms tick (TIMER1_IRQHandler()) runs below BAM so it adds no jitter to plane 0, and clear of the levels the
+SoftDevice reserves */
+#define TIMER1_IRQ_PRIORITY         (u32)3                  /* Application low priority */
+
+/* Brightness calibration for LedSetBrightness() (leds_anttt.c), one scale per LED in LedNumberType order: the gamma
+duty is multiplied by (scale + 1) / 256.  Lower the scale of any LED that looks brighter than the others at the same
+brightness; 255 leaves it as it is.  Boards measured otherwise can override it in configuration.h. */
+#ifndef LED_CALIBRATION
+#define LED_CALIBRATION { 255, 255, 255, 255, 255, 255, 255, 255, 255,                  /* HOME1-HOME9 */ \
+                          255, 255, 255, 255, 255, 255, 255, 255, 255,                  /* AWAY1-AWAY9 */ \
+                          255, 255, 255 }                                               /* RED, YLW, GRN */
+#endif
+
+
+
+#endif /* __ANTTT_EHDW_04_H */
 
 
 
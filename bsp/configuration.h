@@ -20,6 +20,15 @@ Bookmarks:
 /**********************************************************************************************************************
 Runtime Switches
 ***********************************************************************************************************************/
+//#define ANTTT_BENCHMARK                             /* Define to run the game core cycle benchmark in AntttInitialize() */
+//#define ANTTT_TABLE_FULL                            /* Define to use the 3^9 entry AI table instead of the canonical one */
+#define ANTTT_HASH_TABLE_BYTES        1024            /* RAM for the search's transposition table (8 bytes per entry) */
+//#define LED_HW_PWM_LEDS             0               /* Define as a mask of LedNumberType bits that may use hardware PWM */
+//#define LED_TICKLESS                                /* Define to schedule LED edges from a deadline heap instead of per-tick counters */
+//#define LED_MAX_LIT                 (u32)10         /* Define as a current budget: most GPIO-driven LEDs lit at once (more are time-multiplexed) */
+//#define LED_PHASE_STEP_MS         (u16)1          /* Define as the start offset per LED so wave edges land on different ticks */
+//#define LED_BAM                                     /* Define for 8-bit LedSetLevel() on all LEDs (takes TIMER2 from hardware PWM) */
+//#define SYSTEM_LOW_POWER                            /* Define to tick from RTC1 on the calibrated RC LFCLK and stop the crystal */
 
 /**********************************************************************************************************************
 Type Definitions
@@ -47,6 +56,7 @@ Includes
 #include "nrf_delay.h"
 #include "nrf_error.h"
 #include "nrf_soc.h"
+#include "nrf_temp.h"
 #include "nrf_sdm.h"
 
 #include "ant_interface.h"
@@ -63,9 +73,9 @@ Includes
 //#include "soc_integration.h"
 
 /* MPG nRF51422 implementation headers */
+#include "typedefs.h"
 #include "interrupts.h"
 #include "main.h"
-#include "typedefs.h"
 #include "utilities.h"
 
 #include "anttt-ehdw-04.h"
@@ -74,6 +84,14 @@ Includes
 #include "leds_anttt.h" 
 
 /* Application header files */
+#include "anttt.h"
+#include "anttt_symmetry.h"
+#include "anttt_journal.h"
+#include "anttt_hash.h"
+#include "anttt_search.h"
+#include "anttt_mnk.h"
+#include "anttt_mcts.h"
+#include "anttt_load.h"
 
 
 /**********************************************************************************************************************
@@ -35,6 +35,11 @@ Global variable definitions with scope limited to this local application.
 Variable names shall start with "Interrupts_" and be declared as static.
 ***********************************************************************************************************************/
 static u32 Interrupts_u32Timeout;                     /* Timeout counter used across states */
+static u32 Interrupts_u32MsInSecond;                  /* 1ms ticks counted towards the next G_u32SystemTime1s */
+#ifdef SYSTEM_LOW_POWER
+static u32 Interrupts_u32RtcCarry;                    /* Thousandths of an RTC count carried to the next tick */
+static u32 Interrupts_u32RtcSkipped;                  /* Ticks skipped by the pending compare */
+#endif /* SYSTEM_LOW_POWER */
 
 
 /**********************************************************************************************************************
@@ -59,6 +64,68 @@ void InterruptsInitialize(void)
 } /* end InterruptsInitialize() */
 
 
+/*--------------------------------------------------------------------------------------------------------------------
+Function: InterruptsMsToNextSecond
+
+Description:
+Reports how far the system tick is from the next G_u32SystemTime1s increment.
+
+Requires:
+  -
+
+Promises:
+  - Returns the ticks until G_u32SystemTime1s next goes up (1 to 1000)
+*/
+u32 InterruptsMsToNextSecond(void)
+{
+  return(1000 - Interrupts_u32MsInSecond);
+
+} /* end InterruptsMsToNextSecond() */
+
+
+#ifdef SYSTEM_LOW_POWER
+/*--------------------------------------------------------------------------------------------------------------------
+Function: InterruptsRtcWakeAt
+
+Description:
+Moves the pending RTC1 compare from the next tick out to the tick at which G_u32SystemTime1ms reaches u32WakeMs_,
+so SystemSleep() is not woken by the ticks in between; RTC1_IRQHandler() counts them all when the compare fires.
+The compare lands exactly where the ticks one by one would have put it: N ticks are N * 32 counts plus the carried
+thousandths of N * 768.  Nothing is moved if the pending compare is too close to COUNTER to be changed safely.
+
+Requires:
+  - Called from the main loop with SYSTEM_LOW_POWER, before sleeping
+  - u32WakeMs_ is less than 2^31 ms away
+
+Promises:
+  - If u32WakeMs_ is past the next tick and the compare could be moved, CC[0] is at tick u32WakeMs_
+*/
+void InterruptsRtcWakeAt(u32 u32WakeMs_)
+{
+  u32 u32Ticks;
+  u32 u32Lead;
+  u32 u32Carry;
+  
+  __disable_irq();
+  
+  /* Every tick so far has been counted, so the pending compare is tick G_u32SystemTime1ms + 1 */
+  u32Ticks = u32WakeMs_ - G_u32SystemTime1ms - 1;
+  u32Lead = (NRF_RTC1->CC[0] - NRF_RTC1->COUNTER) & RTC_COUNTER_MASK;
+  if( ((s32)u32Ticks > 0) && (Interrupts_u32RtcSkipped == 0) && !NRF_RTC1->EVENTS_COMPARE[0] &&
+      (u32Lead >= RTC_MIN_LEAD) && (u32Lead <= (RTC_COUNTER_MASK >> 1)) )
+  {
+    u32Carry = Interrupts_u32RtcCarry + (u32Ticks * RTC_CARRY_PER_MS);
+    NRF_RTC1->CC[0] = (NRF_RTC1->CC[0] + (u32Ticks * RTC_COUNTS_PER_MS) + (u32Carry / 1000)) & RTC_COUNTER_MASK;
+    Interrupts_u32RtcCarry = u32Carry % 1000;
+    Interrupts_u32RtcSkipped = u32Ticks;
+  }
+  
+  __enable_irq();
+
+} /* end InterruptsRtcWakeAt() */
+#endif /* SYSTEM_LOW_POWER */
+
+
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Handlers                                                                                                  */
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -73,10 +140,104 @@ void HardFault_Handler(u32 u32ProgramCounter_, u32 u32LinkRegister_)
 }
 
 
+/*--------------------------------------------------------------------------------------------------------------------
+Function: InterruptsSystemTick
+
+Description:
+Counts 1ms system ticks for whichever timer provides them: one per interrupt, or all the ticks a sleep skipped
+(InterruptsRtcWakeAt()) at once.
+
+Requires:
+  - Called from the tick interrupt only
+  - u32Ticks_ is 1 or more
+
+Promises:
+  - G_u32SystemTime1ms is advanced by u32Ticks_; G_u32SystemTime1s is incremented for every 1000 ticks
+  - _SYSTEM_SLEEPING is cleared in G_u32SystemFlags
+*/
+void InterruptsSystemTick(u32 u32Ticks_)
+{
+  G_u32SystemTime1ms += u32Ticks_;
+  Interrupts_u32MsInSecond += u32Ticks_;
+  while(Interrupts_u32MsInSecond >= 1000)
+  {
+    Interrupts_u32MsInSecond -= 1000;
+    G_u32SystemTime1s++;
+  }
+  
+  G_u32SystemFlags &= ~_SYSTEM_SLEEPING;
+
+} /* end InterruptsSystemTick() */
+
+
+#ifdef SYSTEM_LOW_POWER
+/*--------------------------------------------------------------------------------------------------------------------
+Function: RTC1_IRQHandler
+
+Description:
+The 1ms system tick from RTC1 (SYSTEM_LOW_POWER).  Each compare is moved on by RTC_COUNTS_PER_MS counts plus the
+carried fraction, so tick n is at n * 32768 / 1000 counts with no drift.  A compare already passed (or too close to
+fire) is counted at once rather than waiting for the 24-bit counter to wrap.  A compare that InterruptsRtcWakeAt()
+moved out counts the ticks it skipped as well.
+
+Requires:
+  - SysTickSetup() has started RTC1 with CC[0] at the first tick
+
+Promises:
+  - One tick is counted for every compare reached and CC[0] holds the next one
+*/
+void RTC1_IRQHandler(void)
+{
+  u32 u32Deadline;
+  u32 u32Lead;
+  
+  NRF_RTC1->EVENTS_COMPARE[0] = 0;
+  (void)NRF_RTC1->EVENTS_COMPARE[0];
+  
+  do
+  {
+    InterruptsSystemTick(1 + Interrupts_u32RtcSkipped);
+    Interrupts_u32RtcSkipped = 0;
+    
+    u32Deadline = NRF_RTC1->CC[0] + RTC_COUNTS_PER_MS;
+    Interrupts_u32RtcCarry += RTC_CARRY_PER_MS;
+    if(Interrupts_u32RtcCarry >= 1000)
+    {
+      Interrupts_u32RtcCarry -= 1000;
+      u32Deadline++;
+    }
+    u32Deadline &= RTC_COUNTER_MASK;
+    NRF_RTC1->CC[0] = u32Deadline;
+    
+    u32Lead = (u32Deadline - NRF_RTC1->COUNTER) & RTC_COUNTER_MASK;
+  } while( (u32Lead < RTC_MIN_LEAD) || (u32Lead > (RTC_COUNTER_MASK >> 1)) );
+  
+} /* end RTC1_IRQHandler() */
+#endif /* SYSTEM_LOW_POWER */
+
+
+/*--------------------------------------------------------------------------------------------------------------------
+Function: TIMER1_IRQHandler
+
+Description:
+The 1ms system tick.  TIMER1 clears itself on COMPARE0 (SysTickSetup()), so the handler only acknowledges the event
+and counts the tick, which also wakes SystemSleep().
+
+Requires:
+  - SysTickSetup() has enabled the COMPARE0 interrupt
+
+Promises:
+  - One tick is counted (InterruptsSystemTick())
+*/
 void TIMER1_IRQHandler(void)
 { 
-  while(1);
-}
+  /* Clear the event (and read it back so the write completes before the handler returns) */
+  NRF_TIMER1->EVENTS_COMPARE[0] = 0;
+  (void)NRF_TIMER1->EVENTS_COMPARE[0];
+  
+  InterruptsSystemTick(1);
+  
+} /* end TIMER1_IRQHandler() */
 
 
 
@@ -73,11 +73,16 @@ Function Declarations
 /* Protected functions                                                                                                */
 /*--------------------------------------------------------------------------------------------------------------------*/
 void InterruptsInitialize(void);
+u32 InterruptsMsToNextSecond(void);
+#ifdef SYSTEM_LOW_POWER
+void InterruptsRtcWakeAt(u32 u32WakeMs_);
+#endif /* SYSTEM_LOW_POWER */
 
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* Private functions                                                                                                  */
 /*--------------------------------------------------------------------------------------------------------------------*/
+void InterruptsSystemTick(u32 u32Ticks_);
 
 
 
@@ -7,6 +7,64 @@ The basic on/off/toggle functionality is applied directly to the LEDs.
 Blinking and PWMing of LEDs rely on a 1ms system tick to provide timing at
 regular 1ms calls to LedUpdate().
 
+Blink and PWM are the same square wave with different on and off phase lengths.  The logical state of every LED is
+one bit in Led_u32On, the shadow of the LED pins: no LED change reads the port back or writes the whole of OUT, so
+the column and buzzer pins on the same port are never disturbed.  The LEDs with a running wave are the bits in
+Led_u32Animated, so LedUpdate() only visits those.  Each tick it collects the pins that turn on and off into two
+masks and writes them with one OUTSET and one OUTCLR, whatever the number of LEDs that changed.  Active-low LEDs are
+handled by swapping their pins between the two writes (LED_ACTIVE_LOW_PINS, a constant from the board description)
+instead of a branch per LED.  0% and 100% PWM are steady and cost nothing per tick.
+The cost of every call is measured with TIMER1 captures and kept in Led_sStats (LedGetStats()).
+
+LedPWM() on one of the LED_HW_PWM_LEDS first tries a hardware channel: TIMER2, PPI and GPIOTE toggle the pin at 1kHz
+with no CPU and no interrupts (see "PWM setup values" in the board header).  There are LED_HW_PWM_CHANNELS channels;
+when they are all taken, or for any other LED, LedPWM() falls back to the software wave.  Any other call on the LED
+(on, off, toggle, blink, 0% or 100%) hands its channel back.
+
+With LED_TICKLESS defined, LedUpdate() keeps the time of the next edge of every blinking/PWM LED and every timeline
+in a small binary min-heap (Led_asHeap) instead of counting each one down every tick.  A tick with nothing due is
+one compare against the top of the heap; LedMsToNextEdge() tells the sleep code how long it can stay down.  That only
+saves ticks when the other task rows in main.c report a deadline too, since SystemSleep() wakes for the earliest.  Both
+modes count the ticks that need LED work (wake-ups) and estimate the current those wake-ups cost (LedGetStats()).
+
+Every LED switched on adds to the current drawn from the coin cell, and LEDs that switch together add their edges
+too.  LedCommit() counts the GPIO-driven LEDs that are lit and, when there are more than LED_MAX_LIT
+(configuration.h, all of them unless a board defines a budget), lights a different LED_MAX_LIT of them on each tick
+in turn, so each is dimmed to LED_MAX_LIT / lit instead of the cell seeing the full peak.  Blink and PWM waves can
+start LED_PHASE_STEP_MS per LED apart (configuration.h, in phase unless a board defines a step), so LEDs set up
+together (e.g. a board of 4Hz blinks) switch on different ticks; a wave that is already running keeps its phase
+when only its rate changes.  Odd hardware PWM channels are lit at the end of the period instead of the start.  The
+peak number of LEDs lit at once is in LedGetStats().
+
+LedSetBrightness() takes a perceived brightness (0-255) rather than a duty: Led_au8Gamma[] maps it to a duty on a
+2.2 gamma curve and the LED's calibration factor (LED_CALIBRATION in the board header, LedSetCalibration()) scales
+it so LEDs that are brighter than their neighbours can be matched, all with table lookups, a multiply and a shift.
+LedFade() moves the brightness to a target over a number of ms from LedUpdate(): each tick adds the distance to an
+error term and steps one level each time it passes the duration (Bresenham), so the steps are spread evenly with no
+divide.  The LED is only reprogrammed when the step changes what it shows.
+
+Code that should not be overwritten by the game's LED calls draws in a compositor layer instead: LedLayerSet() gives a
+layer (LED_LAYER_BOARD < LED_LAYER_HIGHLIGHT < LED_LAYER_STATUS < LED_LAYER_OVERLAY) a mask of LEDs it covers and
+their states.  Each LED shows the highest layer that covers it, or its own state from the calls above if none does.
+A layer change blends all the layers into a back buffer straight away; LedUpdate() swaps it in and writes the
+changed pins only at the next LED_FRAME_TICKS boundary (the software PWM period), so changes made together appear
+together.  Ticks with no layer change skip all of this.
+
+Animations are keyframe timelines kept in flash (LedTimelineType, e.g. G_sLedTimelineBoot).  LedPlay() starts
+one on a set of LEDs in one of LED_TIMELINE_SLOTS slots and LedUpdate() counts down only the current frame of each
+slot, so a tick costs the same however long the timeline is.  Any direct call on an LED (LedOn(), LedBlink(), ...)
+or a newer LedPlay() takes it out of the timeline it was in.  LedPlayLayer() plays a timeline into a compositor
+layer instead, so it shows over whatever the LEDs are doing underneath and direct calls leave it running; its frames
+are shown at the layer's frame boundaries.  Nothing in the driver waits in a delay loop.
+
+With LED_BAM defined, LedSetLevel() gives any LED 256 levels by bit-angle modulation: TIMER2 interrupts at the end
+of each of 8 bit planes and the handler writes that plane's precomputed OUTSET and OUTCLR masks, so its cost is the
+same however many LEDs are lit.  Plane n lasts 2^n units of 8us: a 2.04ms frame (490Hz) of 8 interrupts.  Each
+interrupt is roughly 16 cycles of entry, 16 of exit and about 30 of body, so ~500 cycles per 32640 cycle frame, or
+1.5% of the CPU while any LED has a level; the timer is stopped when none do.  The achieved numbers are in
+LedGetStats() (u32BamFrames per second and the timed handler cycles).  Without LED_BAM, LedSetLevel() rounds the
+level to the nearest LedPWM() step.
+
 ------------------------------------------------------------------------------------------------------------------------
 API:
 LedNumberType: BLUE, GREEN, YELLOW, RED
@@ -30,6 +88,16 @@ void LedToggle(LedNumberType eLED_)
 Toggle the specified LED.  LED response is immediate.
 e.g. LedToggle(BLUE);
 
+void LedGroupOn(u32 u32Leds_)
+void LedGroupOff(u32 u32Leds_)
+void LedGroupToggle(u32 u32Leds_)
+Turn on, off or toggle a mask of LEDs (LED_BIT(), LED_HOME_MASK, ...) at once.
+e.g. LedGroupOn(LED_BIT(HOME1) | LED_BIT(HOME5) | LED_BIT(HOME9));
+
+void LedShowBoard(u16 u16Home_, u16 u16Away_)
+Draw all HOME and AWAY LEDs from two 9-bit cell masks.
+e.g. LedShowBoard(0x111, 0x044);
+
 void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_)
 Sets up an LED for PWM mode.  PWM mode requries the main loop to be running at 1ms period.
 e.g. LedPWM(BLUE, LED_PWM_5);
@@ -38,6 +106,48 @@ void LedBlink(LedNumberType eLED_, LedRateType eBlinkRate_)
 Sets an LED to BLINK mode.  BLINK mode requries the main loop to be running at 1ms period.
 e.g. LedBlink(BLUE, LED_1HZ);
 
+void LedSetLevel(LedNumberType eLED_, u8 u8Level_)
+Sets an LED to one of 256 brightness levels (BAM with LED_BAM, else the nearest PWM step).
+e.g. LedSetLevel(HOME5, 40);
+
+void LedSetBrightness(LedNumberType eLED_, u8 u8Brightness_)
+Sets an LED to a perceived brightness (0 = off, 255 = full), gamma corrected and calibrated.
+e.g. LedSetBrightness(HOME5, 128);
+
+void LedFade(LedNumberType eLED_, u8 u8Target_, u16 u16Ms_)
+Fades an LED from its current brightness to u8Target_ over u16Ms_ ms.
+e.g. LedFade(STATUS_GRN, 0, 500);
+
+void LedSetCalibration(LedNumberType eLED_, u8 u8Scale_)
+Sets the LED's brightness scale (255 = as is) for LEDs that look brighter than the others.
+
+void LedLayerSet(LedLayerType eLayer_, u32 u32Leds_, u32 u32On_)
+Draws a layer: it covers the LEDs in u32Leds_ and lights those also in u32On_.  Shown at the next frame boundary.
+e.g. LedLayerSet(LED_LAYER_STATUS, LED_STATUS_MASK, LED_BIT(STATUS_GRN));
+
+void LedLayerClear(LedLayerType eLayer_)
+Makes a layer transparent again.
+
+const LedStatsType* LedGetStats(void)
+Cycles taken by LedUpdate(): last, worst and total over all calls.
+
+bool LedPlay(const LedTimelineType* psTimeline_, u32 u32Leds_)
+Plays a timeline on a mask of LEDs (LED_BIT(), LED_HOME_MASK, ...).  Returns false if every slot is busy.
+e.g. LedPlay(&G_sLedTimelineWinLine, LED_BIT(HOME1) | LED_BIT(HOME5) | LED_BIT(HOME9));
+
+bool LedPlayLayer(const LedTimelineType* psTimeline_, LedLayerType eLayer_, u32 u32Leds_)
+Plays a timeline in a compositor layer, replacing what the layer drew.  LedLayerSet() or LedLayerClear() stops it.
+e.g. LedPlayLayer(&G_sLedTimelineWaiting, LED_LAYER_STATUS, LED_BIT(STATUS_RED));
+
+void LedStop(u32 u32Leds_)
+Stops timelines on a mask of LEDs, leaving them as they are.
+
+bool LedIsPlaying(u32 u32Leds_)
+Returns true while any of the LEDs is in a running timeline.
+
+u32 LedMsToNextEdge(void)
+Milliseconds until the next LED change, or LED_NO_EDGE when nothing is animated.
+
 Protected:
 void LedInitialize(void)
 Test all LEDs and initialize to OFF state.
@@ -58,6 +168,42 @@ All Global variable names shall start with "G_xxLed"
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* New variables (all shall start with G_xxLed*/
 
+/* Timelines for LedPlay().  Frames that light "every LED" (LED_ALL_MASK) light whichever LEDs they are played on. */
+static const LedKeyframeType Led_asBootFrames[] =
+{
+  {LED_BIT(HOME1) | LED_BIT(AWAY1) | LED_BIT(AWAY5), 80},
+  {LED_BIT(HOME2) | LED_BIT(AWAY4) | LED_BIT(HOME5), 80},
+  {LED_BIT(HOME3) | LED_BIT(AWAY7) | LED_BIT(AWAY5), 80},
+  {LED_BIT(HOME6) | LED_BIT(AWAY8) | LED_BIT(HOME5), 80},
+  {LED_BIT(HOME9) | LED_BIT(AWAY9) | LED_BIT(AWAY5), 80},
+  {LED_BIT(HOME8) | LED_BIT(AWAY6) | LED_BIT(HOME5), 80},
+  {LED_BIT(HOME7) | LED_BIT(AWAY3) | LED_BIT(AWAY5), 80},
+  {LED_BIT(HOME4) | LED_BIT(AWAY2) | LED_BIT(HOME5), 80},
+};
+
+static const LedKeyframeType Led_asBlinkFrames[] =
+{
+  {LED_ALL_MASK, 250},
+  {0,            250},
+};
+
+static const LedKeyframeType Led_asDrawFrames[] =
+{
+  {0,            150},
+  {LED_ALL_MASK, 150},
+};
+
+static const LedKeyframeType Led_asWaitingFrames[] =
+{
+  {LED_ALL_MASK, 100},
+  {0,            900},
+};
+
+const LedTimelineType G_sLedTimelineBoot    = {Led_asBootFrames,    8, 0, 3};                     /* Ring chase, 1.9s */
+const LedTimelineType G_sLedTimelineWinLine = {Led_asBlinkFrames,   2, 0, LED_TIMELINE_FOREVER};  /* 2Hz blink */
+const LedTimelineType G_sLedTimelineDraw    = {Led_asDrawFrames,    2, 0, 3};                     /* 3 flashes, ends on */
+const LedTimelineType G_sLedTimelineWaiting = {Led_asWaitingFrames, 2, 0, LED_TIMELINE_FOREVER};  /* Heartbeat */
+
 
 /*--------------------------------------------------------------------------------------------------------------------*/
 /* External global variables defined in other files (must indicate which file they are defined in) */
@@ -71,39 +217,84 @@ extern volatile u32 G_u32ApplicationFlags;             /* From main.c */
 Global variable definitions with scope limited to this local application.
 Variable names shall start with "Led_" and be declared as static.
 ***********************************************************************************************************************/
-/* LED locations: order must correspond to the order set in LedNumberType in the header file. */
-static u32 Led_au32BitPositions[] = {P0_20_LED_HOME_1, P0_17_LED_HOME_2, P0_30_LED_HOME_3, P0_12_LED_HOME_4, P0_06_LED_HOME_5, 
-                                     P0_29_LED_HOME_6, P0_10_LED_HOME_7, P0_01_LED_HOME_8, P0_22_LED_HOME_9, 
-                                     P0_19_LED_AWAY_1, P0_18_LED_AWAY_2, P0_28_LED_AWAY_3, P0_13_LED_AWAY_4, P0_07_LED_AWAY_5, 
-                                     P0_21_LED_AWAY_6, P0_11_LED_AWAY_7, P0_02_LED_AWAY_8, P0_24_LED_AWAY_9,
-                                     P0_05_LED_STATUS_RED, P0_04_LED_STATUS_YLW, P0_03_LED_STATUS_GRN};
+/* Perceived brightness to duty (gamma 2.2, rounded; every non-zero level stays lit) */
+static const u8 Led_au8Gamma[256] =
+{
+  0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
+  1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,   2,   2,   2,
+  3,   3,   3,   3,   3,   4,   4,   4,   4,   5,   5,   5,   5,   6,   6,   6,
+  6,   7,   7,   7,   8,   8,   8,   9,   9,   9,  10,  10,  11,  11,  11,  12,
+  12,  13,  13,  13,  14,  14,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,
+  20,  20,  21,  22,  22,  23,  23,  24,  25,  25,  26,  26,  27,  28,  28,  29,
+  30,  30,  31,  32,  33,  33,  34,  35,  35,  36,  37,  38,  39,  39,  40,  41,
+  42,  43,  43,  44,  45,  46,  47,  48,  49,  49,  50,  51,  52,  53,  54,  55,
+  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67,  68,  69,  70,  71,
+  73,  74,  75,  76,  77,  78,  79,  81,  82,  83,  84,  85,  87,  88,  89,  90,
+  91,  93,  94,  95,  97,  98,  99, 100, 102, 103, 105, 106, 107, 109, 110, 111,
+  113, 114, 116, 117, 119, 120, 121, 123, 124, 126, 127, 129, 130, 132, 133, 135,
+  137, 138, 140, 141, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158, 159, 161,
+  163, 165, 166, 168, 170, 172, 173, 175, 177, 179, 181, 182, 184, 186, 188, 190,
+  192, 194, 196, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+  223, 225, 227, 229, 231, 234, 236, 238, 240, 242, 244, 246, 248, 251, 253, 255,
+};
+
+/* LED pin tables, generated from ANTTT_BOARD_LEDS in the board header (LedNumberType order) */
+#define LED_PIN_MASK(led, pin, active)      BOARD_MASK(pin),
+#define LED_PIN_NUMBER(led, pin, active)    (u8)BOARD_PIN_##pin,
+#define LED_CONFIG(led, pin, active)        {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_100, 0, active},
+
+static const u32 Led_au32BitPositions[TOTAL_LEDS] = {ANTTT_BOARD_LEDS(LED_PIN_MASK)};   /* Port bit of each LED */
+static const u8 Led_au8PinNumbers[TOTAL_LEDS] = {ANTTT_BOARD_LEDS(LED_PIN_NUMBER)};     /* Port pin of each LED */
 
 /* Control array for all LEDs in system initialized for LedInitialize().  Array values correspond to LedConfigType fields: 
-     eMode         eRate      u16Count       eCurrentDuty     eActiveState     ePort      LedNumberType */
-static LedConfigType Leds_asLedArray[TOTAL_LEDS] = 
-{
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*        */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*       */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*         */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*        */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*        */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*       */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*       */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*        */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*       */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*        */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*       */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*        */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*       */
- {LED_NORMAL_MODE, LED_PWM_100, LED_PWM_100, LED_PWM_DUTY_HIGH, LED_ACTIVE_HIGH}, /*        */
-};   
+     eMode         eRate      u16Count    u16OnTicks   u16OffTicks  eActiveState */
+static LedConfigType Leds_asLedArray[TOTAL_LEDS] = {ANTTT_BOARD_LEDS(LED_CONFIG)};
+
+static u32 Led_u32On;                                    /* Bit n set while LED n is lit (LedNumberType order) */
+static u32 Led_u32Animated;                              /* Bit n set while LED n blinks or PWMs */
+
+static u32 Led_u32HwPwm;                                 /* Bit n set while LED n is on a hardware PWM channel */
+static u8 Led_au8HwPwmLed[LED_HW_PWM_CHANNELS];          /* LED on each GPIOTE channel, or LED_HW_PWM_FREE */
+static u16 Led_au16HwPwmCounts[LED_HW_PWM_CHANNELS];     /* On time of each channel in TIMER2 counts */
+
+#ifdef LED_BAM
+static u32 Led_u32Bam;                                   /* Bit n set while LED n is driven by BAM */
+static LedBamPlaneType Led_asBamPlanes[LED_BAM_PLANES];  /* Port masks for each bit plane */
+static volatile u8 Led_u8BamPlane;                       /* Plane being shown */
+#endif /* LED_BAM */
+
+static u32 Led_u32Timeline;                              /* Bit n set while LED n is in a timeline slot */
+static u8 Led_u8LayerTimelines;                          /* Bit n set while layer n plays a timeline */
+static LedTimelineSlotType Led_asTimelines[LED_TIMELINE_SLOTS];  /* Timelines being played */
+
+static u32 Led_u32NowMs;                                 /* G_u32SystemTime1ms at the last LedUpdate() */
+
+#ifdef LED_TICKLESS
+static LedDeadlineType Led_asHeap[LED_HEAP_SIZE];        /* Min-heap of next edges, earliest at [0] */
+static u8 Led_u8HeapCount;                               /* Entries in Led_asHeap */
+static u8 Led_au8HeapIndex[LED_HEAP_SIZE];               /* Position of each id in Led_asHeap, or LED_HEAP_NONE */
+#endif /* LED_TICKLESS */
+
+static bool Led_bBudgetMux;                              /* TRUE while more than LED_MAX_LIT LEDs are lit */
+static u8 Led_u8BudgetFirst;                             /* LED to take first in the next multiplexed tick */
+static u8 Led_u8BudgetNext;                              /* LED after the last one lit by the budget */
+
+static u8 Led_au8Calibration[TOTAL_LEDS] = LED_CALIBRATION;  /* Duty scale of each LED (255 = as is) */
+static u8 Led_au8Brightness[TOTAL_LEDS];                 /* Perceived brightness last shown on each LED */
+static u32 Led_u32Fading;                                /* Bit n set while LED n is fading */
+static LedFadeType Led_asFades[TOTAL_LEDS];              /* Fade progress of each LED */
+
+static LedLayerContentType Led_asLayers[LED_LAYERS];     /* What each layer draws */
+static LedLayerContentType Led_sLayerBack;               /* All layers blended, waiting for the frame boundary */
+static LedLayerContentType Led_sLayerFront;              /* Blend being shown */
+static u32 Led_u32LayerPins;                             /* Port pins of the LEDs covered in Led_sLayerFront */
+static bool Led_bLayersDirty;                            /* TRUE while Led_sLayerBack differs from what is shown */
+static u32 Led_u32FrameMs;                               /* Led_u32NowMs at which the next layer frame starts */
+
+static u16 Led_u16WindowTicks;                           /* Ticks into the current wake-up window */
+static u32 Led_u32WindowWakeups;                         /* Wake-ups so far in the current window */
+
+static LedStatsType Led_sStats;                          /* LedUpdate() timing for the debugger */
  
 
 /***********************************************************************************************************************
@@ -132,18 +323,14 @@ Promises:
 */
 void LedOn(LedNumberType eLED_)
 {
-
-  if(Leds_asLedArray[eLED_].eActiveState == LED_ACTIVE_HIGH)
-  {
-    NRF_GPIO->OUTSET = Led_au32BitPositions[eLED_];
-  }
-  else
-  {
-    NRF_GPIO->OUTCLR = Led_au32BitPositions[eLED_];
-  }
+  Led_u32On |= (u32)1 << eLED_;
+  LedRelease(eLED_);
+  LedCommit(Led_au32BitPositions[eLED_], 0);
   
   /* Always set the LED back to LED_NORMAL_MODE mode */
-	Leds_asLedArray[(u8)eLED_].eMode = LED_NORMAL_MODE;
+  Leds_asLedArray[(u8)eLED_].eMode = LED_NORMAL_MODE;
+  LedWaveStop( LED_BIT(eLED_) );
+  Led_au8Brightness[(u8)eLED_] = 0xFF;
 
 } /* end LedOn() */
 
@@ -165,17 +352,14 @@ Promises:
 */
 void LedOff(LedNumberType eLED_)
 {
-  if(Leds_asLedArray[eLED_].eActiveState == LED_ACTIVE_HIGH)
-  {
-    NRF_GPIO->OUTCLR = Led_au32BitPositions[eLED_];
-  }
-  else
-  {
-    NRF_GPIO->OUTSET = Led_au32BitPositions[eLED_];
-  }
+  Led_u32On &= ~((u32)1 << eLED_);
+  LedRelease(eLED_);
+  LedCommit(0, Led_au32BitPositions[eLED_]);
 
   /* Always set the LED back to LED_NORMAL_MODE mode */
-	Leds_asLedArray[(u8)eLED_].eMode = LED_NORMAL_MODE;
+  Leds_asLedArray[(u8)eLED_].eMode = LED_NORMAL_MODE;
+  LedWaveStop( LED_BIT(eLED_) );
+  Led_au8Brightness[(u8)eLED_] = 0;
   
 } /* end LedOff() */
 
@@ -195,15 +379,87 @@ Promises:
 */
 void LedToggle(LedNumberType eLED_)
 {
-  u32 u32Current_Leds;
-  
-  u32Current_Leds = NRF_GPIO->IN;
-  u32Current_Leds ^= Led_au32BitPositions[eLED_];
-  NRF_GPIO->OUT = u32Current_Leds;
+  LedGroupToggle( LED_BIT(eLED_) );
                                             
 } /* end LedToggle() */
 
 
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedGroupOn
+
+Description:
+Turns a set of LEDs on together.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - Every LED in u32Leds_ is on in LED_NORMAL_MODE, changed with one OUTSET and one OUTCLR write (LedGroupWrite())
+*/
+void LedGroupOn(u32 u32Leds_)
+{
+  LedGroupWrite(u32Leds_, LED_ALL_MASK);
+
+} /* end LedGroupOn() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedGroupOff
+
+Description:
+Turns a set of LEDs off together.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - Every LED in u32Leds_ is off in LED_NORMAL_MODE, changed with one OUTSET and one OUTCLR write (LedGroupWrite())
+*/
+void LedGroupOff(u32 u32Leds_)
+{
+  LedGroupWrite(u32Leds_, 0);
+
+} /* end LedGroupOff() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedGroupToggle
+
+Description:
+Toggles a set of LEDs together.  The new state comes from the shadow (Led_u32On), not from reading the port back.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - Every LED in u32Leds_ is in the opposite state to the one it was showing, in LED_NORMAL_MODE
+*/
+void LedGroupToggle(u32 u32Leds_)
+{
+  LedGroupWrite(u32Leds_, ~Led_u32On);
+
+} /* end LedGroupToggle() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedShowBoard
+
+Description:
+Draws a whole board: the HOME LEDs from one cell mask and the AWAY LEDs from another.
+
+Requires:
+  - Bit n of u16Home_ / u16Away_ is cell n (HOME1+n / AWAY1+n); bits 9-15 are ignored
+
+Promises:
+  - All 18 HOME and AWAY LEDs are set in LED_NORMAL_MODE with one OUTSET and one OUTCLR write
+*/
+void LedShowBoard(u16 u16Home_, u16 u16Away_)
+{
+  LedGroupWrite(LED_HOME_MASK | LED_AWAY_MASK, ((u32)u16Home_ << HOME1) | ((u32)u16Away_ << AWAY1));
+
+} /* end LedShowBoard() */
+
+
 /*----------------------------------------------------------------------------------------------------------------------
 Function: LedPWM
 
@@ -217,13 +473,23 @@ Requires:
 
 Promises:
   - Requested LED is set to PWM mode at the duty cycle specified
+  - If the LED is in LED_HW_PWM_LEDS and a hardware channel is free (or already its own), the duty is generated by
+    TIMER2/GPIOTE at 1kHz; otherwise the software wave starts with the on phase
+  - LED_PWM_0 and LED_PWM_100 leave the LED steady off or on with no work in LedUpdate()
 */
 void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_)
 {
-	Leds_asLedArray[(u8)eLED_].eMode = LED_PWM_MODE;
-	Leds_asLedArray[(u8)eLED_].eRate = ePwmRate_;
-	Leds_asLedArray[(u8)eLED_].u16Count = (u16)ePwmRate_;
-  Leds_asLedArray[(u8)eLED_].eCurrentDuty = LED_PWM_DUTY_HIGH;
+  if( (ePwmRate_ != LED_PWM_0) && (ePwmRate_ != LED_PWM_100) &&
+      LedHwPwmStart(eLED_, (u16)(ePwmRate_ * LED_HW_PWM_COUNTS_PER_STEP)) )
+  {
+    Leds_asLedArray[(u8)eLED_].eMode = LED_PWM_MODE;
+    Leds_asLedArray[(u8)eLED_].eRate = ePwmRate_;
+    LedWaveStop( LED_BIT(eLED_) );
+    Led_u32On |= (u32)1 << eLED_;
+    return;
+  }
+
+  LedSetWave(eLED_, LED_PWM_MODE, ePwmRate_, (u16)ePwmRate_, (u16)(LED_PWM_PERIOD - ePwmRate_));
 
 } /* end LedPWM() */
 
@@ -240,198 +506,1986 @@ Requires:
     LED_0_5HZ, LED_1HZ, LED_2HZ, LED_4HZ, LED_8HZ
 
 Promises:
-  - Requested LED is set to BLINK mode at the rate specified
+  - Requested LED is set to BLINK mode at the rate specified, starting with the on phase
 */
 void LedBlink(LedNumberType eLED_, LedRateType eBlinkRate_)
 {
-	Leds_asLedArray[(u8)eLED_].eMode = LED_BLINK_MODE;
-	Leds_asLedArray[(u8)eLED_].eRate = eBlinkRate_;
-	Leds_asLedArray[(u8)eLED_].u16Count = eBlinkRate_;
+  LedSetWave(eLED_, LED_BLINK_MODE, eBlinkRate_, (u16)eBlinkRate_, (u16)eBlinkRate_);
 
 } /* end LedBlink() */
 
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* Protected functions */
-/*--------------------------------------------------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedSetLevel
+
+Description:
+Sets an LED to an 8-bit brightness level.
+
+Requires:
+  - eLED_ is a valid LED index
+  - u8Level_ is 0 (off) to 255 (fully on)
+
+Promises:
+  - 0 and 255 leave the LED steady off or on
+  - With LED_BAM the LED is added to the bit planes at exactly u8Level_ / 255 duty
+  - Without LED_BAM, or while a compositor layer covers the LED, it is set to LedPWM() at the nearest 5% step
+*/
+void LedSetLevel(LedNumberType eLED_, u8 u8Level_)
+{
+  if(u8Level_ == 0)
+  {
+    LedOff(eLED_);
+    return;
+  }
+
+  if(u8Level_ == 0xFF)
+  {
+    LedOn(eLED_);
+    return;
+  }
+
+#ifdef LED_BAM
+  /* BAM writes the pin itself, so not while a compositor layer covers it */
+  if( !(Led_sLayerFront.u32Mask & LED_BIT(eLED_)) )
+  {
+    LedRelease(eLED_);
+    Leds_asLedArray[(u8)eLED_].eMode = LED_PWM_MODE;
+    Leds_asLedArray[(u8)eLED_].eRate = (LedRateType)( ((u16)u8Level_ * (LED_PWM_PERIOD + 1)) >> 8 );
+    LedWaveStop( LED_BIT(eLED_) );
+    Led_u32On |= (u32)1 << eLED_;
+    LedBamSetPlanes(eLED_, u8Level_);
+    return;
+  }
+#endif /* LED_BAM */
+
+  /* 0-255 to 0-20 without a divide */
+  LedPWM(eLED_, (LedRateType)( ((u16)u8Level_ * (LED_PWM_PERIOD + 1)) >> 8 ));
+
+} /* end LedSetLevel() */
+
 
 /*----------------------------------------------------------------------------------------------------------------------
-Function: LedInitialize
+Function: LedSetBrightness
 
 Description:
-Initialization of LED system paramters and visual LED check.
+Sets an LED to a perceived brightness.  The duty comes from the gamma table, scaled by the LED's calibration.
 
 Requires:
-  - G_u32SystemTime1ms ticking
-  - All LEDs already initialized to LED_NORMAL_MODE mode ON
+  - eLED_ is a valid LED index
+  - u8Brightness_ is 0 (off) to 255 (full)
 
 Promises:
-  - All LEDs in LED_NORMAL_MODE mode with OFF
+  - Any fade on the LED is stopped
+  - The LED shows LedCalibratedLevel(eLED_, u8Brightness_) through LedSetLevel()
 */
-void LedInitialize(void)
+void LedSetBrightness(LedNumberType eLED_, u8 u8Brightness_)
 {
-  u32 u32Timer;
-  LedNumberType aeLedSequenceHome[] = {HOME1, HOME2, HOME3, HOME6, HOME9, HOME8, HOME7, HOME4};
-  LedNumberType aeLedSequenceAway[] = {AWAY1, AWAY4, AWAY7, AWAY8, AWAY9, AWAY6, AWAY3, AWAY2};
-  
-  /* All status lights on */
-  LedOn(STATUS_RED);
-  LedOn(STATUS_YLW);
-  LedOn(STATUS_GRN);
+  LedShowBrightness(eLED_, u8Brightness_);
 
-#if 0 /* Picture mode */
-  LedOn(HOME1);
-  LedOn(HOME5);
-  LedOn(HOME7);
-  LedOn(HOME2);
-  LedOn(AWAY9);
-  LedOn(AWAY4);
-  LedOn(AWAY6);
-  LedOn(AWAY8);
-
-  while(1);
-#endif
+} /* end LedSetBrightness() */
 
-  LedOff(HOME5);
-  LedOn(AWAY5);
-  
-  while (1)
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedFade
+
+Description:
+Starts a fade from the LED's current brightness (the last LedSetBrightness(), LedFade() step, LedOn() or LedOff())
+to a new one.
+
+Requires:
+  - eLED_ is a valid LED index
+  - u8Target_ is the brightness to end at (0-255)
+  - u16Ms_ is the length of the fade in 1ms ticks (0 sets the target straight away)
+
+Promises:
+  - LedUpdate() moves the brightness one level at a time, evenly spread over u16Ms_ ticks, and ends on u8Target_
+  - Any direct call on the LED (LedOn(), LedPWM(), LedSetBrightness(), LedPlay(), ...) stops the fade where it is
+*/
+void LedFade(LedNumberType eLED_, u8 u8Target_, u16 u16Ms_)
+{
+  LedFadeType* psFade = &Led_asFades[(u8)eLED_];
+  u8 u8Now = Led_au8Brightness[(u8)eLED_];
+
+  if( (u16Ms_ == 0) || (u8Now == u8Target_) )
   {
-    /* Sequentially light up the LEDs */
-    for(u8 i = 0; i < 8; i++)
-    {
-      LedToggle(HOME5);
-      LedToggle(AWAY5);
-      LedOn(aeLedSequenceHome[i]);
-      LedOn(aeLedSequenceAway[i]);
-      for(u32 j = 0; j < 200000; j++);
-      LedOff(aeLedSequenceHome[i]);
-      LedOff(aeLedSequenceAway[i]);
+    LedShowBrightness(eLED_, u8Target_);
+    return;
+  }
 
-    }
+  psFade->u8Target = u8Target_;
+  psFade->u16Ms = u16Ms_;
+  psFade->u16TicksLeft = u16Ms_;
+  psFade->u16Delta = (u8Now < u8Target_) ? (u16)(u8Target_ - u8Now) : (u16)(u8Now - u8Target_);
+
+  /* Start half way so the steps are centred in the fade */
+  psFade->u16Error = u16Ms_ >> 1;
+  Led_u32Fading |= LED_BIT(eLED_);
+
+} /* end LedFade() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedSetCalibration
+
+Description:
+Sets how much an LED's duty is scaled so LEDs of different efficiency look the same at the same brightness.
+
+Requires:
+  - eLED_ is a valid LED index
+  - u8Scale_ is the fraction of the gamma duty to use, 255 = all of it
+
+Promises:
+  - The LED's next LedSetBrightness() or LedFade() step uses u8Scale_
+*/
+void LedSetCalibration(LedNumberType eLED_, u8 u8Scale_)
+{
+  Led_au8Calibration[(u8)eLED_] = u8Scale_;
+
+} /* end LedSetCalibration() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedLayerSet
+
+Description:
+Draws a compositor layer and blends all the layers into the back buffer.
+
+Requires:
+  - eLayer_ is a LedLayerType
+  - u32Leds_ is the mask of LEDs the layer covers; u32On_ has the ones of them that are lit (other bits ignored)
+
+Promises:
+  - A timeline playing in the layer (LedPlayLayer()) is stopped
+  - From the next frame boundary, each LED in u32Leds_ shows u32On_ unless a higher layer also covers it
+  - LEDs the layer no longer covers go back to the layer below or their own state
+  - Nothing is re-blended if the layer is unchanged
+*/
+void LedLayerSet(LedLayerType eLayer_, u32 u32Leds_, u32 u32On_)
+{
+  LedLayerContentType* psLayer = &Led_asLayers[eLayer_];
 
+  if( Led_u8LayerTimelines & (1 << eLayer_) )
+  {
+    LedTimelineReleaseLayer(eLayer_);
   }
 
-#if 0
-  /* Sequentially light up the LEDs */
-  for(u8 i = 0; i < 18; i++)
+  u32Leds_ &= LED_ALL_MASK;
+  u32On_ &= u32Leds_;
+  if( (psLayer->u32Mask == u32Leds_) && (psLayer->u32On == u32On_) )
   {
-    LedOn(aeLedSequence[i]);
-    for(u32 j = 0; j < 300000; j++);
+    return;
   }
-#endif
 
-  /* Pause for show */
-  for(u32 i = 0; i < 2000000; i++);
+  psLayer->u32Mask = u32Leds_;
+  psLayer->u32On = u32On_;
+  LedLayerBlend();
+
+} /* end LedLayerSet() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedLayerClear
+
+Description:
+Makes a compositor layer transparent.
+
+Requires:
+  - eLayer_ is a LedLayerType
+
+Promises:
+  - Any timeline in the layer is stopped and from the next frame boundary the layer covers no LEDs
+*/
+void LedLayerClear(LedLayerType eLayer_)
+{
+  LedLayerSet(eLayer_, 0, 0);
+
+} /* end LedLayerClear() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedGetStats
+
+Description:
+Returns the LedUpdate() timing.
+
+Requires:
+  -
+
+Promises:
+  - Returns a pointer to Led_sStats, updated by every LedUpdate()
+*/
+const LedStatsType* LedGetStats(void)
+{
+  return(&Led_sStats);
+
+} /* end LedGetStats() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedPlay
+
+Description:
+Starts a timeline on a set of LEDs.  The first frame is shown immediately.
+
+Requires:
+  - psTimeline_ points to a timeline with at least one frame and no zero-length frames
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - The LEDs leave any other timeline, blink, PWM or level and are driven by psTimeline_ from LedUpdate()
+  - Returns false with nothing changed if u32Leds_ is empty or every slot is still playing
+*/
+bool LedPlay(const LedTimelineType* psTimeline_, u32 u32Leds_)
+{
+  LedTimelineSlotType* psSlot = NULL;
+  u32 u32OnPins = 0;
+  u32 u32OffPins = 0;
 
-#if 0
-  /* Turn all LEDs on full, then fade them out over a few seconds */
-  for(u8 i = 20; i > 0; i--)
+  u32Leds_ &= LED_ALL_MASK;
+  if(u32Leds_ == 0)
   {
-    
-    /* Spend 40ms in each level of intensity */
-    for(u16 j = 40; j > 0; j--)
-    {
-      u32Timer = G_u32SystemTime1ms;
-      while( !IsTimeUp(&u32Timer, 1) );
-      LedUpdate();
-    }
-    /* Pause for a bit on the first iteration to show the LEDs on for little while */
-    if(i == 20)
-    {
-      while( !IsTimeUp(&u32Timer, 1500) );
-    }
-    
-    /* Set the LED intensity for the next iteration */
-    for(u8 j = 0; j < TOTAL_LEDS; j++)
+    return(false);
+  }
+
+  /* Taking the LEDs from older timelines may free a slot */
+  LedTimelineRelease(u32Leds_);
+  psSlot = LedTimelineFreeSlot();
+  if(psSlot == NULL)
+  {
+    return(false);
+  }
+
+  for(u8 i = 0; i < TOTAL_LEDS; i++)
+  {
+    if(u32Leds_ & LED_BIT(i))
     {
-      Leds_asLedArray[j].eRate = (LedRateType)(i - 1);
+      LedRelease( (LedNumberType)i );
+      Leds_asLedArray[i].eMode = LED_NORMAL_MODE;
     }
   }
+  LedWaveStop(u32Leds_);
 
-  /* Final update to set last state, hold for a short period */
-  LedUpdate();
-  while( !IsTimeUp(&u32Timer, 200) );
-#endif
-  
-} /* end LedInitialize() */
+  psSlot->psTimeline = psTimeline_;
+  psSlot->u32Leds = u32Leds_;
+  psSlot->u8Frame = 0;
+  psSlot->u8Passes = psTimeline_->u8Passes;
+  psSlot->u8Layer = LED_LAYER_NONE;
+  Led_u32Timeline |= u32Leds_;
 
+  LedTimelineShow(psSlot, &u32OnPins, &u32OffPins);
+  LedCommit(u32OnPins, u32OffPins);
+
+  return(true);
+
+} /* end LedPlay() */
 
-/*--------------------------------------------------------------------------------------------------------------------*/
-/* Private functions */
-/*--------------------------------------------------------------------------------------------------------------------*/
 
 /*----------------------------------------------------------------------------------------------------------------------
-Function: LedUpdate
+Function: LedPlayLayer
 
 Description:
-Update all LEDs for the current cycle.
+Starts a timeline in a compositor layer.  The LEDs keep whatever they were doing underneath, so board redraws and
+other direct calls on them neither stop the timeline nor show through it.  The first frame is blended straight away
+and, like every layer change, appears at the next frame boundary.
 
 Requires:
- - G_u32SystemTime1ms is counting
+  - psTimeline_ points to a timeline with at least one frame and no zero-length frames
+  - eLayer_ is a LedLayerType
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
 
 Promises:
-   - All LEDs updated based on their counters
+  - The layer covers u32Leds_ and shows psTimeline_'s frames on them from LedUpdate(), replacing what it drew and
+    any timeline already in it
+  - A timeline that ends leaves its last frame in the layer until LedLayerSet() or LedLayerClear()
+  - Returns false with nothing changed if u32Leds_ is empty or every slot is still playing
 */
-void LedUpdate(void)
+bool LedPlayLayer(const LedTimelineType* psTimeline_, LedLayerType eLayer_, u32 u32Leds_)
 {
-	/* Loop through each LED */
-  for(u8 i = 0; i < TOTAL_LEDS; i++)
+  LedTimelineSlotType* psSlot;
+  u32 u32OnPins = 0;
+  u32 u32OffPins = 0;
+
+  u32Leds_ &= LED_ALL_MASK;
+  if(u32Leds_ == 0)
   {
-    /* Check if LED is PWMing */
-    if(Leds_asLedArray[(LedNumberType)i].eMode == LED_PWM_MODE)
-    {
-      /* Handle special case of 0% duty cycle */
-      if( Leds_asLedArray[i].eRate == LED_PWM_0 )
-      {
-        LedOff( (LedNumberType)i );
-      }
-      
-      /* Handle special case of 100% duty cycle */
-      else if( Leds_asLedArray[i].eRate == LED_PWM_100 )
-      {
-        LedOn( (LedNumberType)i );
-      }
-  
-      /* Otherwise, regular PWM: decrement counter; toggle and reload if counter reaches 0 */
-      else
-      {
-        if(--Leds_asLedArray[(LedNumberType)i].u16Count == 0)
-        {
-          if(Leds_asLedArray[(LedNumberType)i].eCurrentDuty == LED_PWM_DUTY_HIGH)
-          {
-            /* Turn the LED off and update the counters for the next cycle */
-            LedOff( (LedNumberType)i );
-            Leds_asLedArray[(LedNumberType)i].u16Count = LED_PWM_PERIOD - Leds_asLedArray[(LedNumberType)i].eRate;
-            Leds_asLedArray[(LedNumberType)i].eCurrentDuty = LED_PWM_DUTY_LOW;
-          }
-          else
-          {
-            /* Turn the LED on and update the counters for the next cycle */
-            LedOn( (LedNumberType)i );
-            Leds_asLedArray[i].u16Count = Leds_asLedArray[i].eRate;
-            Leds_asLedArray[i].eCurrentDuty = LED_PWM_DUTY_HIGH;
-          }
-        }
-      }
+    return(false);
+  }
 
-      /* Set the LED back to PWM mode since LedOff and LedOn set it to normal mode */
-     	Leds_asLedArray[(LedNumberType)i].eMode = LED_PWM_MODE;
-      
-    } /* end if PWM mode */
-    
-    /* LED is in LED_BLINK_MODE mode */
-    else if(Leds_asLedArray[(LedNumberType)i].eMode == LED_BLINK_MODE)
-    {
-      /* Decrement counter; toggle and reload if counter reaches 0 */
-      if( --Leds_asLedArray[(LedNumberType)i].u16Count == 0)
-      {
-        LedToggle( (LedNumberType)i );
-        Leds_asLedArray[(LedNumberType)i].u16Count = Leds_asLedArray[(LedNumberType)i].eRate;
-      }
-    }
-  } /* end for */
-} /* end LedUpdate() */
+  if( Led_u8LayerTimelines & (1 << eLayer_) )
+  {
+    LedTimelineReleaseLayer(eLayer_);
+  }
+  psSlot = LedTimelineFreeSlot();
+  if(psSlot == NULL)
+  {
+    return(false);
+  }
+
+  psSlot->psTimeline = psTimeline_;
+  psSlot->u32Leds = u32Leds_;
+  psSlot->u8Frame = 0;
+  psSlot->u8Passes = psTimeline_->u8Passes;
+  psSlot->u8Layer = (u8)eLayer_;
+  Led_u8LayerTimelines |= (u8)(1 << eLayer_);
+
+  /* A layered slot writes no pins itself */
+  LedTimelineShow(psSlot, &u32OnPins, &u32OffPins);
+
+  return(true);
+
+} /* end LedPlayLayer() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedStop
+
+Description:
+Stops timelines on a set of LEDs.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - The LEDs keep the state of the frame they were showing and are in LED_NORMAL_MODE
+  - Slots left with no LEDs are freed
+*/
+void LedStop(u32 u32Leds_)
+{
+  LedTimelineRelease(u32Leds_);
+
+} /* end LedStop() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedIsPlaying
+
+Description:
+Checks if any of a set of LEDs is being driven by a timeline.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - Returns true if at least one of the LEDs is in a LedPlay() timeline that has not finished (timelines in layers
+    are not counted)
+*/
+bool LedIsPlaying(u32 u32Leds_)
+{
+  return( (Led_u32Timeline & u32Leds_) != 0 );
+
+} /* end LedIsPlaying() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedMsToNextEdge
+
+Description:
+Reports how long the LEDs can go without a LedUpdate() that changes something.
+
+Requires:
+  -
+
+Promises:
+  - Returns LED_NO_EDGE if no LED blinks, PWMs in software, fades or plays a timeline
+  - With LED_TICKLESS returns the ms from now (G_u32SystemTime1ms) that can pass before the earliest edge in the
+    heap or, while a layer change is waiting, the next frame boundary (0 if one is due on the next tick)
+  - Without LED_TICKLESS every call counts down every animated LED, so returns 0 whenever anything is animated
+  - Returns 0 while the current budget is multiplexing the lit LEDs or an LED is fading
+*/
+u32 LedMsToNextEdge(void)
+{
+#ifdef LED_TICKLESS
+  u32 u32Now = G_u32SystemTime1ms;
+  s32 s32Wait;
+  s32 s32Frame;
+
+  if( Led_bBudgetMux || (Led_u32Fading != 0) )
+  {
+    return(0);
+  }
+
+  if( (Led_u8HeapCount == 0) && !Led_bLayersDirty )
+  {
+    return(LED_NO_EDGE);
+  }
+
+  s32Wait = (s32)(LED_NO_EDGE >> 1);
+  if(Led_u8HeapCount != 0)
+  {
+    s32Wait = (s32)(Led_asHeap[0].u32Deadline - u32Now) - 1;
+  }
+  if(Led_bLayersDirty)
+  {
+    s32Frame = (s32)(Led_u32FrameMs - u32Now) - 1;
+    if(s32Frame < s32Wait)
+    {
+      s32Wait = s32Frame;
+    }
+  }
+  return( (s32Wait > 0) ? (u32)s32Wait : 0 );
+
+#else
+  if( !Led_bBudgetMux && (Led_u32Animated == 0) && (Led_u32Timeline == 0) && (Led_u8LayerTimelines == 0) &&
+      (Led_u32Fading == 0) && !Led_bLayersDirty )
+  {
+    return(LED_NO_EDGE);
+  }
+
+  return(0);
+
+#endif /* LED_TICKLESS */
+} /* end LedMsToNextEdge() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Protected functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedInitialize
+
+Description:
+Initialization of LED system paramters and visual LED check.  The check is the boot timeline, so this returns
+straight away and the chase plays from LedUpdate() while the rest of the system starts.
+
+Requires:
+  - GpioSetup() has configured the LED pins
+
+Promises:
+  - Status LEDs on, HOME and AWAY LEDs playing G_sLedTimelineBoot
+*/
+void LedInitialize(void)
+{
+  /* TIMER2 runs the hardware PWM channels or BAM; it is only started while an LED needs it */
+  Led_u32HwPwm = 0;
+  for(u8 i = 0; i < LED_HW_PWM_CHANNELS; i++)
+  {
+    Led_au8HwPwmLed[i] = LED_HW_PWM_FREE;
+  }
+  NRF_TIMER2->TASKS_STOP = 1;
+#ifdef LED_BAM
+  Led_u32Bam = 0;
+  memset(Led_asBamPlanes, 0, sizeof(Led_asBamPlanes));
+  NRF_TIMER2->MODE = TIMER_MODE_MODE_Timer;
+  NRF_TIMER2->BITMODE = TIMER_BITMODE_BITMODE_16Bit;
+  NRF_TIMER2->PRESCALER = LED_BAM_TIMER_PRESCALER;
+  NRF_TIMER2->SHORTS = TIMER_SHORTS_COMPARE0_CLEAR_Msk;
+  NRF_TIMER2->INTENCLR = 0xFFFFFFFF;
+  NRF_TIMER2->INTENSET = TIMER_INTENSET_COMPARE0_Msk;
+  NVIC_SetPriority(TIMER2_IRQn, LED_BAM_IRQ_PRIORITY);
+  NVIC_ClearPendingIRQ(TIMER2_IRQn);
+  NVIC_EnableIRQ(TIMER2_IRQn);
+#else
+  NRF_TIMER2->MODE = TIMER_MODE_MODE_Timer;
+  NRF_TIMER2->BITMODE = TIMER_BITMODE_BITMODE_16Bit;
+  NRF_TIMER2->PRESCALER = LED_HW_PWM_TIMER_PRESCALER;
+  NRF_TIMER2->CC[LED_HW_PWM_PERIOD_CC] = LED_HW_PWM_TOP;
+  NRF_TIMER2->SHORTS = TIMER_SHORTS_COMPARE3_CLEAR_Msk;
+  NRF_TIMER2->INTENCLR = 0xFFFFFFFF;
+#endif /* LED_BAM */
+
+  Led_u32NowMs = G_u32SystemTime1ms;
+  Led_u32FrameMs = Led_u32NowMs + LED_FRAME_TICKS;
+  Led_u32Timeline = 0;
+  Led_u8LayerTimelines = 0;
+  for(u8 i = 0; i < LED_TIMELINE_SLOTS; i++)
+  {
+    Led_asTimelines[i].psTimeline = NULL;
+  }
+
+#ifdef LED_TICKLESS
+  Led_u8HeapCount = 0;
+  for(u8 i = 0; i < LED_HEAP_SIZE; i++)
+  {
+    Led_au8HeapIndex[i] = LED_HEAP_NONE;
+  }
+#endif /* LED_TICKLESS */
+
+  /* All status lights on, then chase around the board */
+  LedOn(STATUS_RED);
+  LedOn(STATUS_YLW);
+  LedOn(STATUS_GRN);
+  LedPlay(&G_sLedTimelineBoot, LED_HOME_MASK | LED_AWAY_MASK);
+
+} /* end LedInitialize() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Private functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedUpdate
+
+Description:
+Update all LEDs for the current cycle.  Every LED or timeline whose current phase or frame ends moves on and adds
+its pins to the on and off masks, and both masks are written once at the end.
+
+Without LED_TICKLESS, every LED in Led_u32Animated and every timeline slot counts down each call.  With
+LED_TICKLESS, only the entries at the top of the deadline heap that are due are visited, so a tick with nothing due
+returns after one compare.  The time base, the layer frames and the wake-up window follow G_u32SystemTime1ms, so
+the ms a sleep skipped (SystemSleep() only skips ms LedMsToNextEdge() allows) are caught up on the next call.
+
+Requires:
+ - Called every 1ms, or at least as often as LedMsToNextEdge() asks
+ - TIMER1 is running (SystemCycleCapture())
+
+Promises:
+   - All LEDs updated based on their counters or deadlines with one OUTSET and one OUTCLR write
+   - While more than LED_MAX_LIT LEDs are lit, runs every tick to light the next LED_MAX_LIT of them
+   - Fading LEDs move one tick further through their fade
+   - At a frame boundary, a changed layer blend is swapped in with one LedCommit
+   - Led_sStats holds the cycles taken by ticks that did LED work and the wake-up counts
+*/
+void LedUpdate(void)
+{
+  u32 u32Start;
+  u32 u32OnPins = 0;
+  u32 u32OffPins = 0;
+  u32 u32Cycles;
+  u32 u32Elapsed = G_u32SystemTime1ms - Led_u32NowMs;
+  bool bFrame = false;
+#ifdef LED_TICKLESS
+  u8 u8Id;
+  LedConfigType* psLed;
+#else
+  u32 u32Leds = Led_u32Animated;
+  u32 u32Bit = 1;
+  LedConfigType* psLed;
+  LedTimelineSlotType* psSlot;
+#endif /* LED_TICKLESS */
+
+  Led_sStats.u32Ticks++;
+  Led_u32NowMs += u32Elapsed;
+  LedWindowTick(u32Elapsed);
+
+  /* A new frame starts every LED_FRAME_TICKS ms; after a long sleep the next one is a full frame away */
+  if( (s32)(Led_u32NowMs - Led_u32FrameMs) >= 0 )
+  {
+    bFrame = true;
+    Led_u32FrameMs += LED_FRAME_TICKS;
+    if( (s32)(Led_u32NowMs - Led_u32FrameMs) >= 0 )
+    {
+      Led_u32FrameMs = Led_u32NowMs + LED_FRAME_TICKS;
+    }
+  }
+
+#ifdef LED_TICKLESS
+  if( !Led_bBudgetMux && (Led_u32Fading == 0) && !(Led_bLayersDirty && bFrame) &&
+      ((Led_u8HeapCount == 0) || ((s32)(Led_asHeap[0].u32Deadline - Led_u32NowMs) > 0)) )
+  {
+    return;
+  }
+
+  u32Start = SystemCycleCapture();
+  while( (Led_u8HeapCount != 0) && ((s32)(Led_asHeap[0].u32Deadline - Led_u32NowMs) <= 0) )
+  {
+    u8Id = Led_asHeap[0].u8Id;
+    if(u8Id >= TOTAL_LEDS)
+    {
+      LedTimelineStep(&Led_asTimelines[u8Id - TOTAL_LEDS], &u32OnPins, &u32OffPins);
+      continue;
+    }
+
+    psLed = &Leds_asLedArray[u8Id];
+    Led_u32On ^= LED_BIT(u8Id);
+    if(Led_u32On & LED_BIT(u8Id))
+    {
+      LedHeapSet(u8Id, Led_u32NowMs + psLed->u16OnTicks);
+      u32OnPins |= Led_au32BitPositions[u8Id];
+    }
+    else
+    {
+      LedHeapSet(u8Id, Led_u32NowMs + psLed->u16OffTicks);
+      u32OffPins |= Led_au32BitPositions[u8Id];
+    }
+  }
+
+#else
+  if( !Led_bBudgetMux && (Led_u32Animated == 0) && (Led_u32Timeline == 0) && (Led_u8LayerTimelines == 0) &&
+      (Led_u32Fading == 0) && !(Led_bLayersDirty && bFrame) )
+  {
+    return;
+  }
+
+  u32Start = SystemCycleCapture();
+
+  /* Stop after the highest animated LED */
+  for(u8 i = 0; u32Leds != 0; i++, u32Leds >>= 1, u32Bit <<= 1)
+  {
+    if( !(u32Leds & 1) )
+    {
+      continue;
+    }
+
+    psLed = &Leds_asLedArray[i];
+    if(--psLed->u16Count == 0)
+    {
+      Led_u32On ^= u32Bit;
+      if(Led_u32On & u32Bit)
+      {
+        psLed->u16Count = psLed->u16OnTicks;
+        u32OnPins |= Led_au32BitPositions[i];
+      }
+      else
+      {
+        psLed->u16Count = psLed->u16OffTicks;
+        u32OffPins |= Led_au32BitPositions[i];
+      }
+    }
+  }
+
+  /* Timelines: one countdown per slot, the frame only changes when it runs out */
+  psSlot = &Led_asTimelines[0];
+  for(u8 i = 0; i < LED_TIMELINE_SLOTS; i++, psSlot++)
+  {
+    if( (psSlot->psTimeline != NULL) && (--psSlot->u16Count == 0) )
+    {
+      LedTimelineStep(psSlot, &u32OnPins, &u32OffPins);
+    }
+  }
+#endif /* LED_TICKLESS */
+
+  /* Over the current budget, move on to the next group of lit LEDs */
+  if(Led_bBudgetMux)
+  {
+    Led_u8BudgetFirst = Led_u8BudgetNext;
+    Led_sStats.u32BudgetTicks++;
+  }
+
+  LedCommit(u32OnPins, u32OffPins);
+
+  /* Fades reprogram their LEDs themselves, after the waves have been written */
+  if(Led_u32Fading != 0)
+  {
+    LedFadeStep();
+  }
+
+  /* New layer frames are only shown at a frame boundary */
+  if(Led_bLayersDirty && bFrame)
+  {
+    LedLayerFlip();
+  }
+
+  Led_sStats.u32Wakeups++;
+  Led_u32WindowWakeups++;
+  u32Cycles = SystemCyclesElapsed(u32Start);
+  Led_sStats.u32Updates++;
+  Led_sStats.u32LastCycles = u32Cycles;
+  Led_sStats.u32TotalCycles += u32Cycles;
+  if(u32Cycles > Led_sStats.u32WorstCycles)
+  {
+    Led_sStats.u32WorstCycles = u32Cycles;
+  }
+
+} /* end LedUpdate() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedWindowTick
+
+Description:
+Closes a wake-up window every LED_WAKE_WINDOW_TICKS ms and turns its wake-up count into a current estimate.
+
+Requires:
+  - Called once per LedUpdate() with the ms since the last call, before any wake-up of this tick is counted
+
+Promises:
+  - At the end of each window, u32WindowWakeups and u32WakeCurrentNa in Led_sStats describe it and a new window
+    starts (ms a sleep carried past the end of the window are not carried into the next one)
+*/
+void LedWindowTick(u32 u32Ms_)
+{
+  if( u32Ms_ < (u32)(LED_WAKE_WINDOW_TICKS - Led_u16WindowTicks) )
+  {
+    Led_u16WindowTicks += (u16)u32Ms_;
+    return;
+  }
+
+  /* nC per wake-up x wake-ups per 1.024s window ~= nA (shift instead of a divide; 1000/1024 = 125/128) */
+  Led_sStats.u32WindowWakeups = Led_u32WindowWakeups;
+  Led_sStats.u32WakeCurrentNa = (Led_u32WindowWakeups * LED_WAKE_CHARGE_NC * 125) >> 7;
+  Led_u32WindowWakeups = 0;
+  Led_u16WindowTicks = 0;
+
+} /* end LedWindowTick() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedCommit
+
+Description:
+Shows a change of Led_u32On.  LEDs covered by a compositor layer keep showing the layer.
+
+Requires:
+  - Led_u32On already holds the new state
+  - u32OnPins_ and u32OffPins_ are the port pin masks (Led_au32BitPositions) of the LEDs that changed and do not
+    overlap
+
+Promises:
+  - The pins not covered by the shown layers are written through LedCommitShown()
+*/
+void LedCommit(u32 u32OnPins_, u32 u32OffPins_)
+{
+  LedCommitShown(u32OnPins_ & ~Led_u32LayerPins, u32OffPins_ & ~Led_u32LayerPins);
+
+} /* end LedCommit() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedCommitShown
+
+Description:
+Writes a change of the shown LEDs (Led_u32On under the shown layers), within the current budget.
+
+Requires:
+  - Led_u32On and Led_sLayerFront already hold the new state
+  - u32OnPins_ and u32OffPins_ are the port pin masks of the shown LEDs that changed and do not overlap
+
+Promises:
+  - At most LED_MAX_LIT of the GPIO-driven LEDs are lit: below the budget, exactly the pins given change; above
+    it, the whole group is redrawn by LedBudgetShow()
+  - Led_sStats.u32PeakLit holds the most LEDs ever lit at once, counting hardware PWM and BAM LEDs as lit
+*/
+void LedCommitShown(u32 u32OnPins_, u32 u32OffPins_)
+{
+  u32 u32HwDriven = Led_u32HwPwm;
+  u32 u32Shown = (Led_u32On & ~Led_sLayerFront.u32Mask) | Led_sLayerFront.u32On;
+  u32 u32Lit;
+
+#ifdef LED_BAM
+  u32HwDriven |= Led_u32Bam;
+#endif
+
+  u32Lit = LedCountBits(u32Shown & ~u32HwDriven);
+  if( (u32Lit > LED_MAX_LIT) || Led_bBudgetMux )
+  {
+    u32Lit = LedBudgetShow(u32Shown & ~u32HwDriven, u32HwDriven, u32Lit);
+  }
+  else
+  {
+    LedWritePins(u32OnPins_, u32OffPins_);
+  }
+
+  u32Lit += LedCountBits(u32Shown & u32HwDriven);
+  if(u32Lit > Led_sStats.u32PeakLit)
+  {
+    Led_sStats.u32PeakLit = u32Lit;
+  }
+
+} /* end LedCommitShown() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedLayerBlend
+
+Description:
+Blends the compositor layers into the back buffer, lowest first, each covering the ones below it.
+
+Requires:
+  - Led_asLayers[] holds the layers
+
+Promises:
+  - Led_sLayerBack is the blend; Led_bLayersDirty is TRUE if it differs from the front buffer being shown
+*/
+void LedLayerBlend(void)
+{
+  LedLayerContentType* psLayer = &Led_asLayers[0];
+  u32 u32Mask = 0;
+  u32 u32On = 0;
+
+  for(u8 i = 0; i < LED_LAYERS; i++, psLayer++)
+  {
+    u32On = (u32On & ~psLayer->u32Mask) | psLayer->u32On;
+    u32Mask |= psLayer->u32Mask;
+  }
+
+  Led_sLayerBack.u32Mask = u32Mask;
+  Led_sLayerBack.u32On = u32On;
+  Led_bLayersDirty = (u32Mask != Led_sLayerFront.u32Mask) || (u32On != Led_sLayerFront.u32On);
+
+} /* end LedLayerBlend() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedLayerFlip
+
+Description:
+Shows the back buffer: swaps it in as the front buffer and writes the LEDs whose shown state changes.
+
+Requires:
+  - Called at a frame boundary from LedUpdate()
+
+Promises:
+  - Led_sLayerFront = Led_sLayerBack and Led_u32LayerPins are its covered pins
+  - LEDs newly covered leave hardware PWM or BAM (they come back steady at their own state when uncovered, and
+    LedPWM() / LedSetLevel() keep covered LEDs on the software wave)
+  - Every LED whose shown state changed is written in one LedCommitShown()
+*/
+void LedLayerFlip(void)
+{
+  u32 u32Before = (Led_u32On & ~Led_sLayerFront.u32Mask) | Led_sLayerFront.u32On;
+  u32 u32After;
+  u32 u32HwCovered = Led_u32HwPwm;
+
+#ifdef LED_BAM
+  u32HwCovered |= Led_u32Bam;
+#endif
+
+  /* Hardware PWM and BAM drive their pins themselves, so a layer has to take them back first */
+  u32HwCovered &= Led_sLayerBack.u32Mask;
+  for(u8 i = 0; u32HwCovered != 0; i++, u32HwCovered >>= 1)
+  {
+    if(u32HwCovered & 1)
+    {
+      LedHwPwmRelease( (LedNumberType)i );
+#ifdef LED_BAM
+      LedBamRelease( (LedNumberType)i );
+#endif
+    }
+  }
+
+  Led_sLayerFront = Led_sLayerBack;
+  Led_u32LayerPins = LedMaskToPins(Led_sLayerFront.u32Mask);
+  Led_bLayersDirty = false;
+
+  u32After = (Led_u32On & ~Led_sLayerFront.u32Mask) | Led_sLayerFront.u32On;
+  LedCommitShown(LedMaskToPins(u32After & ~u32Before), LedMaskToPins(u32Before & ~u32After));
+
+} /* end LedLayerFlip() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedWritePins
+
+Description:
+Drives sets of LEDs on and off with one OUTSET and one OUTCLR write.
+
+Requires:
+  - u32OnPins_ and u32OffPins_ are port pin masks of LEDs (Led_au32BitPositions) and do not overlap
+
+Promises:
+  - Every LED in u32OnPins_ is lit and every LED in u32OffPins_ is dark; no other pin changes
+*/
+void LedWritePins(u32 u32OnPins_, u32 u32OffPins_)
+{
+  NRF_GPIO->OUTSET = (u32OnPins_ & ~LED_ACTIVE_LOW_PINS) | (u32OffPins_ & LED_ACTIVE_LOW_PINS);
+  NRF_GPIO->OUTCLR = (u32OffPins_ & ~LED_ACTIVE_LOW_PINS) | (u32OnPins_ & LED_ACTIVE_LOW_PINS);
+
+} /* end LedWritePins() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedBudgetShow
+
+Description:
+Lights the LEDs of the current budget group and darkens the rest.  Going round the LEDs from Led_u8BudgetFirst, the
+first LED_MAX_LIT that are on are lit; Led_u8BudgetNext is where the next group starts, so every lit LED gets its
+turn.  Leaves multiplexing when the lit LEDs fit the budget again.
+
+Requires:
+  - u32Leds_ is Led_u32On without the hardware-driven LEDs, u32Count_ the number of LEDs in it
+  - u32HwDriven_ is the mask of LEDs on hardware PWM or BAM (their pins are not touched)
+
+Promises:
+  - Returns the number of GPIO-driven LEDs now lit
+  - Led_bBudgetMux is TRUE while u32Count_ > LED_MAX_LIT
+*/
+u32 LedBudgetShow(u32 u32Leds_, u32 u32HwDriven_, u32 u32Count_)
+{
+  u32 u32OnPins = 0;
+  u32 u32OffPins = 0;
+  u32 u32Lit = 0;
+  u8 u8Led = Led_u8BudgetFirst;
+
+  if(u32Count_ <= LED_MAX_LIT)
+  {
+    /* Back within budget: every LED shows its own state */
+    Led_bBudgetMux = false;
+    LedWritePins(LedMaskToPins(u32Leds_), LedMaskToPins(LED_ALL_MASK & ~u32Leds_ & ~u32HwDriven_));
+    return(u32Count_);
+  }
+
+  Led_bBudgetMux = true;
+  for(u8 i = 0; i < TOTAL_LEDS; i++)
+  {
+    if( !(u32HwDriven_ & LED_BIT(u8Led)) )
+    {
+      if( (u32Leds_ & LED_BIT(u8Led)) && (u32Lit < LED_MAX_LIT) )
+      {
+        u32OnPins |= Led_au32BitPositions[u8Led];
+        u32Lit++;
+        Led_u8BudgetNext = (u8)(u8Led + 1);
+      }
+      else
+      {
+        u32OffPins |= Led_au32BitPositions[u8Led];
+      }
+    }
+
+    if(++u8Led == TOTAL_LEDS)
+    {
+      u8Led = 0;
+    }
+  }
+
+  if(Led_u8BudgetNext == TOTAL_LEDS)
+  {
+    Led_u8BudgetNext = 0;
+  }
+
+  LedWritePins(u32OnPins, u32OffPins);
+  return(u32Lit);
+
+} /* end LedBudgetShow() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedCountBits
+
+Description:
+Counts the set bits of a mask (the M0 has no popcount: ~15 cycles of shifts and adds).
+
+Requires:
+  -
+
+Promises:
+  - Returns the number of bits set in u32Mask_
+*/
+u32 LedCountBits(u32 u32Mask_)
+{
+  u32Mask_ = u32Mask_ - ((u32Mask_ >> 1) & 0x55555555);
+  u32Mask_ = (u32Mask_ & 0x33333333) + ((u32Mask_ >> 2) & 0x33333333);
+  u32Mask_ = (u32Mask_ + (u32Mask_ >> 4)) & 0x0F0F0F0F;
+  u32Mask_ = u32Mask_ + (u32Mask_ >> 8);
+  u32Mask_ = u32Mask_ + (u32Mask_ >> 16);
+
+  return(u32Mask_ & 0x3F);
+
+} /* end LedCountBits() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedCalibratedLevel
+
+Description:
+Converts a perceived brightness to the LedSetLevel() duty for one LED.
+
+Requires:
+  - eLED_ is a valid LED index
+
+Promises:
+  - Returns Led_au8Gamma[u8Brightness_] scaled by (calibration + 1) / 256: 255 and full calibration stay 255, and a
+    non-zero gamma value with a scale of 255 stays non-zero
+*/
+u8 LedCalibratedLevel(LedNumberType eLED_, u8 u8Brightness_)
+{
+  return( (u8)( ((u16)Led_au8Gamma[u8Brightness_] * ((u16)Led_au8Calibration[(u8)eLED_] + 1)) >> 8 ) );
+
+} /* end LedCalibratedLevel() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedShowBrightness
+
+Description:
+Shows a perceived brightness on an LED and records it as the start of the next fade.
+
+Requires:
+  - eLED_ is a valid LED index
+
+Promises:
+  - The LED is set with LedSetLevel() (which stops any fade) and Led_au8Brightness[eLED_] = u8Brightness_
+*/
+void LedShowBrightness(LedNumberType eLED_, u8 u8Brightness_)
+{
+  LedSetLevel(eLED_, LedCalibratedLevel(eLED_, u8Brightness_));
+  Led_au8Brightness[(u8)eLED_] = u8Brightness_;
+
+} /* end LedShowBrightness() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedFadeStep
+
+Description:
+Moves every fading LED on by one tick.  The error term gains the fade's distance each tick and the brightness moves
+one level for every whole duration in it, so a fade of D levels over T ticks takes exactly D steps in T ticks.
+
+Requires:
+  - Called once per LedUpdate() tick while Led_u32Fading is not 0
+
+Promises:
+  - Each fading LED's brightness moves towards its target; on the last tick it is the target and the fade ends
+  - An LED is only reprogrammed when its new brightness gives a different LedSetLevel() duty (a different 5%
+    step without LED_BAM), so a software PWM wave is not restarted every tick
+*/
+void LedFadeStep(void)
+{
+  u32 u32Fading = Led_u32Fading;
+  LedFadeType* psFade;
+  u8 u8Old;
+  u8 u8New;
+
+  for(u8 i = 0; u32Fading != 0; i++, u32Fading >>= 1)
+  {
+    if( !(u32Fading & 1) )
+    {
+      continue;
+    }
+
+    psFade = &Led_asFades[i];
+    u8Old = Led_au8Brightness[i];
+    u8New = u8Old;
+
+    if(--psFade->u16TicksLeft == 0)
+    {
+      u8New = psFade->u8Target;
+      Led_u32Fading &= ~LED_BIT(i);
+    }
+    else
+    {
+      psFade->u16Error += psFade->u16Delta;
+      while(psFade->u16Error >= psFade->u16Ms)
+      {
+        psFade->u16Error -= psFade->u16Ms;
+        if(u8New < psFade->u8Target)
+        {
+          u8New++;
+        }
+        else if(u8New > psFade->u8Target)
+        {
+          u8New--;
+        }
+      }
+    }
+
+    Led_au8Brightness[i] = u8New;
+    if( LedLevelStep(LedCalibratedLevel((LedNumberType)i, u8New)) !=
+        LedLevelStep(LedCalibratedLevel((LedNumberType)i, u8Old)) )
+    {
+      LedShowBrightness( (LedNumberType)i, u8New );
+
+      /* LedSetLevel() ends fades through LedRelease(): carry on unless this was the last step */
+      if(u8New != psFade->u8Target)
+      {
+        Led_u32Fading |= LED_BIT(i);
+      }
+    }
+  }
+
+} /* end LedFadeStep() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedLevelStep
+
+Description:
+Reduces a LedSetLevel() duty to what the LED can actually show.
+
+Requires:
+  -
+
+Promises:
+  - With LED_BAM returns u8Level_ (every level is distinct)
+  - Without LED_BAM returns the LedPWM() step LedSetLevel() would choose, with 0 and 255 kept apart from the steps
+*/
+u8 LedLevelStep(u8 u8Level_)
+{
+#ifdef LED_BAM
+  return(u8Level_);
+#else
+  if( (u8Level_ == 0) || (u8Level_ == 0xFF) )
+  {
+    return(u8Level_);
+  }
+
+  return( (u8)( ((u16)u8Level_ * (LED_PWM_PERIOD + 1)) >> 8 ) );
+#endif /* LED_BAM */
+
+} /* end LedLevelStep() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedSetWave
+
+Description:
+Starts a blink or PWM square wave on an LED.
+
+Requires:
+  - eLED_ is a valid LED index
+  - u16OnTicks_ and u16OffTicks_ are the phase lengths in 1ms ticks
+
+Promises:
+  - eMode_ and eRate_ are recorded for the LED
+  - If both phases are non-zero and the LED already runs a wave, it keeps its state and the time left in the current
+    phase (cut to the new phase's length), so a new duty (e.g. each fade step) does not restart the wave
+  - If both phases are non-zero and the LED is starting a wave, LedUpdate() runs it with its on phase starting
+    eLED_ * LED_PHASE_STEP_MS (modulo the period) from now: the LED starts dark for that long, or lit if the offset is 0
+  - Otherwise the LED is held steady on (no off phase) or off (no on phase) and LedUpdate() skips it
+*/
+void LedSetWave(LedNumberType eLED_, LedModeType eMode_, LedRateType eRate_, u16 u16OnTicks_, u16 u16OffTicks_)
+{
+  LedConfigType* psLed = &Leds_asLedArray[(u8)eLED_];
+  u32 u32Bit = (u32)1 << eLED_;
+  u16 u16Period = u16OnTicks_ + u16OffTicks_;
+  u16 u16Phase = (u16)(eLED_ * LED_PHASE_STEP_MS);
+  u32 u32Left;
+
+  LedRelease(eLED_);
+  psLed->eMode = eMode_;
+  psLed->eRate = eRate_;
+  psLed->u16OnTicks = u16OnTicks_;
+  psLed->u16OffTicks = u16OffTicks_;
+
+  if( (u16OnTicks_ != 0) && (u16OffTicks_ != 0) && (Led_u32Animated & u32Bit) )
+  {
+    /* Only the duty changes: carry on from the current edge, at most the new phase's length away */
+#ifdef LED_TICKLESS
+    u32Left = Led_asHeap[Led_au8HeapIndex[eLED_]].u32Deadline - Led_u32NowMs;
+#else
+    u32Left = psLed->u16Count;
+#endif
+    u16Phase = (Led_u32On & u32Bit) ? u16OnTicks_ : u16OffTicks_;
+    psLed->u16Count = (u16)( (u32Left < u16Phase) ? u32Left : u16Phase );
+#ifdef LED_TICKLESS
+    LedHeapSet( (u8)eLED_, Led_u32NowMs + psLed->u16Count );
+#endif
+    return;
+  }
+
+  psLed->u16Count = u16OnTicks_;
+  if( (u16OnTicks_ != 0) && (u16OffTicks_ != 0) )
+  {
+    /* Stagger the first on edge so LEDs set up together do not all switch on the same tick */
+    while(u16Phase >= u16Period)
+    {
+      u16Phase -= u16Period;
+    }
+
+    if(u16Phase != 0)
+    {
+      psLed->u16Count = u16Phase;
+      u16OnTicks_ = 0;
+    }
+
+    Led_u32Animated |= u32Bit;
+#ifdef LED_TICKLESS
+    LedHeapSet( (u8)eLED_, Led_u32NowMs + psLed->u16Count );
+#endif
+  }
+  else
+  {
+    LedWaveStop(u32Bit);
+  }
+
+  if(u16OnTicks_ != 0)
+  {
+    Led_u32On |= u32Bit;
+    LedCommit(Led_au32BitPositions[eLED_], 0);
+  }
+  else
+  {
+    Led_u32On &= ~u32Bit;
+    LedCommit(0, Led_au32BitPositions[eLED_]);
+  }
+
+} /* end LedSetWave() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedHwPwmStart
+
+Description:
+Puts an LED on a hardware PWM channel, or changes the duty of the channel it already has.
+
+Requires:
+  - eLED_ is a valid LED index
+  - 0 < u16OnCounts_ < LED_HW_PWM_TOP (the toggle pairs need both edges in every period)
+
+Promises:
+  - Returns TRUE with the LED driven by TIMER2/GPIOTE at u16OnCounts_ / LED_HW_PWM_TOP duty
+  - Returns FALSE with nothing changed if the LED is not in LED_HW_PWM_LEDS, is covered by a compositor layer or
+    every channel is taken
+*/
+bool LedHwPwmStart(LedNumberType eLED_, u16 u16OnCounts_)
+{
+  u8 u8Channel = LED_HW_PWM_FREE;
+
+  /* A pin under a compositor layer has to stay under GPIO control */
+  if( !(LED_HW_PWM_LEDS & ((u32)1 << eLED_)) || (Led_sLayerFront.u32Mask & LED_BIT(eLED_)) )
+  {
+    return(false);
+  }
+
+  /* Prefer the LED's own channel, otherwise the first free one */
+  for(u8 i = 0; i < LED_HW_PWM_CHANNELS; i++)
+  {
+    if(Led_au8HwPwmLed[i] == (u8)eLED_)
+    {
+      u8Channel = i;
+      break;
+    }
+
+    if( (Led_au8HwPwmLed[i] == LED_HW_PWM_FREE) && (u8Channel == LED_HW_PWM_FREE) )
+    {
+      u8Channel = i;
+    }
+  }
+
+  if(u8Channel == LED_HW_PWM_FREE)
+  {
+    return(false);
+  }
+
+  /* Nothing to do if the duty is unchanged */
+  if( (Led_au8HwPwmLed[u8Channel] == (u8)eLED_) && (Led_au16HwPwmCounts[u8Channel] == u16OnCounts_) )
+  {
+    return(true);
+  }
+
+  Led_au8HwPwmLed[u8Channel] = (u8)eLED_;
+  Led_au16HwPwmCounts[u8Channel] = u16OnCounts_;
+  Led_u32HwPwm |= (u32)1 << eLED_;
+  LedHwPwmApply();
+
+  return(true);
+
+} /* end LedHwPwmStart() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedHwPwmRelease
+
+Description:
+Takes an LED off its hardware PWM channel, if it has one.
+
+Requires:
+  - eLED_ is a valid LED index
+
+Promises:
+  - The LED's channel is free and its pin is back under GPIO control at the level of its Led_u32On bit
+  - Costs one bit test for LEDs without a channel
+*/
+void LedHwPwmRelease(LedNumberType eLED_)
+{
+  u32 u32Bit = (u32)1 << eLED_;
+
+  if( !(Led_u32HwPwm & u32Bit) )
+  {
+    return;
+  }
+
+  for(u8 i = 0; i < LED_HW_PWM_CHANNELS; i++)
+  {
+    if(Led_au8HwPwmLed[i] == (u8)eLED_)
+    {
+      Led_au8HwPwmLed[i] = LED_HW_PWM_FREE;
+    }
+  }
+  Led_u32HwPwm &= ~u32Bit;
+
+  /* Set the GPIO level first so the pin does not glitch when GPIOTE lets go of it */
+  if(Led_u32On & u32Bit)
+  {
+    LedCommit(Led_au32BitPositions[eLED_], 0);
+  }
+  else
+  {
+    LedCommit(0, Led_au32BitPositions[eLED_]);
+  }
+  LedHwPwmApply();
+
+} /* end LedHwPwmRelease() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedHwPwmApply
+
+Description:
+Reprograms TIMER2, PPI and GPIOTE from Led_au8HwPwmLed[] and Led_au16HwPwmCounts[].  A GPIOTE toggle channel
+misses an edge if its CC moves past the running count, so the timer is stopped and every channel restarts from the
+beginning of a period at its on level.  Other channels see at most one 1ms period stretched.
+
+Requires:
+  - LedInitialize() has set up TIMER2
+
+Promises:
+  - Each used channel toggles its LED at COMPARE[n] and COMPARE[LED_HW_PWM_PERIOD_CC] through two PPI channels:
+    even channels are lit from 0 to their count, odd channels from LED_HW_PWM_TOP minus their count to the end
+  - Unused GPIOTE channels are disabled and their PPI channels are off
+  - TIMER2 runs only while at least one channel is used
+*/
+void LedHwPwmApply(void)
+{
+  u32 u32PpiEnable = 0;
+  u32 u32Pin;
+  u32 u32OutInit;
+  u8 u8Ppi;
+  bool bLit;
+
+  NRF_TIMER2->TASKS_STOP = 1;
+  NRF_TIMER2->TASKS_CLEAR = 1;
+  NRF_PPI->CHENCLR = LED_HW_PWM_PPI_MASK;
+
+  for(u8 i = 0; i < LED_HW_PWM_CHANNELS; i++)
+  {
+    if(Led_au8HwPwmLed[i] == LED_HW_PWM_FREE)
+    {
+      NRF_GPIOTE->CONFIG[i] = GPIOTE_CONFIG_MODE_Disabled << GPIOTE_CONFIG_MODE_Pos;
+      continue;
+    }
+
+    u32Pin = Led_au8PinNumbers[Led_au8HwPwmLed[i]];
+    /* Even channels are lit from the start of the period, odd ones up to its end, so two channels only overlap
+    when their duties add up to more than 100% */
+    bLit = ((i & 1) == 0);
+    if(Leds_asLedArray[Led_au8HwPwmLed[i]].eActiveState == LED_ACTIVE_LOW)
+    {
+      bLit = !bLit;
+    }
+
+    u32OutInit = bLit ? GPIOTE_CONFIG_OUTINIT_High : GPIOTE_CONFIG_OUTINIT_Low;
+
+    NRF_GPIOTE->CONFIG[i] = (GPIOTE_CONFIG_MODE_Task       << GPIOTE_CONFIG_MODE_Pos)     |
+                            (u32Pin                        << GPIOTE_CONFIG_PSEL_Pos)     |
+                            (GPIOTE_CONFIG_POLARITY_Toggle << GPIOTE_CONFIG_POLARITY_Pos) |
+                            (u32OutInit                    << GPIOTE_CONFIG_OUTINIT_Pos);
+    NRF_TIMER2->CC[i] = (i & 1) ? (LED_HW_PWM_TOP - Led_au16HwPwmCounts[i]) : Led_au16HwPwmCounts[i];
+
+    u8Ppi = (u8)(LED_HW_PWM_PPI_FIRST + 2 * i);
+    NRF_PPI->CH[u8Ppi].EEP = (u32)&NRF_TIMER2->EVENTS_COMPARE[i];
+    NRF_PPI->CH[u8Ppi].TEP = (u32)&NRF_GPIOTE->TASKS_OUT[i];
+    NRF_PPI->CH[u8Ppi + 1].EEP = (u32)&NRF_TIMER2->EVENTS_COMPARE[LED_HW_PWM_PERIOD_CC];
+    NRF_PPI->CH[u8Ppi + 1].TEP = (u32)&NRF_GPIOTE->TASKS_OUT[i];
+    u32PpiEnable |= (u32)0x3 << u8Ppi;
+  }
+
+  if(u32PpiEnable != 0)
+  {
+    NRF_PPI->CHENSET = u32PpiEnable;
+    NRF_TIMER2->TASKS_START = 1;
+  }
+
+} /* end LedHwPwmApply() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedRelease
+
+Description:
+Takes an LED back from whichever fade, timeline or hardware scheme (hardware PWM or BAM) is driving it before a
+direct change.
+
+Requires:
+  - eLED_ is a valid LED index
+
+Promises:
+  - The LED's pin is under GPIO control at the level of its Led_u32On bit
+*/
+void LedRelease(LedNumberType eLED_)
+{
+  Led_u32Fading &= ~LED_BIT(eLED_);
+  if(Led_u32Timeline & LED_BIT(eLED_))
+  {
+    LedTimelineRelease( LED_BIT(eLED_) );
+  }
+  LedHwPwmRelease(eLED_);
+#ifdef LED_BAM
+  LedBamRelease(eLED_);
+#endif
+
+} /* end LedRelease() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedGroupWrite
+
+Description:
+Sets a set of LEDs to steady states from a mask.  Only the LEDs whose state changes have their pins written, and all
+of them in one LedCommit().
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+  - Bit n of u32State_ is the new state of LED n; bits outside u32Leds_ are ignored
+
+Promises:
+  - The LEDs leave any timeline, wave, fade, hardware PWM or BAM and are in LED_NORMAL_MODE at their new states
+  - Led_u32On (the shadow) and the pins agree for every LED in u32Leds_
+*/
+void LedGroupWrite(u32 u32Leds_, u32 u32State_)
+{
+  u32 u32Changed;
+  u32 u32HwDriven = Led_u32HwPwm;
+  u32 u32Leds = u32Leds_ & LED_ALL_MASK;
+
+#ifdef LED_BAM
+  u32HwDriven |= Led_u32Bam;
+#endif
+
+  if(Led_u32Timeline & u32Leds)
+  {
+    LedTimelineRelease(u32Leds);
+  }
+  LedWaveStop(u32Leds);
+  Led_u32Fading &= ~u32Leds;
+
+  for(u8 i = 0; u32Leds != 0; i++, u32Leds >>= 1)
+  {
+    if(u32Leds & 1)
+    {
+      if(u32HwDriven & LED_BIT(i))
+      {
+        LedRelease( (LedNumberType)i );
+      }
+      Leds_asLedArray[i].eMode = LED_NORMAL_MODE;
+      Led_au8Brightness[i] = (u32State_ & LED_BIT(i)) ? 0xFF : 0;
+    }
+  }
+
+  u32Leds = u32Leds_ & LED_ALL_MASK;
+  u32Changed = (Led_u32On ^ u32State_) & u32Leds;
+  Led_u32On ^= u32Changed;
+  LedCommit(LedMaskToPins(u32Changed & Led_u32On), LedMaskToPins(u32Changed & ~Led_u32On));
+
+} /* end LedGroupWrite() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedTimelineRelease
+
+Description:
+Takes LEDs out of the LedPlay() timeline slots.  Slots playing in a layer are left alone.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - No LedPlay() slot drives any of the LEDs; slots left with no LEDs are freed
+*/
+void LedTimelineRelease(u32 u32Leds_)
+{
+  LedTimelineSlotType* psSlot = &Led_asTimelines[0];
+
+  for(u8 i = 0; i < LED_TIMELINE_SLOTS; i++, psSlot++)
+  {
+    if(psSlot->u8Layer != LED_LAYER_NONE)
+    {
+      continue;
+    }
+
+    psSlot->u32Leds &= ~u32Leds_;
+    if( (psSlot->u32Leds == 0) && (psSlot->psTimeline != NULL) )
+    {
+      psSlot->psTimeline = NULL;
+#ifdef LED_TICKLESS
+      LedHeapRemove( LED_HEAP_SLOT_ID(i) );
+#endif
+    }
+  }
+  Led_u32Timeline &= ~u32Leds_;
+
+} /* end LedTimelineRelease() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedTimelineReleaseLayer
+
+Description:
+Stops the timeline playing in a compositor layer.
+
+Requires:
+  - eLayer_ is a LedLayerType
+
+Promises:
+  - The layer's slot is freed; the layer keeps the frame it was showing
+*/
+void LedTimelineReleaseLayer(LedLayerType eLayer_)
+{
+  LedTimelineSlotType* psSlot = &Led_asTimelines[0];
+
+  for(u8 i = 0; i < LED_TIMELINE_SLOTS; i++, psSlot++)
+  {
+    if( (psSlot->psTimeline != NULL) && (psSlot->u8Layer == (u8)eLayer_) )
+    {
+      psSlot->psTimeline = NULL;
+#ifdef LED_TICKLESS
+      LedHeapRemove( LED_HEAP_SLOT_ID(i) );
+#endif
+    }
+  }
+  Led_u8LayerTimelines &= (u8)~(1 << eLayer_);
+
+} /* end LedTimelineReleaseLayer() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedTimelineFreeSlot
+
+Description:
+Finds a timeline slot that is not playing.
+
+Requires:
+  -
+
+Promises:
+  - Returns the first free slot, or NULL if every slot is playing
+*/
+LedTimelineSlotType* LedTimelineFreeSlot(void)
+{
+  for(u8 i = 0; i < LED_TIMELINE_SLOTS; i++)
+  {
+    if(Led_asTimelines[i].psTimeline == NULL)
+    {
+      return(&Led_asTimelines[i]);
+    }
+  }
+
+  return(NULL);
+
+} /* end LedTimelineFreeSlot() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedTimelineShow
+
+Description:
+Loads a slot's current frame: updates Led_u32On for its LEDs, adds their pins to the commit masks and restarts the
+frame countdown.  The pin conversion only runs when a frame changes.  A slot playing in a layer redraws the layer
+instead and adds no pins.
+
+Requires:
+  - psSlot_ is playing a timeline and u8Frame is a valid frame of it
+
+Promises:
+  - The slot's LEDs that the frame lights are added to *pu32OnPins_ and the others to *pu32OffPins_, or the slot's
+    layer covers its LEDs and lights the ones the frame lights
+  - u16Count is the frame's length
+*/
+void LedTimelineShow(LedTimelineSlotType* psSlot_, u32* pu32OnPins_, u32* pu32OffPins_)
+{
+  const LedKeyframeType* psFrame = &psSlot_->psTimeline->psFrames[psSlot_->u8Frame];
+  u32 u32On = psFrame->u32On & psSlot_->u32Leds;
+  LedLayerContentType* psLayer;
+
+  if(psSlot_->u8Layer != LED_LAYER_NONE)
+  {
+    psLayer = &Led_asLayers[psSlot_->u8Layer];
+    psLayer->u32Mask = psSlot_->u32Leds;
+    psLayer->u32On = u32On;
+    LedLayerBlend();
+  }
+  else
+  {
+    Led_u32On = (Led_u32On & ~psSlot_->u32Leds) | u32On;
+    *pu32OnPins_ |= LedMaskToPins(u32On);
+    *pu32OffPins_ |= LedMaskToPins(psSlot_->u32Leds & ~u32On);
+  }
+  psSlot_->u16Count = psFrame->u16Ms;
+#ifdef LED_TICKLESS
+  LedHeapSet( LED_HEAP_SLOT_ID(psSlot_ - &Led_asTimelines[0]), Led_u32NowMs + psFrame->u16Ms );
+#endif
+
+} /* end LedTimelineShow() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedTimelineStep
+
+Description:
+Moves a slot on to its next frame when the current one has run out.
+
+Requires:
+  - psSlot_ is playing a timeline and its current frame has just ended
+
+Promises:
+  - The next frame is shown (see LedTimelineShow()), going back to u8LoopFrame after the last frame
+  - After the last pass, the slot is freed and its LEDs keep the last frame
+*/
+void LedTimelineStep(LedTimelineSlotType* psSlot_, u32* pu32OnPins_, u32* pu32OffPins_)
+{
+  psSlot_->u8Frame++;
+  if(psSlot_->u8Frame == psSlot_->psTimeline->u8Frames)
+  {
+    if(psSlot_->u8Passes != LED_TIMELINE_FOREVER)
+    {
+      psSlot_->u8Passes--;
+      if(psSlot_->u8Passes == 0)
+      {
+        /* Finished: the last frame stays lit */
+        if(psSlot_->u8Layer != LED_LAYER_NONE)
+        {
+          LedTimelineReleaseLayer( (LedLayerType)psSlot_->u8Layer );
+        }
+        else
+        {
+          LedTimelineRelease(psSlot_->u32Leds);
+        }
+        return;
+      }
+    }
+    psSlot_->u8Frame = psSlot_->psTimeline->u8LoopFrame;
+  }
+
+  LedTimelineShow(psSlot_, pu32OnPins_, pu32OffPins_);
+
+} /* end LedTimelineStep() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedWaveStop
+
+Description:
+Stops the blink or software PWM wave of a set of LEDs.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - The LEDs are out of Led_u32Animated (and out of the deadline heap with LED_TICKLESS); their state is unchanged
+*/
+void LedWaveStop(u32 u32Leds_)
+{
+#ifdef LED_TICKLESS
+  u32 u32Stopping = Led_u32Animated & u32Leds_;
+
+  for(u8 i = 0; u32Stopping != 0; i++, u32Stopping >>= 1)
+  {
+    if(u32Stopping & 1)
+    {
+      LedHeapRemove(i);
+    }
+  }
+#endif /* LED_TICKLESS */
+
+  Led_u32Animated &= ~u32Leds_;
+
+} /* end LedWaveStop() */
+
+
+#ifdef LED_TICKLESS
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedHeapSet
+
+Description:
+Adds an LED or timeline slot to the deadline heap, or moves its deadline if it is already there.
+
+Requires:
+  - u8Id_ is an LED (LedNumberType) or LED_HEAP_SLOT_ID(slot)
+  - u32Deadline_ is within 2^31 ms of Led_u32NowMs (compares use the signed difference, so the time base can wrap)
+
+Promises:
+  - The entry for u8Id_ has u32Deadline_ and the heap is ordered again: O(log n), at most 5 levels for 24 entries
+*/
+void LedHeapSet(u8 u8Id_, u32 u32Deadline_)
+{
+  u8 u8Index = Led_au8HeapIndex[u8Id_];
+
+  if(u8Index == LED_HEAP_NONE)
+  {
+    u8Index = Led_u8HeapCount++;
+    Led_asHeap[u8Index].u8Id = u8Id_;
+    Led_au8HeapIndex[u8Id_] = u8Index;
+  }
+
+  Led_asHeap[u8Index].u32Deadline = u32Deadline_;
+  LedHeapSift(u8Index);
+
+} /* end LedHeapSet() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedHeapRemove
+
+Description:
+Takes an LED or timeline slot out of the deadline heap.
+
+Requires:
+  - u8Id_ is an LED (LedNumberType) or LED_HEAP_SLOT_ID(slot)
+
+Promises:
+  - u8Id_ is not in the heap; the last entry fills its place and is sifted into order
+*/
+void LedHeapRemove(u8 u8Id_)
+{
+  u8 u8Index = Led_au8HeapIndex[u8Id_];
+
+  if(u8Index == LED_HEAP_NONE)
+  {
+    return;
+  }
+
+  Led_au8HeapIndex[u8Id_] = LED_HEAP_NONE;
+  Led_u8HeapCount--;
+  if(u8Index == Led_u8HeapCount)
+  {
+    return;
+  }
+
+  Led_asHeap[u8Index] = Led_asHeap[Led_u8HeapCount];
+  Led_au8HeapIndex[Led_asHeap[u8Index].u8Id] = u8Index;
+  LedHeapSift(u8Index);
+
+} /* end LedHeapRemove() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedHeapSift
+
+Description:
+Restores the heap order around one entry whose deadline changed: up while it is earlier than its parent, otherwise
+down while a child is earlier.
+
+Requires:
+  - u8Index_ < Led_u8HeapCount and every other entry is in heap order
+
+Promises:
+  - Led_asHeap[0] is the earliest deadline and Led_au8HeapIndex[] matches the moved entries
+*/
+void LedHeapSift(u8 u8Index_)
+{
+  LedDeadlineType sEntry = Led_asHeap[u8Index_];
+  u8 u8Parent;
+  u8 u8Child;
+
+  while(u8Index_ > 0)
+  {
+    u8Parent = (u8)((u8Index_ - 1) >> 1);
+    if( (s32)(sEntry.u32Deadline - Led_asHeap[u8Parent].u32Deadline) >= 0 )
+    {
+      break;
+    }
+
+    Led_asHeap[u8Index_] = Led_asHeap[u8Parent];
+    Led_au8HeapIndex[Led_asHeap[u8Index_].u8Id] = u8Index_;
+    u8Index_ = u8Parent;
+  }
+
+  while(1)
+  {
+    u8Child = (u8)((u8Index_ << 1) + 1);
+    if(u8Child >= Led_u8HeapCount)
+    {
+      break;
+    }
+
+    if( (u8Child + 1 < Led_u8HeapCount) &&
+        ((s32)(Led_asHeap[u8Child + 1].u32Deadline - Led_asHeap[u8Child].u32Deadline) < 0) )
+    {
+      u8Child++;
+    }
+
+    if( (s32)(Led_asHeap[u8Child].u32Deadline - sEntry.u32Deadline) >= 0 )
+    {
+      break;
+    }
+
+    Led_asHeap[u8Index_] = Led_asHeap[u8Child];
+    Led_au8HeapIndex[Led_asHeap[u8Index_].u8Id] = u8Index_;
+    u8Index_ = u8Child;
+  }
+
+  Led_asHeap[u8Index_] = sEntry;
+  Led_au8HeapIndex[sEntry.u8Id] = u8Index_;
+
+} /* end LedHeapSift() */
+#endif /* LED_TICKLESS */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedMaskToPins
+
+Description:
+Converts a mask of LEDs to a mask of their port pins.
+
+Requires:
+  - u32Leds_ is a mask of LEDs (bit n = LedNumberType n)
+
+Promises:
+  - Returns the OR of Led_au32BitPositions[] for each LED in u32Leds_
+*/
+u32 LedMaskToPins(u32 u32Leds_)
+{
+  u32 u32Pins = 0;
+
+  for(u8 i = 0; u32Leds_ != 0; i++, u32Leds_ >>= 1)
+  {
+    if(u32Leds_ & 1)
+    {
+      u32Pins |= Led_au32BitPositions[i];
+    }
+  }
+
+  return(u32Pins);
+
+} /* end LedMaskToPins() */
+
+
+#ifdef LED_BAM
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedBamSetPlanes
+
+Description:
+Puts an LED's level into the bit plane masks and starts the BAM frame if it was stopped.
+
+Requires:
+  - eLED_ is a valid LED index and u8Level_ its 8-bit level
+  - LedInitialize() has set up TIMER2 for BAM
+
+Promises:
+  - In plane n the LED's pin is in u32Set or u32Clr (swapped for active-low) according to bit n of u8Level_
+  - The TIMER2 interrupt is masked while the planes change so no plane is shown half updated
+  - Led_u32Bam includes the LED and TIMER2 is running
+*/
+void LedBamSetPlanes(LedNumberType eLED_, u8 u8Level_)
+{
+  u32 u32Pin = Led_au32BitPositions[eLED_];
+  u8 u8Lit = u8Level_;
+
+  /* An active-low pin is lit by clearing it */
+  if(LED_ACTIVE_LOW_PINS & u32Pin)
+  {
+    u8Lit = (u8)~u8Level_;
+  }
+
+  NVIC_DisableIRQ(TIMER2_IRQn);
+  for(u8 i = 0; i < LED_BAM_PLANES; i++, u8Lit >>= 1)
+  {
+    if(u8Lit & 1)
+    {
+      Led_asBamPlanes[i].u32Set |= u32Pin;
+      Led_asBamPlanes[i].u32Clr &= ~u32Pin;
+    }
+    else
+    {
+      Led_asBamPlanes[i].u32Clr |= u32Pin;
+      Led_asBamPlanes[i].u32Set &= ~u32Pin;
+    }
+  }
+
+  /* First BAM LED: start a frame at plane 0 */
+  if(Led_u32Bam == 0)
+  {
+    Led_u8BamPlane = 0;
+    NRF_GPIO->OUTSET = Led_asBamPlanes[0].u32Set;
+    NRF_GPIO->OUTCLR = Led_asBamPlanes[0].u32Clr;
+    NRF_TIMER2->CC[0] = LED_BAM_UNIT;
+    NRF_TIMER2->TASKS_CLEAR = 1;
+    NRF_TIMER2->EVENTS_COMPARE[0] = 0;
+    NRF_TIMER2->TASKS_START = 1;
+  }
+  Led_u32Bam |= (u32)1 << eLED_;
+  NVIC_EnableIRQ(TIMER2_IRQn);
+
+} /* end LedBamSetPlanes() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: LedBamRelease
+
+Description:
+Takes an LED out of the BAM bit planes, if it is in them.
+
+Requires:
+  - eLED_ is a valid LED index
+
+Promises:
+  - The LED's pin is in no plane mask and is at the level of its Led_u32On bit
+  - TIMER2 is stopped when no LED is left in BAM
+  - Costs one bit test for LEDs not in BAM
+*/
+void LedBamRelease(LedNumberType eLED_)
+{
+  u32 u32Bit = (u32)1 << eLED_;
+  u32 u32Pin = Led_au32BitPositions[eLED_];
+
+  if( !(Led_u32Bam & u32Bit) )
+  {
+    return;
+  }
+
+  NVIC_DisableIRQ(TIMER2_IRQn);
+  for(u8 i = 0; i < LED_BAM_PLANES; i++)
+  {
+    Led_asBamPlanes[i].u32Set &= ~u32Pin;
+    Led_asBamPlanes[i].u32Clr &= ~u32Pin;
+  }
+
+  Led_u32Bam &= ~u32Bit;
+  if(Led_u32Bam == 0)
+  {
+    NRF_TIMER2->TASKS_STOP = 1;
+    NRF_TIMER2->EVENTS_COMPARE[0] = 0;
+    NVIC_ClearPendingIRQ(TIMER2_IRQn);
+  }
+  NVIC_EnableIRQ(TIMER2_IRQn);
+
+  if(Led_u32On & u32Bit)
+  {
+    LedCommit(u32Pin, 0);
+  }
+  else
+  {
+    LedCommit(0, u32Pin);
+  }
+
+} /* end LedBamRelease() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TIMER2_IRQHandler
+
+Description:
+End of a BAM bit plane: shows the next plane and sets its length.  TIMER2 has already cleared itself at CC[0] and
+is counting the new plane, so CC[0] only has to be written before the count reaches the new length.  If interrupt
+latency has already carried the count past it (plane 0 is only 8us), the compare would not come until TIMER2
+wrapped at 0xFFFF, a 65ms glitch; instead the plane is ended at once by clearing TIMER2 and pending this handler.
+
+Requires:
+  - LED_BAM, TIMER2 set up by LedInitialize()
+
+Promises:
+  - The next plane's masks are on the port and CC[0] is its length
+  - A plane whose length had already passed when CC[0] was written is ended at once and counted in u32BamLateCompares
+  - Once per frame (the plane 7 to plane 0 wrap) the frame is counted and the time from the compare event to the
+    new plane being written, interrupt latency included, is recorded to the nearest 1us (16 cycles)
+*/
+void TIMER2_IRQHandler(void)
+{
+  u32 u32Counts;
+  u32 u32Cycles;
+  u8 u8Plane;
+
+  NRF_TIMER2->EVENTS_COMPARE[0] = 0;
+  u8Plane = (u8)( (Led_u8BamPlane + 1) & (LED_BAM_PLANES - 1) );
+  NRF_GPIO->OUTSET = Led_asBamPlanes[u8Plane].u32Set;
+  NRF_GPIO->OUTCLR = Led_asBamPlanes[u8Plane].u32Clr;
+  NRF_TIMER2->CC[0] = LED_BAM_UNIT << u8Plane;
+  Led_u8BamPlane = u8Plane;
+
+  /* TIMER2 has been counting 1us steps since the compare event cleared it */
+  NRF_TIMER2->TASKS_CAPTURE[1] = 1;
+  u32Counts = NRF_TIMER2->CC[1];
+  if( (u32Counts >= (LED_BAM_UNIT << u8Plane)) && (NRF_TIMER2->EVENTS_COMPARE[0] == 0) )
+  {
+    NRF_TIMER2->TASKS_CLEAR = 1;
+    NVIC_SetPendingIRQ(TIMER2_IRQn);
+    Led_sStats.u32BamLateCompares++;
+  }
+
+  if(u8Plane == 0)
+  {
+    u32Cycles = u32Counts * (HFCLK_FREQ / 1000000);
+    Led_sStats.u32BamFrames++;
+    Led_sStats.u32BamIsrCycles = u32Cycles;
+    if(u32Cycles > Led_sStats.u32BamIsrWorstCycles)
+    {
+      Led_sStats.u32BamIsrWorstCycles = u32Cycles;
+    }
+  }
+
+} /* end TIMER2_IRQHandler() */
+#endif /* LED_BAM */
 
 
 /*--------------------------------------------------------------------------------------------------------------------*/
@@ -19,14 +19,13 @@ RESULT FROM USING THIS FIRMWARE IN WHOLE OR IN PART.
 /******************************************************************************
 Type Definitions
 ******************************************************************************/
-typedef enum {HOME1 = 0, HOME2, HOME3, HOME4, HOME5, HOME6, HOME7, HOME8, HOME9, 
-              AWAY1, AWAY2, AWAY3, AWAY4, AWAY5, AWAY6, AWAY7, AWAY8, AWAY9,
-              STATUS_RED, STATUS_YLW, STATUS_GRN} LedNumberType;
+/* LEDs in the order of ANTTT_BOARD_LEDS in the board header: HOME1-HOME9, AWAY1-AWAY9, STATUS_RED/YLW/GRN */
+#define LED_NUMBER_ENUM(led, pin, active)   led,
+typedef enum {ANTTT_BOARD_LEDS(LED_NUMBER_ENUM)} LedNumberType;
 
 typedef enum {LED_NORMAL_MODE, LED_PWM_MODE, LED_BLINK_MODE} LedModeType;
 typedef enum {LED_PORTA = 0, LED_PORTB = 0x80} LedPortType;  /* Offset between port registers (in 32 bit words) */
 typedef enum {LED_ACTIVE_LOW = 0, LED_ACTIVE_HIGH = 1} LedActiveType;
-typedef enum {LED_PWM_DUTY_LOW = 0, LED_PWM_DUTY_HIGH = 1} LedPWMDutyType;
 
 #define LED_PWM_PERIOD    (u8)20
 
@@ -39,20 +38,159 @@ typedef enum {LED_0_5HZ = 1000, LED_1HZ = 500, LED_2HZ = 250, LED_4HZ = 125, LED
               LED_PWM_100 = LED_PWM_PERIOD
              } LedRateType;
 
+/* Blink and PWM are both a square wave: u16OnTicks on, u16OffTicks off.  Whether the LED is in its on or off phase
+is its bit in Led_u32On. */
 typedef struct 
 {
   LedModeType eMode;
   LedRateType eRate;
-  u16 u16Count;
-  LedPWMDutyType eCurrentDuty;
+  u16 u16Count;                 /* Ticks left in the current phase */
+  u16 u16OnTicks;               /* Length of the on phase */
+  u16 u16OffTicks;              /* Length of the off phase */
   LedActiveType eActiveState;
 }LedConfigType;
 
+typedef struct
+{
+  u32 u32Updates;               /* LedUpdate() calls that did LED work (timed) */
+  u32 u32LastCycles;            /* Cycles taken by the last LedUpdate() (TIMER1 capture) */
+  u32 u32WorstCycles;           /* Longest LedUpdate() */
+  u32 u32TotalCycles;           /* Sum over all calls: average is u32TotalCycles / u32Updates */
+  u32 u32BamFrames;             /* Complete BAM frames shown (refresh rate = frames per second) */
+  u32 u32BamIsrCycles;          /* Compare event to plane written, last timed BAM interrupt (one per frame, 1us) */
+  u32 u32BamIsrWorstCycles;     /* Longest timed BAM interrupt */
+  u32 u32BamLateCompares;       /* BAM planes whose compare had passed before it was written (ended at once) */
+  u32 u32Ticks;                 /* LedUpdate() calls */
+  u32 u32Wakeups;               /* Calls that had LED work to do (the rest could have been slept through) */
+  u32 u32WindowWakeups;         /* Wake-ups in the last LED_WAKE_WINDOW_TICKS window */
+  u32 u32WakeCurrentNa;         /* Estimated average current of those wake-ups (LED_WAKE_CHARGE_NC each) */
+  u32 u32PeakLit;               /* Most LEDs lit at once (hardware PWM and BAM LEDs count as lit) */
+  u32 u32BudgetTicks;           /* Ticks spent multiplexing because more than LED_MAX_LIT were lit */
+} LedStatsType;
+
+/* Compositor layers, lowest priority first: each LED shows the highest layer that covers it */
+typedef enum {LED_LAYER_BOARD = 0, LED_LAYER_HIGHLIGHT, LED_LAYER_STATUS, LED_LAYER_OVERLAY} LedLayerType;
+
+/* What one layer (or the blend of all of them) draws */
+typedef struct
+{
+  u32 u32Mask;                  /* LEDs covered (bit n = LedNumberType n) */
+  u32 u32On;                    /* Covered LEDs that are lit */
+} LedLayerContentType;
+
+/* LedFade() progress of one LED: Bresenham stepping of u16Delta levels over u16Ms ticks */
+typedef struct
+{
+  u16 u16Ms;                    /* Length of the fade */
+  u16 u16TicksLeft;             /* Ticks to the end of the fade */
+  u16 u16Delta;                 /* Levels between the start and the target */
+  u16 u16Error;                 /* Accumulated u16Delta; one step per u16Ms in it */
+  u8 u8Target;                  /* Brightness to end at */
+} LedFadeType;
+
+/* Next edge of one LED or timeline slot in the LED_TICKLESS heap */
+typedef struct
+{
+  u32 u32Deadline;              /* Led_u32NowMs (G_u32SystemTime1ms) value at which it is due */
+  u8 u8Id;                      /* LedNumberType, or LED_HEAP_SLOT_ID() for a timeline slot */
+} LedDeadlineType;
+
+/* One BAM bit plane: port pins to set and to clear while it is shown.  Active-low pins are already swapped. */
+typedef struct
+{
+  u32 u32Set;
+  u32 u32Clr;
+} LedBamPlaneType;
+
+/* One step of a timeline, kept in flash */
+typedef struct
+{
+  u32 u32On;                    /* LEDs lit (bit n = LedNumberType n); LEDs the timeline is not played on are ignored */
+  u16 u16Ms;                    /* Time the frame is shown (1 or more) */
+} LedKeyframeType;
+
+/* A keyframed LED sequence, kept in flash.  Frames before u8LoopFrame play once, then frames u8LoopFrame to the end
+play u8Passes times (LED_TIMELINE_FOREVER to loop until interrupted).  A finished timeline leaves its last frame lit. */
+typedef struct
+{
+  const LedKeyframeType* psFrames;
+  u8 u8Frames;
+  u8 u8LoopFrame;
+  u8 u8Passes;
+} LedTimelineType;
+
+/* A timeline being played */
+typedef struct
+{
+  const LedTimelineType* psTimeline;  /* NULL when the slot is free */
+  u32 u32Leds;                  /* LEDs the slot still drives */
+  u16 u16Count;                 /* ms left in the current frame */
+  u8 u8Frame;                   /* Frame being shown */
+  u8 u8Passes;                  /* Loop passes left (LED_TIMELINE_FOREVER for no limit) */
+  u8 u8Layer;                   /* LedLayerType drawn in, or LED_LAYER_NONE when the slot drives the LEDs */
+} LedTimelineSlotType;
+
 
 /******************************************************************************
 * Constants
 ******************************************************************************/
-#define TOTAL_LEDS            (u8)21        /* Total number of LEDs in the system */
+#define LED_COUNT_ONE(led, pin, active)     + 1
+#define TOTAL_LEDS            (u8)(0 ANTTT_BOARD_LEDS(LED_COUNT_ONE))   /* Total number of LEDs in the system */
+
+/* Port pins of the active-low LEDs, which LedCommit() swaps between OUTSET and OUTCLR */
+#define LED_ACTIVE_LOW_BIT(led, pin, active) | (((active) == LED_ACTIVE_LOW) ? BOARD_MASK(pin) : 0)
+#define LED_ACTIVE_LOW_PINS   ((u32)(0 ANTTT_BOARD_LEDS(LED_ACTIVE_LOW_BIT)))
+
+/* LEDs that LedPWM() may move onto a TIMER2/GPIOTE hardware channel (bit n = LedNumberType n).  The first
+LED_HW_PWM_CHANNELS of them to be PWMed get channels; the rest use software PWM.  BAM needs TIMER2 for itself. */
+#ifdef LED_BAM
+#ifdef LED_HW_PWM_LEDS
+#error "LED_BAM uses TIMER2: hardware PWM (LED_HW_PWM_LEDS) cannot be used with it"
+#else
+#define LED_HW_PWM_LEDS       (u32)0
+#endif
+#endif
+
+#ifndef LED_HW_PWM_LEDS
+#define LED_HW_PWM_LEDS       ( ((u32)1 << STATUS_RED) | ((u32)1 << STATUS_YLW) | ((u32)1 << STATUS_GRN) )
+#endif
+
+#define LED_HW_PWM_COUNTS_PER_STEP  (u16)(LED_HW_PWM_TOP / LED_PWM_PERIOD)  /* Hardware counts per LedRateType step */
+#define LED_HW_PWM_FREE       (u8)0xFF      /* Led_au8HwPwmLed[] value of an unused channel */
+
+/* LED masks: bit n = LedNumberType n */
+#define LED_BIT(eLED)         ((u32)1 << (eLED))
+#define LED_HOME_MASK         ((u32)0x1FF << HOME1)
+#define LED_AWAY_MASK         ((u32)0x1FF << AWAY1)
+#define LED_STATUS_MASK       (LED_BIT(STATUS_RED) | LED_BIT(STATUS_YLW) | LED_BIT(STATUS_GRN))
+#define LED_ALL_MASK          ((u32)0x1FFFFF)
+
+#define LED_TIMELINE_SLOTS    (u8)3         /* Timelines that can play at once */
+#define LED_TIMELINE_FOREVER  (u8)0         /* u8Passes value that loops until the timeline is interrupted */
+
+#define LED_LAYERS            (u8)4         /* LedLayerType values */
+#define LED_LAYER_NONE        (u8)0xFF      /* LedTimelineSlotType u8Layer of a timeline played with LedPlay() */
+#define LED_FRAME_TICKS       (u8)LED_PWM_PERIOD   /* Layer changes are shown at this period (software PWM period) */
+
+/* LED_TICKLESS deadline heap: one entry per LED plus one per timeline slot */
+#define LED_HEAP_SIZE         (u8)(TOTAL_LEDS + LED_TIMELINE_SLOTS)
+#define LED_HEAP_SLOT_ID(n)   (u8)(TOTAL_LEDS + (n))
+#define LED_HEAP_NONE         (u8)0xFF
+#define LED_NO_EDGE           (u32)0xFFFFFFFF   /* LedMsToNextEdge(): nothing animated */
+
+/* Wake-up instrumentation.  The charge of one wake-up is an estimate for the nRF51 at 16MHz: ~4.4mA running from
+flash for ~20us of wake, LedUpdate() and return to sleep. */
+#define LED_WAKE_WINDOW_TICKS (u16)1024     /* 1.024s */
+#define LED_WAKE_CHARGE_NC    (u32)88       /* nC per wake-up */
+
+/* Current budget (configuration.h): GPIO-driven LEDs lit at once, and the start offset between LED waves */
+#ifndef LED_MAX_LIT
+#define LED_MAX_LIT           (u32)TOTAL_LEDS
+#endif
+
+#ifndef LED_PHASE_STEP_MS
+#define LED_PHASE_STEP_MS     (u16)0
+#endif
 
 
 
@@ -63,14 +201,64 @@ typedef struct
 void LedOn(LedNumberType eLED_);
 void LedOff(LedNumberType eLED_);
 void LedToggle(LedNumberType eLED_);
+void LedGroupOn(u32 u32Leds_);
+void LedGroupOff(u32 u32Leds_);
+void LedGroupToggle(u32 u32Leds_);
+void LedShowBoard(u16 u16Home_, u16 u16Away_);
 void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_);
 void LedBlink(LedNumberType eLED_, LedRateType ePwmRate_);
+void LedSetLevel(LedNumberType eLED_, u8 u8Level_);
+void LedSetBrightness(LedNumberType eLED_, u8 u8Brightness_);
+void LedFade(LedNumberType eLED_, u8 u8Target_, u16 u16Ms_);
+void LedSetCalibration(LedNumberType eLED_, u8 u8Scale_);
+void LedLayerSet(LedLayerType eLayer_, u32 u32Leds_, u32 u32On_);
+void LedLayerClear(LedLayerType eLayer_);
+const LedStatsType* LedGetStats(void);
+bool LedPlay(const LedTimelineType* psTimeline_, u32 u32Leds_);
+bool LedPlayLayer(const LedTimelineType* psTimeline_, LedLayerType eLayer_, u32 u32Leds_);
+void LedStop(u32 u32Leds_);
+bool LedIsPlaying(u32 u32Leds_);
+u32 LedMsToNextEdge(void);
 
 /* Protected Functions */
 void LedInitialize(void);
 
 /* Private Functions */
 void LedUpdate(void);
+void LedCommit(u32 u32OnPins_, u32 u32OffPins_);
+void LedSetWave(LedNumberType eLED_, LedModeType eMode_, LedRateType eRate_, u16 u16OnTicks_, u16 u16OffTicks_);
+bool LedHwPwmStart(LedNumberType eLED_, u16 u16OnCounts_);
+void LedHwPwmRelease(LedNumberType eLED_);
+void LedHwPwmApply(void);
+void LedRelease(LedNumberType eLED_);
+LedTimelineSlotType* LedTimelineFreeSlot(void);
+void LedTimelineRelease(u32 u32Leds_);
+void LedTimelineReleaseLayer(LedLayerType eLayer_);
+void LedTimelineShow(LedTimelineSlotType* psSlot_, u32* pu32OnPins_, u32* pu32OffPins_);
+void LedTimelineStep(LedTimelineSlotType* psSlot_, u32* pu32OnPins_, u32* pu32OffPins_);
+u32 LedMaskToPins(u32 u32Leds_);
+void LedWaveStop(u32 u32Leds_);
+void LedGroupWrite(u32 u32Leds_, u32 u32State_);
+void LedWritePins(u32 u32OnPins_, u32 u32OffPins_);
+void LedCommitShown(u32 u32OnPins_, u32 u32OffPins_);
+void LedLayerBlend(void);
+void LedLayerFlip(void);
+u32 LedBudgetShow(u32 u32Leds_, u32 u32HwDriven_, u32 u32Count_);
+u32 LedCountBits(u32 u32Mask_);
+u8 LedCalibratedLevel(LedNumberType eLED_, u8 u8Brightness_);
+void LedShowBrightness(LedNumberType eLED_, u8 u8Brightness_);
+void LedFadeStep(void);
+u8 LedLevelStep(u8 u8Level_);
+void LedWindowTick(u32 u32Ms_);
+#ifdef LED_TICKLESS
+void LedHeapSet(u8 u8Id_, u32 u32Deadline_);
+void LedHeapRemove(u8 u8Id_);
+void LedHeapSift(u8 u8Index_);
+#endif
+#ifdef LED_BAM
+void LedBamRelease(LedNumberType eLED_);
+void LedBamSetPlanes(LedNumberType eLED_, u8 u8Level_);
+#endif
 
 
 /******************************************************************************
@@ -59,12 +59,16 @@ void SD_EVT_IRQHandler(void)
 {
    u32 u32Event;
 
+  AntttLoadBegin(ANTTT_LOAD_ANT);
+  
   /* Read out all current SOC events */
   while (sd_ant_event_get(&u32Event) != NRF_ERROR_NOT_FOUND)
   {
     /* Flag if there are any ANT events */
     G_u32SystemFlags |= _SYSTEM_ANT_EVENT; 
   }
+  
+  AntttLoadEnd(ANTTT_LOAD_ANT);
 }
 
 /**
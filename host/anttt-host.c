@@ -0,0 +1,82 @@
+/***********************************************************************************************************************
+File: anttt-host.c
+
+Description:
+Stand-in for the board support and driver functions that the application calls, so application sources can be
+compiled and run on a Linux host.  LED calls do nothing.  Cycle captures read CLOCK_MONOTONIC and are scaled to
+16MHz counts so code that measures with SystemCycleCapture() reports target-equivalent units.
+***********************************************************************************************************************/
+
+#include <time.h>
+
+#include "configuration.h"
+
+/***********************************************************************************************************************
+Global variable definitions with scope across entire project.
+All Global variable names shall start with "G_"
+***********************************************************************************************************************/
+/* New variables */
+volatile u32 G_u32SystemFlags = 0;                     /* Global system flags */
+volatile u32 G_u32SystemTime1ms;                       /* Global system time incremented every ms */
+volatile u32 G_u32SystemTime1s;                        /* Global system time incremented every second */
+
+const LedTimelineType G_sLedTimelineWinLine = {NULL, 0, 0, 0};   /* Timelines are never played on the host */
+const LedTimelineType G_sLedTimelineDraw    = {NULL, 0, 0, 0};
+const LedTimelineType G_sLedTimelineWaiting = {NULL, 0, 0, 0};
+
+
+/***********************************************************************************************************************
+Function Definitions
+***********************************************************************************************************************/
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Board functions */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemCycleCapture
+
+Description:
+Host version: monotonic time in 16MHz counts (62.5ns).  Unlike the target, the value does not roll every 1ms.
+*/
+u32 SystemCycleCapture(void)
+{
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (u32)((uint64_t)sNow.tv_sec * HFCLK_FREQ + ((uint64_t)sNow.tv_nsec * 2) / 125) );
+
+} /* end SystemCycleCapture() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: SystemCyclesElapsed
+*/
+u32 SystemCyclesElapsed(u32 u32StartCycle_)
+{
+  return(SystemCycleCapture() - u32StartCycle_);
+
+} /* end SystemCyclesElapsed() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* LED driver */
+/*--------------------------------------------------------------------------------------------------------------------*/
+void LedOn(LedNumberType eLED_)                               { (void)eLED_; }
+void LedOff(LedNumberType eLED_)                              { (void)eLED_; }
+void LedToggle(LedNumberType eLED_)                           { (void)eLED_; }
+void LedShowBoard(u16 u16Home_, u16 u16Away_)                { (void)u16Home_; (void)u16Away_; }
+void LedPWM(LedNumberType eLED_, LedRateType ePwmRate_)       { (void)eLED_; (void)ePwmRate_; }
+void LedBlink(LedNumberType eLED_, LedRateType eBlinkRate_)   { (void)eLED_; (void)eBlinkRate_; }
+bool LedPlay(const LedTimelineType* psTimeline_, u32 u32Leds_) { (void)psTimeline_; (void)u32Leds_; return(false); }
+bool LedIsPlaying(u32 u32Leds_)                               { (void)u32Leds_; return(false); }
+void LedLayerClear(LedLayerType eLayer_)                      { (void)eLayer_; }
+bool LedPlayLayer(const LedTimelineType* psTimeline_, LedLayerType eLayer_, u32 u32Leds_)
+{
+  (void)psTimeline_; (void)eLayer_; (void)u32Leds_; return(false);
+}
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
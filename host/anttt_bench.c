@@ -0,0 +1,170 @@
+/***********************************************************************************************************************
+File: anttt_bench.c
+
+Description:
+Host benchmark for the anttt.c bitboard game core.  Every one of the 3^9 cell combinations is built once, then
+AntttGameStatus() is run over the whole set, and AntttMakeMove() + AntttGameStatus() is run for every empty cell
+of every position.  AntttSymCanonicalize() and AntttTableLookup() are timed over the same set.  Reports
+positions/sec, moves/sec, canonicalizations/sec and lookups/sec on the host.  The target equivalent is AntttBenchmark()
+in anttt.c (define ANTTT_BENCHMARK in configuration.h), which reports cycles per move from TIMER1 captures.
+
+Build and run from the repository root:
+  gcc -O2 -Ihost -Iapplication -Ibsp host/anttt_bench.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_hash.c application/anttt_search.c application/anttt_table.c \
+      application/anttt_journal.c application/anttt_mnk.c application/anttt_mcts.c -o anttt_bench
+  ./anttt_bench [passes]
+***********************************************************************************************************************/
+
+#include <time.h>
+
+#include "configuration.h"
+
+#define BENCH_POSITIONS         (u32)19683        /* 3^9 */
+#define BENCH_DEFAULT_PASSES    (u32)500
+
+
+static AntttBoardType Bench_asBoards[BENCH_POSITIONS];
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchSeconds
+
+Description:
+Returns the monotonic time in seconds.
+*/
+static double BenchSeconds(void)
+{
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (double)sNow.tv_sec + (double)sNow.tv_nsec * 1e-9 );
+
+} /* end BenchSeconds() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(int argc, char* argv[])
+{
+  u32 u32Passes = BENCH_DEFAULT_PASSES;
+  u32 u32Code;
+  u32 u32Moves = 0;
+  u32 au32Status[4] = {0};
+  u32 u32Checksum = 0;
+  double dStart;
+  double dStatusTime;
+  double dMoveTime;
+  double dCanonicalTime;
+  double dLookupTime;
+  AntttBoardType sMove;
+  u16 u16Own;
+  u16 u16Opponent;
+
+  if(argc > 1)
+  {
+    u32Passes = (u32)strtoul(argv[1], NULL, 0);
+  }
+
+  /* Build every combination: base-3 digit 0 = empty, 1 = HOME, 2 = AWAY */
+  for(u32 i = 0; i < BENCH_POSITIONS; i++)
+  {
+    u32Code = i;
+    Bench_asBoards[i].u16Home = 0;
+    Bench_asBoards[i].u16Away = 0;
+    for(u8 j = 0; j < ANTTT_CELLS; j++)
+    {
+      if(u32Code % 3 == 1)
+      {
+        Bench_asBoards[i].u16Home |= (u16)(1 << j);
+      }
+      else if(u32Code % 3 == 2)
+      {
+        Bench_asBoards[i].u16Away |= (u16)(1 << j);
+      }
+      u32Code /= 3;
+    }
+    au32Status[AntttGameStatus(&Bench_asBoards[i])]++;
+  }
+
+  /* Status checks */
+  dStart = BenchSeconds();
+  for(u32 u32Pass = 0; u32Pass < u32Passes; u32Pass++)
+  {
+    for(u32 i = 0; i < BENCH_POSITIONS; i++)
+    {
+      u32Checksum += AntttGameStatus(&Bench_asBoards[i]);
+    }
+  }
+  dStatusTime = BenchSeconds() - dStart;
+
+  /* Move + status for every empty cell */
+  dStart = BenchSeconds();
+  for(u32 u32Pass = 0; u32Pass < u32Passes; u32Pass++)
+  {
+    for(u32 i = 0; i < BENCH_POSITIONS; i++)
+    {
+      for(u8 j = 0; j < ANTTT_CELLS; j++)
+      {
+        sMove = Bench_asBoards[i];
+        if(AntttMakeMove(&sMove, (AntttSideType)(j & 1), j))
+        {
+          u32Checksum += AntttGameStatus(&sMove);
+          u32Moves++;
+        }
+      }
+    }
+  }
+  dMoveTime = BenchSeconds() - dStart;
+
+  /* Symmetry reduction of every position */
+  dStart = BenchSeconds();
+  for(u32 u32Pass = 0; u32Pass < u32Passes; u32Pass++)
+  {
+    for(u32 i = 0; i < BENCH_POSITIONS; i++)
+    {
+      u16Own = Bench_asBoards[i].u16Home;
+      u16Opponent = Bench_asBoards[i].u16Away;
+      u32Checksum += AntttSymCanonicalize(&u16Own, &u16Opponent);
+      u32Checksum += u16Own ^ u16Opponent;
+    }
+  }
+  dCanonicalTime = BenchSeconds() - dStart;
+
+  /* AI table lookup of every position */
+  dStart = BenchSeconds();
+  for(u32 u32Pass = 0; u32Pass < u32Passes; u32Pass++)
+  {
+    for(u32 i = 0; i < BENCH_POSITIONS; i++)
+    {
+      u32Checksum += AntttTableLookup(Bench_asBoards[i].u16Home, Bench_asBoards[i].u16Away);
+    }
+  }
+  dLookupTime = BenchSeconds() - dStart;
+
+  printf("positions: %u (active %u, HOME wins %u, AWAY wins %u, draws %u)\n", BENCH_POSITIONS,
+         au32Status[ANTTT_GAME_ACTIVE], au32Status[ANTTT_GAME_HOME_WIN], au32Status[ANTTT_GAME_AWAY_WIN],
+         au32Status[ANTTT_GAME_DRAW]);
+  printf("status checks: %.0f positions/sec (%.2f ns each)\n",
+         (double)BENCH_POSITIONS * u32Passes / dStatusTime, dStatusTime * 1e9 / ((double)BENCH_POSITIONS * u32Passes));
+  printf("move + status: %.0f moves/sec (%.2f ns each)\n",
+         (double)u32Moves / dMoveTime, dMoveTime * 1e9 / (double)u32Moves);
+  printf("canonicalize: %.0f positions/sec (%.2f ns each)\n",
+         (double)BENCH_POSITIONS * u32Passes / dCanonicalTime,
+         dCanonicalTime * 1e9 / ((double)BENCH_POSITIONS * u32Passes));
+#ifdef ANTTT_TABLE_FULL
+  printf("full table lookup: %.0f lookups/sec (%.2f ns each)\n",
+#else
+  printf("canonical table lookup: %.0f lookups/sec (%.2f ns each)\n",
+#endif /* ANTTT_TABLE_FULL */
+         (double)BENCH_POSITIONS * u32Passes / dLookupTime, dLookupTime * 1e9 / ((double)BENCH_POSITIONS * u32Passes));
+  printf("checksum: %u\n", u32Checksum);
+
+  return(0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
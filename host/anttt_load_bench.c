@@ -0,0 +1,136 @@
+/***********************************************************************************************************************
+File: anttt_load_bench.c
+
+Description:
+Host run of the main loop with the load accounting in anttt_load.c.  Each 1ms pass runs AntttRunActiveState() as
+the game task and then sleeps to the next 1ms boundary, charging both as main.c and SystemSleep() do on target.
+HOME is played by the tool (a random legal move every BENCH_MOVE_MS on its turn) against the on-board opponent at
+the chosen level, and a new game starts shortly after each one ends.  Once a second the tool prints the window from
+AntttLoadGetStats(): the game's time in ns and each subsystem's share in per-mille.  LEDs and ANT do not run on the
+host, so they stay at 0.
+
+The numbers are host nanoseconds, so they show where a change moves the load (e.g. a slower search slice) rather
+than target cycles; the target figures are in AntttLoadGetStats() on the board.
+
+Build and run from the repository root:
+  gcc -O2 -Ihost -Iapplication -Ibsp host/anttt_load_bench.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_hash.c application/anttt_search.c application/anttt_table.c \
+      application/anttt_journal.c application/anttt_mnk.c application/anttt_mcts.c application/anttt_load.c \
+      -o anttt_load_bench
+  ./anttt_load_bench [seconds] [level 0-3]
+***********************************************************************************************************************/
+
+#include <time.h>
+
+#include "configuration.h"
+
+#define BENCH_DEFAULT_SECONDS   (u32)5
+#define BENCH_MOVE_MS           (u32)200          /* HOME thinks this long before each move */
+#define BENCH_RESTART_MS        (u32)500          /* Pause between games */
+
+extern volatile u32 G_u32SystemTime1ms;                /* From anttt-host.c */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchSleepUntil
+
+Description:
+Sleeps to an absolute CLOCK_MONOTONIC time and returns the next 1ms boundary after it.
+*/
+static struct timespec BenchSleepUntil(struct timespec sDeadline_)
+{
+  clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &sDeadline_, NULL);
+
+  sDeadline_.tv_nsec += 1000000;
+  if(sDeadline_.tv_nsec >= 1000000000)
+  {
+    sDeadline_.tv_nsec -= 1000000000;
+    sDeadline_.tv_sec++;
+  }
+  return(sDeadline_);
+
+} /* end BenchSleepUntil() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(int argc, char* argv[])
+{
+  static const char* apcNames[ANTTT_LOAD_SUBSYSTEMS] = {"leds", "game", "ant", "sleep", "system"};
+  const AntttLoadStatsType* psStats = AntttLoadGetStats();
+  u32 u32Seconds = BENCH_DEFAULT_SECONDS;
+  u32 u32Windows = 0;
+  u32 u32Wait = 0;
+  struct timespec sDeadline;
+
+  if(argc > 1)
+  {
+    u32Seconds = (u32)strtoul(argv[1], NULL, 0);
+  }
+  if(argc > 2)
+  {
+    AntttSetLevel( (AntttLevelType)strtoul(argv[2], NULL, 0) );
+  }
+
+  srand(1);
+  AntttLoadInitialize();
+  AntttInitialize();
+
+  clock_gettime(CLOCK_MONOTONIC, &sDeadline);
+  sDeadline = BenchSleepUntil(sDeadline);
+
+  while(u32Windows < u32Seconds)
+  {
+    /* Game task, with HOME's moves and new games counted as game time */
+    AntttLoadBegin(ANTTT_LOAD_GAME);
+    AntttRunActiveState();
+    if(AntttGetStatus() != ANTTT_GAME_ACTIVE)
+    {
+      if(++u32Wait >= BENCH_RESTART_MS)
+      {
+        u32Wait = 0;
+        AntttNewGame(ANTTT_HOME);
+      }
+    }
+    else if( (AntttJournalPly() & 1) == 0 )
+    {
+      if(++u32Wait >= BENCH_MOVE_MS)
+      {
+        u32Wait = 0;
+        while( !AntttPlayMove((u8)(rand() % ANTTT_CELLS)) );
+      }
+    }
+    AntttLoadEnd(ANTTT_LOAD_GAME);
+
+    AntttLoadBegin(ANTTT_LOAD_SYSTEM);
+    AntttLoadTick();
+    AntttLoadEnd(ANTTT_LOAD_SYSTEM);
+
+    /* Sleep to the next tick */
+    AntttLoadBegin(ANTTT_LOAD_SLEEP);
+    sDeadline = BenchSleepUntil(sDeadline);
+    AntttLoadEnd(ANTTT_LOAD_SLEEP);
+    G_u32SystemTime1ms++;
+
+    if(psStats->u32Windows != u32Windows)
+    {
+      u32Windows = psStats->u32Windows;
+      printf("window %u (%u ns): game %u ns", u32Windows, psStats->u32WindowUnits,
+             psStats->au32Units[ANTTT_LOAD_GAME]);
+      for(u8 u8Subsystem = 0; u8Subsystem < ANTTT_LOAD_SUBSYSTEMS; u8Subsystem++)
+      {
+        printf(", %s %u", apcNames[u8Subsystem], psStats->au16PerMille[u8Subsystem]);
+      }
+      printf(", unaccounted %u (per-mille)\n", psStats->u16UnaccountedPerMille);
+    }
+  }
+
+  return(0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
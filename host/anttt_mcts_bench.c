@@ -0,0 +1,232 @@
+/***********************************************************************************************************************
+File: anttt_mcts_bench.c
+
+Description:
+Host benchmark for the Monte Carlo tree search in anttt_mcts.c.  Every search runs one AntttMctsRun() slice at a
+time exactly as AntttSM_UltimateComputerMove() does on target, with a fixed number of playouts per move, and both
+sides' moves are passed to AntttMctsAdvance() so the tree is reused and compacted between moves.
+
+  - ultimate tic-tac-toe: the search (AWAY) against random moves and against the one-ply opponent
+    (AntttUltimateChooseMove()) that plays EASY and MEDIUM on the board
+  - the m,n,k board anttt_mnk.c is built for: the search (AWAY) against random moves
+
+Reports playouts/sec on the host, results, arena use and how much the compaction kept and reclaimed.  Every move
+the search returns is checked for legality.  The arena size is set at compile time like on target.
+
+Slice times are host time: the overruns reported come from the process being preempted.  The target playout rate
+is measured by AntttBenchmark() (ANTTT_BENCHMARK) and kept for every move in AntttMctsGetStats().
+
+Build and run from the repository root (4x4, 4 in a row shown; the ultimate part does not depend on it):
+  gcc -O2 -Ihost -Iapplication -Ibsp -DANTTT_MNK_WIDTH=4 -DANTTT_MNK_HEIGHT=4 -DANTTT_MNK_K=4 \
+      host/anttt_mcts_bench.c host/anttt-host.c application/anttt.c application/anttt_symmetry.c \
+      application/anttt_hash.c application/anttt_search.c application/anttt_table.c application/anttt_mnk.c \
+      application/anttt_journal.c application/anttt_mcts.c -o anttt_mcts_bench
+  ./anttt_mcts_bench [playouts_per_move] [games]
+Add -DANTTT_MCTS_ARENA_BYTES=<bytes> to try another arena.
+***********************************************************************************************************************/
+
+#include <time.h>
+
+#include "configuration.h"
+
+#define BENCH_DEFAULT_PLAYOUTS  (u32)1000
+#define BENCH_DEFAULT_GAMES     (u32)20
+#define BENCH_BUDGET_US         (u32)900
+
+typedef enum {BENCH_RANDOM = 0, BENCH_ONE_PLY} BenchOpponentType;
+
+extern const AntttMctsGameType G_sAntttMctsUltimate;
+extern const AntttMctsGameType G_sAntttMctsMnk;
+
+
+static u32 Bench_u32Random = 0x2545F491;
+static u32 Bench_u32Playouts;                              /* Playouts per search move */
+static u32 Bench_u32TotalPlayouts;
+static double Bench_dSearchTime;
+static u32 Bench_u32Errors;
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchSeconds
+*/
+static double BenchSeconds(void)
+{
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (double)sNow.tv_sec + (double)sNow.tv_nsec * 1e-9 );
+
+} /* end BenchSeconds() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchRandom
+*/
+static u32 BenchRandom(void)
+{
+  Bench_u32Random ^= Bench_u32Random << 13;
+  Bench_u32Random ^= Bench_u32Random >> 17;
+  Bench_u32Random ^= Bench_u32Random << 5;
+
+  return(Bench_u32Random);
+
+} /* end BenchRandom() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchSearch
+
+Description:
+Runs one search to completion in slices and returns its move, checked against the legal moves of psState_.
+*/
+static u8 BenchSearch(const AntttMctsGameType* psGame_, const AntttMctsStateType* psState_)
+{
+  u8 au8Moves[ANTTT_MCTS_MAX_MOVES];
+  u8 u8Count;
+  u8 u8Move;
+  double dStart = BenchSeconds();
+
+  AntttMctsStart(Bench_u32Playouts, 0);
+  while( !AntttMctsRun(BENCH_BUDGET_US) );
+  Bench_dSearchTime += BenchSeconds() - dStart;
+  Bench_u32TotalPlayouts += AntttMctsGetStats()->u32LastPlayouts;
+
+  u8Move = AntttMctsResult();
+  u8Count = psGame_->pfnLegalMoves(psState_, au8Moves);
+  for(u8 i = 0; i < u8Count; i++)
+  {
+    if(au8Moves[i] == u8Move)
+    {
+      return(u8Move);
+    }
+  }
+
+  printf("illegal move 0x%02X from the search\n", u8Move);
+  Bench_u32Errors++;
+  return(au8Moves[0]);
+
+} /* end BenchSearch() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchPlay
+
+Description:
+Plays one game with the search as AWAY against eOpponent_ as HOME (HOME moves first).  Returns the final status.
+*/
+static AntttGameStatusType BenchPlay(const AntttMctsGameType* psGame_, const AntttMctsStateType* psStart_,
+                                     BenchOpponentType eOpponent_)
+{
+  AntttMctsStateType sState = *psStart_;
+  AntttSideType eSide = ANTTT_HOME;
+  u8 au8Moves[ANTTT_MCTS_MAX_MOVES];
+  u8 u8Count;
+  u8 u8Move;
+
+  AntttMctsNewGame(psGame_, &sState, ANTTT_HOME);
+  while(psGame_->pfnStatus(&sState) == ANTTT_GAME_ACTIVE)
+  {
+    if(eSide == ANTTT_AWAY)
+    {
+      u8Move = BenchSearch(psGame_, &sState);
+    }
+    else if(eOpponent_ == BENCH_ONE_PLY)
+    {
+      u8Move = AntttUltimateChooseMove(&sState.sUltimate, eSide);
+    }
+    else
+    {
+      u8Count = psGame_->pfnLegalMoves(&sState, au8Moves);
+      u8Move = au8Moves[BenchRandom() % u8Count];
+    }
+
+    psGame_->pfnMakeMove(&sState, eSide, u8Move);
+    AntttMctsAdvance(u8Move);
+    eSide = (AntttSideType)(eSide ^ ANTTT_AWAY);
+  }
+
+  return( psGame_->pfnStatus(&sState) );
+
+} /* end BenchPlay() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchMatch
+
+Description:
+Plays u32Games_ games and prints the search's results.
+*/
+static void BenchMatch(const char* pcName_, const AntttMctsGameType* psGame_, const AntttMctsStateType* psStart_,
+                       BenchOpponentType eOpponent_, u32 u32Games_)
+{
+  u32 au32Results[4] = {0};
+
+  for(u32 g = 0; g < u32Games_; g++)
+  {
+    au32Results[ BenchPlay(psGame_, psStart_, eOpponent_) ]++;
+  }
+
+  printf("%-34s: %3u wins, %3u losses, %3u draws\n", pcName_, au32Results[ANTTT_GAME_AWAY_WIN],
+         au32Results[ANTTT_GAME_HOME_WIN], au32Results[ANTTT_GAME_DRAW]);
+
+} /* end BenchMatch() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(int argc, char* argv[])
+{
+  const AntttMctsStatsType* psStats = AntttMctsGetStats();
+  u32 u32Games = BENCH_DEFAULT_GAMES;
+  AntttMctsStateType sUltimate;
+  AntttMctsStateType sMnk;
+  char acName[40];
+
+  Bench_u32Playouts = BENCH_DEFAULT_PLAYOUTS;
+  if(argc > 1)
+  {
+    Bench_u32Playouts = (u32)strtoul(argv[1], NULL, 0);
+  }
+  if(argc > 2)
+  {
+    u32Games = (u32)strtoul(argv[2], NULL, 0);
+  }
+
+  AntttMctsInitialize();
+  AntttMctsSeed(1);
+  AntttUltimateClear(&sUltimate.sUltimate);
+  AntttMnkClear(&sMnk.sMnk);
+
+  printf("arena %u bytes = %u nodes (+%u bytes compaction marks), %u playouts per move\n",
+         ANTTT_MCTS_ARENA_BYTES, (u32)ANTTT_MCTS_NODES,
+         (u32)(sizeof(u32) + sizeof(u16)) * ANTTT_MCTS_LIVE_WORDS, Bench_u32Playouts);
+
+  BenchMatch("ultimate, search vs random", &G_sAntttMctsUltimate, &sUltimate, BENCH_RANDOM, u32Games);
+  BenchMatch("ultimate, search vs one-ply", &G_sAntttMctsUltimate, &sUltimate, BENCH_ONE_PLY, u32Games);
+  printf("ultimate playouts: %.0f/sec on the host\n", Bench_u32TotalPlayouts / Bench_dSearchTime);
+
+  Bench_u32TotalPlayouts = 0;
+  Bench_dSearchTime = 0;
+  snprintf(acName, sizeof(acName), "%dx%dx%d, search vs random", ANTTT_MNK_WIDTH, ANTTT_MNK_HEIGHT, ANTTT_MNK_K);
+  BenchMatch(acName, &G_sAntttMctsMnk, &sMnk, BENCH_RANDOM, u32Games);
+  printf("%dx%dx%d playouts: %.0f/sec on the host\n", ANTTT_MNK_WIDTH, ANTTT_MNK_HEIGHT, ANTTT_MNK_K,
+         Bench_u32TotalPlayouts / Bench_dSearchTime);
+
+  printf("arena: peak %u of %u nodes, %u expansions refused when full\n", psStats->u16NodesPeak,
+         (u32)ANTTT_MCTS_NODES, psStats->u32ArenaFull);
+  printf("reuse: %u compactions reclaimed %u nodes, %u trees restarted\n", psStats->u32Compactions,
+         psStats->u32NodesReclaimed, psStats->u32TreeResets);
+  printf("slices: worst %.1f us, worst step %.1f us, overruns %u (budget %u us)\n",
+         (double)psStats->u32WorstSliceCycles / ANTTT_SEARCH_CYCLES_PER_US,
+         (double)psStats->u32WorstStepCycles / ANTTT_SEARCH_CYCLES_PER_US, psStats->u32Overruns, BENCH_BUDGET_US);
+  printf("%s: %u errors\n", Bench_u32Errors ? "FAIL" : "PASS", Bench_u32Errors);
+
+  return(Bench_u32Errors ? 1 : 0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
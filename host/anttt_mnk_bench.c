@@ -0,0 +1,229 @@
+/***********************************************************************************************************************
+File: anttt_mnk_bench.c
+
+Description:
+Host benchmark for the m,n,k engine in anttt_mnk.c.  Random games are generated first (a shuffled order of all
+squares per game) so the timed loop only runs the engine: AntttMnkMakeMove() + AntttMnkGameStatus() for each move
+until the game is won or drawn.  Reports moves/sec and the memory one position takes.
+
+Every position reached is also checked against a plain line-by-line scan so the shifted-bitboard detection is
+proven for the board size being built.
+
+Build and run from the repository root, once per board:
+  gcc -O2 -Ihost -Iapplication -Ibsp -DANTTT_MNK_WIDTH=3 -DANTTT_MNK_HEIGHT=3 -DANTTT_MNK_K=3 \
+      host/anttt_mnk_bench.c host/anttt-host.c application/anttt_mnk.c -o anttt_mnk_bench_333
+  gcc ... -DANTTT_MNK_WIDTH=4 -DANTTT_MNK_HEIGHT=4 -DANTTT_MNK_K=4 ... -o anttt_mnk_bench_444
+  gcc ... -DANTTT_MNK_WIDTH=5 -DANTTT_MNK_HEIGHT=5 -DANTTT_MNK_K=4 ... -o anttt_mnk_bench_554
+  ./anttt_mnk_bench_554 [games]
+***********************************************************************************************************************/
+
+#include <time.h>
+
+#include "configuration.h"
+
+#define BENCH_DEFAULT_GAMES     (u32)100000
+#define BENCH_MAX_LINES         (u32)64
+
+
+static u32 Bench_au32Lines[BENCH_MAX_LINES];
+static u32 Bench_u32LineCount;
+static u32 Bench_u32Random = 0x2545F491;
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchSeconds
+*/
+static double BenchSeconds(void)
+{
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (double)sNow.tv_sec + (double)sNow.tv_nsec * 1e-9 );
+
+} /* end BenchSeconds() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchRandom
+*/
+static u32 BenchRandom(void)
+{
+  Bench_u32Random ^= Bench_u32Random << 13;
+  Bench_u32Random ^= Bench_u32Random >> 17;
+  Bench_u32Random ^= Bench_u32Random << 5;
+
+  return(Bench_u32Random);
+
+} /* end BenchRandom() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchBuildLines
+
+Description:
+Lists every line of ANTTT_MNK_K squares by walking rows, columns and both diagonals with column/row arithmetic,
+independently of the shifted-bitboard code.
+*/
+static void BenchBuildLines(void)
+{
+  static const int aiDirections[4][2] = { {1, 0}, {0, 1}, {1, 1}, {-1, 1} };
+  int iColumn;
+  int iRow;
+  u32 u32Line;
+
+  for(int r = 0; r < ANTTT_MNK_HEIGHT; r++)
+  {
+    for(int c = 0; c < ANTTT_MNK_WIDTH; c++)
+    {
+      for(int d = 0; d < 4; d++)
+      {
+        u32Line = 0;
+        iColumn = c;
+        iRow = r;
+        for(int i = 0; i < ANTTT_MNK_K; i++)
+        {
+          if( (iColumn < 0) || (iColumn >= ANTTT_MNK_WIDTH) || (iRow >= ANTTT_MNK_HEIGHT) )
+          {
+            u32Line = 0;
+            break;
+          }
+          u32Line |= (u32)1 << ANTTT_MNK_SQUARE(iColumn, iRow);
+          iColumn += aiDirections[d][0];
+          iRow += aiDirections[d][1];
+        }
+
+        if(u32Line && (Bench_u32LineCount < BENCH_MAX_LINES))
+        {
+          Bench_au32Lines[Bench_u32LineCount++] = u32Line;
+        }
+      }
+    }
+  }
+
+} /* end BenchBuildLines() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchHasLine
+*/
+static bool BenchHasLine(u32 u32Squares_)
+{
+  for(u32 i = 0; i < Bench_u32LineCount; i++)
+  {
+    if( (u32Squares_ & Bench_au32Lines[i]) == Bench_au32Lines[i] )
+    {
+      return(true);
+    }
+  }
+
+  return(false);
+
+} /* end BenchHasLine() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(int argc, char* argv[])
+{
+  u32 u32Games = BENCH_DEFAULT_GAMES;
+  u8* pu8Orders;
+  u8 au8Squares[ANTTT_MNK_CELLS];
+  u8 u8Swap;
+  u32 u32Index;
+  u32 u32Moves = 0;
+  u32 u32Errors = 0;
+  u32 au32Results[4] = {0};
+  double dStart;
+  double dTime;
+  AntttMnkBoardType sBoard;
+  AntttGameStatusType eStatus;
+
+  if(argc > 1)
+  {
+    u32Games = (u32)strtoul(argv[1], NULL, 0);
+  }
+
+  BenchBuildLines();
+
+  /* Shuffled square order for every game */
+  for(u8 r = 0; r < ANTTT_MNK_HEIGHT; r++)
+  {
+    for(u8 c = 0; c < ANTTT_MNK_WIDTH; c++)
+    {
+      au8Squares[r * ANTTT_MNK_WIDTH + c] = ANTTT_MNK_SQUARE(c, r);
+    }
+  }
+
+  pu8Orders = malloc((size_t)u32Games * ANTTT_MNK_CELLS);
+  if(pu8Orders == NULL)
+  {
+    printf("out of memory\n");
+    return(1);
+  }
+
+  for(u32 g = 0; g < u32Games; g++)
+  {
+    for(u32 i = ANTTT_MNK_CELLS - 1; i > 0; i--)
+    {
+      u32Index = BenchRandom() % (i + 1);
+      u8Swap = au8Squares[i];
+      au8Squares[i] = au8Squares[u32Index];
+      au8Squares[u32Index] = u8Swap;
+    }
+    memcpy(&pu8Orders[g * ANTTT_MNK_CELLS], au8Squares, ANTTT_MNK_CELLS);
+  }
+
+  /* Check pass: shifted runs against the line scan */
+  for(u32 g = 0; g < u32Games; g++)
+  {
+    AntttMnkClear(&sBoard);
+    for(u32 i = 0; i < ANTTT_MNK_CELLS; i++)
+    {
+      AntttMnkMakeMove(&sBoard, (AntttSideType)(i & 1), pu8Orders[g * ANTTT_MNK_CELLS + i]);
+      if( ((AntttMnkRuns(sBoard.u32Home) != 0) != BenchHasLine(sBoard.u32Home)) ||
+          ((AntttMnkRuns(sBoard.u32Away) != 0) != BenchHasLine(sBoard.u32Away)) )
+      {
+        u32Errors++;
+      }
+      if(AntttMnkGameStatus(&sBoard) != ANTTT_GAME_ACTIVE)
+      {
+        break;
+      }
+    }
+  }
+
+  /* Timed pass */
+  dStart = BenchSeconds();
+  for(u32 g = 0; g < u32Games; g++)
+  {
+    AntttMnkClear(&sBoard);
+    eStatus = ANTTT_GAME_ACTIVE;
+    for(u32 i = 0; (i < ANTTT_MNK_CELLS) && (eStatus == ANTTT_GAME_ACTIVE); i++)
+    {
+      AntttMnkMakeMove(&sBoard, (AntttSideType)(i & 1), pu8Orders[g * ANTTT_MNK_CELLS + i]);
+      eStatus = AntttMnkGameStatus(&sBoard);
+      u32Moves++;
+    }
+    au32Results[eStatus]++;
+  }
+  dTime = BenchSeconds() - dStart;
+
+  printf("%dx%dx%d: %u games (HOME wins %u, AWAY wins %u, draws %u), %u lines of %d\n",
+         ANTTT_MNK_WIDTH, ANTTT_MNK_HEIGHT, ANTTT_MNK_K, u32Games, au32Results[ANTTT_GAME_HOME_WIN],
+         au32Results[ANTTT_GAME_AWAY_WIN], au32Results[ANTTT_GAME_DRAW], Bench_u32LineCount, ANTTT_MNK_K);
+  printf("move + status: %.0f moves/sec (%.2f ns each)\n", (double)u32Moves / dTime, dTime * 1e9 / u32Moves);
+  printf("memory per position: %u bytes (2 x %d of 32 mask bits + move count)\n",
+         (u32)sizeof(AntttMnkBoardType), ANTTT_MNK_BITS);
+  printf("%s: %u errors against the line scan\n", u32Errors ? "FAIL" : "PASS", u32Errors);
+
+  free(pu8Orders);
+
+  return(u32Errors ? 1 : 0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
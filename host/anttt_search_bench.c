@@ -0,0 +1,149 @@
+/***********************************************************************************************************************
+File: anttt_search_bench.c
+
+Description:
+Host check and benchmark for the time-sliced search in anttt_search.c.  Every reachable position that still has a
+move is searched at each level, one AntttSearchRun() slice at a time exactly as AntttSM_ComputerMove() does on
+target.  For each level the tool reports nodes per move, slices (ticks) per move and the worst slice against the
+budget, and how often the chosen move keeps the perfect-play value from the AI table.  HARD must always keep it.
+The transposition table is cleared for each level and its probes, hit rate and replacements are reported; positions
+are searched in table order, so later searches reuse what earlier ones stored as the board does during a game.
+
+Slice times are host time, so they show the budget being respected rather than target speed; the few overruns on
+a host come from the process being preempted.  The target figures are in AntttSearch_sStats (see
+AntttSearchGetStats()) when run on the board.
+
+Build and run from the repository root:
+  gcc -O2 -Ihost -Iapplication -Ibsp host/anttt_search_bench.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_hash.c application/anttt_search.c application/anttt_table.c \
+      application/anttt_journal.c application/anttt_mnk.c application/anttt_mcts.c -o anttt_search_bench
+  ./anttt_search_bench [budget_us]
+Add -DANTTT_HASH_TABLE_BYTES=<bytes> to try another table size.
+***********************************************************************************************************************/
+
+#include "configuration.h"
+
+#define BENCH_DEFAULT_BUDGET_US (u32)20
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(int argc, char* argv[])
+{
+  static const char* apcLevelNames[] = {"EASY", "MEDIUM", "HARD"};
+  const AntttSearchStatsType* psStats = AntttSearchGetStats();
+  const AntttHashStatsType* psHash = AntttHashGetStats();
+  u32 u32BudgetUs = BENCH_DEFAULT_BUDGET_US;
+  u32 u32Code;
+  u32 u32Positions;
+  u32 u32Kept;
+  u32 u32Nodes;
+  u32 u32WorstNodes;
+  u32 u32Ticks;
+  u32 u32Errors = 0;
+  AntttBoardType sBoard;
+  u8 u8Entry;
+  u8 u8Cell;
+  u8 u8ChildValue;
+
+  if(argc > 1)
+  {
+    u32BudgetUs = (u32)strtoul(argv[1], NULL, 0);
+  }
+
+  AntttSearchSeed(1);
+  printf("budget %u us per slice, transposition table %u entries\n", u32BudgetUs, (u32)ANTTT_HASH_ENTRIES);
+  for(u8 u8Level = ANTTT_LEVEL_EASY; u8Level <= ANTTT_LEVEL_HARD; u8Level++)
+  {
+    AntttHashInitialize();
+    AntttSearchInitialize();
+    u32Positions = 0;
+    u32Kept = 0;
+    u32Nodes = 0;
+    u32WorstNodes = 0;
+    u32Ticks = 0;
+
+    for(u32 u32Key = 0; u32Key < ANTTT_TABLE_SIZE; u32Key++)
+    {
+      /* HOME is the side to move */
+      u32Code = u32Key;
+      sBoard.u16Home = 0;
+      sBoard.u16Away = 0;
+      for(u8 i = 0; i < ANTTT_CELLS; i++)
+      {
+        if(u32Code % 3 == 1)
+        {
+          sBoard.u16Home |= (u16)(1 << i);
+        }
+        else if(u32Code % 3 == 2)
+        {
+          sBoard.u16Away |= (u16)(1 << i);
+        }
+        u32Code /= 3;
+      }
+
+      u8Entry = AntttTableLookup(sBoard.u16Home, sBoard.u16Away);
+      if( (ANTTT_TABLE_VALUE(u8Entry) == ANTTT_VALUE_INVALID) || (ANTTT_TABLE_CELL(u8Entry) == ANTTT_TABLE_NO_CELL) )
+      {
+        continue;
+      }
+
+      AntttSearchStart(&sBoard, ANTTT_HOME, (AntttLevelType)u8Level);
+      while( !AntttSearchRun(u32BudgetUs) );
+
+      u32Positions++;
+      u32Nodes += psStats->u32LastNodes;
+      u32Ticks += psStats->u32LastTicks;
+      if(psStats->u32LastNodes > u32WorstNodes)
+      {
+        u32WorstNodes = psStats->u32LastNodes;
+      }
+
+      u8Cell = AntttSearchResult();
+      if( !AntttIsLegalMove(&sBoard, u8Cell) )
+      {
+        printf("%s key %u: illegal move %u\n", apcLevelNames[u8Level], u32Key, u8Cell);
+        u32Errors++;
+        continue;
+      }
+
+      /* The child is valued for the other side: a LOSS there is a WIN here */
+      u8ChildValue = ANTTT_TABLE_VALUE( AntttTableLookup(sBoard.u16Away, (u16)(sBoard.u16Home | (1 << u8Cell))) );
+      if( AntttWinningLine((u16)(sBoard.u16Home | (1 << u8Cell))) )
+      {
+        u8ChildValue = ANTTT_VALUE_LOSS;
+      }
+
+      if( (ANTTT_VALUE_WIN - u8ChildValue) == ANTTT_TABLE_VALUE(u8Entry) )
+      {
+        u32Kept++;
+      }
+      else if(u8Level == ANTTT_LEVEL_HARD)
+      {
+        printf("HARD key %u: move %u loses value\n", u32Key, u8Cell);
+        u32Errors++;
+      }
+    }
+
+    printf("%-6s: %u positions, nodes/move avg %.1f max %u, ticks/move avg %.2f max %u, "
+           "worst slice %.1f us, overruns %u, perfect-play moves %.1f%%\n",
+           apcLevelNames[u8Level], u32Positions, (double)u32Nodes / u32Positions, u32WorstNodes,
+           (double)u32Ticks / u32Positions, psStats->u32WorstTicks,
+           (double)psStats->u32WorstSliceCycles / ANTTT_SEARCH_CYCLES_PER_US, psStats->u32Overruns,
+           100.0 * (double)u32Kept / u32Positions);
+    printf("        table: %u probes, hit rate %.1f%%, %u stores, %u replacements, %u kept deeper entries\n",
+           psHash->u32Probes, psHash->u32Probes ? 100.0 * (double)psHash->u32Hits / psHash->u32Probes : 0.0,
+           psHash->u32Stores, psHash->u32Replacements, psHash->u32Kept);
+  }
+
+  printf("%s: %u errors\n", u32Errors ? "FAIL" : "PASS", u32Errors);
+
+  return(u32Errors ? 1 : 0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,269 @@
+/***********************************************************************************************************************
+File: anttt_table_gen.c
+
+Description:
+Generates application/anttt_table.c, the flash-resident perfect-play table used by AntttBestMove().
+Every position reachable from the empty board is solved with a memoized negamax that prefers the fastest win
+and the slowest loss.  Entries are indexed by AntttTableKey() from anttt.c so the key used here is exactly the
+one used on target.  Positions that cannot occur in a legal game are stored as ANTTT_VALUE_INVALID.
+
+Both table layouts are written, selected by ANTTT_TABLE_FULL at compile time:
+  - the full table: one entry for each of the 3^9 keys
+  - the canonical table: sorted keys and entries of the reachable positions that AntttSymCanonicalize() leaves
+    unchanged.  Each one is solved directly, so its stored cell is already in the canonical frame.
+
+Build and run from the repository root:
+  gcc -O2 -Ihost -Iapplication -Ibsp host/anttt_table_gen.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_journal.c application/anttt_hash.c application/anttt_search.c \
+      application/anttt_mnk.c application/anttt_mcts.c -o anttt_table_gen
+  ./anttt_table_gen > application/anttt_table.c
+
+Check the result with host/anttt_table_verify.c.
+***********************************************************************************************************************/
+
+#include "configuration.h"
+
+/* anttt.c references the table; this placeholder lets it link while the real table is being generated */
+#ifdef ANTTT_TABLE_FULL
+const u8 G_au8AntttTable[ANTTT_TABLE_SIZE] = {0};
+#else
+const u16 G_au16AntttCanonicalKeys[ANTTT_CANONICAL_SIZE] = {0};
+const u8 G_au8AntttCanonicalTable[ANTTT_CANONICAL_SIZE] = {0};
+#endif /* ANTTT_TABLE_FULL */
+
+#define GEN_SCORE_UNSOLVED      (s8)-128
+#define GEN_WIN_SCORE           (s8)10            /* Score of a win is GEN_WIN_SCORE - pieces on the board */
+
+static s8 Gen_as8Score[ANTTT_TABLE_SIZE];
+static u8 Gen_au8Entry[ANTTT_TABLE_SIZE];
+static u16 Gen_au16CanonicalKey[ANTTT_TABLE_SIZE];
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GenCountCells
+*/
+static u8 GenCountCells(u16 u16Cells_)
+{
+  u8 u8Count = 0;
+
+  for( ; u16Cells_; u16Cells_ &= (u16)(u16Cells_ - 1))
+  {
+    u8Count++;
+  }
+
+  return(u8Count);
+
+} /* end GenCountCells() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GenSolve
+
+Description:
+Negamax score of a position for the side to move, filling in the table entry on the way.
+*/
+static s8 GenSolve(u16 u16Own_, u16 u16Opponent_)
+{
+  u16 u16Key = AntttTableKey(u16Own_, u16Opponent_);
+  u16 u16Empty = (u16)(~(u16Own_ | u16Opponent_) & ANTTT_BOARD_MASK);
+  s8 s8Best = -GEN_WIN_SCORE;
+  s8 s8Score;
+  u8 u8BestCell = ANTTT_TABLE_NO_CELL;
+  u8 u8Value;
+
+  if(Gen_as8Score[u16Key] != GEN_SCORE_UNSOLVED)
+  {
+    return(Gen_as8Score[u16Key]);
+  }
+
+  /* The opponent just completed a line */
+  if( AntttWinningLine(u16Opponent_) )
+  {
+    s8Best = -(GEN_WIN_SCORE - GenCountCells(u16Own_ | u16Opponent_));
+  }
+  /* Board full with no line */
+  else if(u16Empty == 0)
+  {
+    s8Best = 0;
+  }
+  else
+  {
+    for(u8 i = 0; i < ANTTT_CELLS; i++)
+    {
+      if(u16Empty & (1 << i))
+      {
+        s8Score = -GenSolve(u16Opponent_, (u16)(u16Own_ | (1 << i)));
+        if( (u8BestCell == ANTTT_TABLE_NO_CELL) || (s8Score > s8Best) )
+        {
+          s8Best = s8Score;
+          u8BestCell = i;
+        }
+      }
+    }
+  }
+
+  u8Value = ANTTT_VALUE_DRAW;
+  if(s8Best > 0)
+  {
+    u8Value = ANTTT_VALUE_WIN;
+  }
+  else if(s8Best < 0)
+  {
+    u8Value = ANTTT_VALUE_LOSS;
+  }
+
+  Gen_as8Score[u16Key] = s8Best;
+  Gen_au8Entry[u16Key] = (u8)((u8Value << ANTTT_TABLE_VALUE_SHIFT) | u8BestCell);
+
+  return(s8Best);
+
+} /* end GenSolve() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GenIsCanonical
+
+Description:
+Decodes a key into cell masks and returns true if the position is its own canonical form.
+*/
+static bool GenIsCanonical(u32 u32Key_)
+{
+  u16 u16Own = 0;
+  u16 u16Opponent = 0;
+  u16 u16CanonicalOwn;
+  u16 u16CanonicalOpponent;
+
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    if(u32Key_ % 3 == 1)
+    {
+      u16Own |= (u16)(1 << i);
+    }
+    else if(u32Key_ % 3 == 2)
+    {
+      u16Opponent |= (u16)(1 << i);
+    }
+    u32Key_ /= 3;
+  }
+
+  u16CanonicalOwn = u16Own;
+  u16CanonicalOpponent = u16Opponent;
+  AntttSymCanonicalize(&u16CanonicalOwn, &u16CanonicalOpponent);
+
+  return( (u16CanonicalOwn == u16Own) && (u16CanonicalOpponent == u16Opponent) );
+
+} /* end GenIsCanonical() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: GenPrintBytes
+*/
+static void GenPrintBytes(const char* pcName_, const char* pcSize_, const u8* pu8Data_, u32 u32Size_)
+{
+  printf("const u8 %s[%s] =\n", pcName_, pcSize_);
+  printf("{");
+  for(u32 i = 0; i < u32Size_; i++)
+  {
+    if( (i % 16) == 0 )
+    {
+      printf("\n ");
+    }
+    printf(" 0x%02X%s", pu8Data_[i], (i + 1 < u32Size_) ? "," : "");
+  }
+  printf("\n};\n");
+
+} /* end GenPrintBytes() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(void)
+{
+  u32 u32Reachable = 0;
+  u32 u32Canonical = 0;
+  u8 au8CanonicalEntry[ANTTT_CANONICAL_SIZE];
+
+  for(u32 i = 0; i < ANTTT_TABLE_SIZE; i++)
+  {
+    Gen_as8Score[i] = GEN_SCORE_UNSOLVED;
+    Gen_au8Entry[i] = (u8)((ANTTT_VALUE_INVALID << ANTTT_TABLE_VALUE_SHIFT) | ANTTT_TABLE_NO_CELL);
+  }
+
+  /* Roles are relative to the side to move, so one search from the empty board covers either side moving first */
+  GenSolve(0, 0);
+
+  for(u32 i = 0; i < ANTTT_TABLE_SIZE; i++)
+  {
+    if(Gen_as8Score[i] != GEN_SCORE_UNSOLVED)
+    {
+      u32Reachable++;
+      if( GenIsCanonical(i) )
+      {
+        if(u32Canonical < ANTTT_CANONICAL_SIZE)
+        {
+          Gen_au16CanonicalKey[u32Canonical] = (u16)i;
+          au8CanonicalEntry[u32Canonical] = Gen_au8Entry[i];
+        }
+        u32Canonical++;
+      }
+    }
+  }
+
+  /* Keys are visited in increasing order so the canonical list is already sorted for the binary search */
+  if(u32Canonical != ANTTT_CANONICAL_SIZE)
+  {
+    fprintf(stderr, "%u canonical positions, ANTTT_CANONICAL_SIZE is %u\n", u32Canonical, (u32)ANTTT_CANONICAL_SIZE);
+    return(1);
+  }
+
+  printf("/**********************************************************************************************************************\n");
+  printf("File: anttt_table.c\n");
+  printf("\n");
+  printf("Description:\n");
+  printf("Perfect-play table for AntttBestMove().  GENERATED by host/anttt_table_gen.c -- do not edit.\n");
+  printf("One byte per position: bits 0-3 are the best cell (ANTTT_TABLE_NO_CELL if the game is over) and bits 4-5\n");
+  printf("the value to the side to move (ANTTT_VALUE_LOSS/DRAW/WIN/INVALID).\n");
+  printf("\n");
+  printf("ANTTT_TABLE_FULL: one entry per base-3 key from AntttTableKey(); %u of %u keys are reachable.\n",
+         u32Reachable, (u32)ANTTT_TABLE_SIZE);
+  printf("Otherwise: the %u reachable positions that are their own canonical form under AntttSymCanonicalize(),\n",
+         u32Canonical);
+  printf("as sorted keys and entries.  Cells are in the canonical frame.\n");
+  printf("**********************************************************************************************************************/\n");
+  printf("\n");
+  printf("#include \"configuration.h\"\n");
+  printf("\n");
+  printf("#ifdef ANTTT_TABLE_FULL\n");
+  GenPrintBytes("G_au8AntttTable", "ANTTT_TABLE_SIZE", Gen_au8Entry, ANTTT_TABLE_SIZE);
+  printf("\n");
+  printf("#else\n");
+  printf("const u16 G_au16AntttCanonicalKeys[ANTTT_CANONICAL_SIZE] =\n");
+  printf("{");
+  for(u32 i = 0; i < u32Canonical; i++)
+  {
+    if( (i % 12) == 0 )
+    {
+      printf("\n ");
+    }
+    printf(" 0x%04X%s", Gen_au16CanonicalKey[i], (i + 1 < u32Canonical) ? "," : "");
+  }
+  printf("\n};\n");
+  printf("\n");
+  GenPrintBytes("G_au8AntttCanonicalTable", "ANTTT_CANONICAL_SIZE", au8CanonicalEntry, u32Canonical);
+  printf("\n");
+  printf("#endif /* ANTTT_TABLE_FULL */\n");
+  printf("\n");
+  printf("\n");
+  printf("/*--------------------------------------------------------------------------------------------------------------------*/\n");
+  printf("/* End of File                                                                                                        */\n");
+  printf("/*--------------------------------------------------------------------------------------------------------------------*/\n");
+
+  return(0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
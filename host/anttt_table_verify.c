@@ -0,0 +1,320 @@
+/***********************************************************************************************************************
+File: anttt_table_verify.c
+
+Description:
+Proves the perfect-play table in application/anttt_table.c against a full minimax.  The minimax here shares no
+code with the generator: it searches every position to the end of the game without memoization.  For every
+reachable position the tool checks, through AntttTableLookup() as called on target:
+  - the stored value matches the minimax value
+  - the stored cell is legal and leads to a position worth the same value
+  - game-over positions store ANTTT_TABLE_NO_CELL
+Keys that are not reachable positions must be stored as ANTTT_VALUE_INVALID.  The symmetry transforms in
+anttt_symmetry.c are checked cell by cell first, since the canonical table depends on them.  A size report
+against the flash available to the application in the IAR project (nRF51422_QFAA.icf) is printed at the end.
+
+Build and run from the repository root (add -DANTTT_TABLE_FULL to check the full table):
+  gcc -O2 -Ihost -Iapplication -Ibsp host/anttt_table_verify.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_hash.c application/anttt_search.c application/anttt_table.c \
+      application/anttt_journal.c application/anttt_mnk.c application/anttt_mcts.c -o anttt_table_verify
+  ./anttt_table_verify
+***********************************************************************************************************************/
+
+#include "configuration.h"
+
+/* Application flash from nRF51422_QFAA.icf: __ICFEDIT_region_ROM_start__ to __ICFEDIT_region_ROM_end__ */
+#define VERIFY_ROM_START        (u32)0x0000C0C0
+#define VERIFY_ROM_END          (u32)0x0003FFFF
+#define VERIFY_ROM_BYTES        (u32)(VERIFY_ROM_END - VERIFY_ROM_START + 1)
+
+/* Lookup tables in flash besides the AI table: Pow3 key tables in anttt.c, and the cell maps, inverse list and
+low/high mask tables in anttt_symmetry.c */
+#define VERIFY_KEY_TABLE_BYTES  (u32)((32 + 16) * sizeof(u16))
+#define VERIFY_SYM_TABLE_BYTES  (u32)(ANTTT_SYM_TRANSFORMS * (ANTTT_CELLS + 1 + (32 + 16) * sizeof(u16)))
+
+#ifdef ANTTT_TABLE_FULL
+extern const u8 G_au8AntttTable[ANTTT_TABLE_SIZE];
+#else
+extern const u16 G_au16AntttCanonicalKeys[ANTTT_CANONICAL_SIZE];
+extern const u8 G_au8AntttCanonicalTable[ANTTT_CANONICAL_SIZE];
+#endif /* ANTTT_TABLE_FULL */
+
+static bool Verify_abReachable[ANTTT_TABLE_SIZE];
+static u32 Verify_u32Nodes;
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: VerifyHasLine
+
+Description:
+Independent line check by rows, columns and diagonals on a cell array.
+*/
+static bool VerifyHasLine(u16 u16Cells_)
+{
+  static const u8 au8Lines[8][3] = { {0,1,2}, {3,4,5}, {6,7,8}, {0,3,6}, {1,4,7}, {2,5,8}, {0,4,8}, {2,4,6} };
+
+  for(u8 i = 0; i < 8; i++)
+  {
+    if( (u16Cells_ >> au8Lines[i][0] & 1) && (u16Cells_ >> au8Lines[i][1] & 1) && (u16Cells_ >> au8Lines[i][2] & 1) )
+    {
+      return(true);
+    }
+  }
+
+  return(false);
+
+} /* end VerifyHasLine() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: VerifyMinimax
+
+Description:
+Full minimax value for the side to move: 1 = win, 0 = draw, -1 = loss.
+*/
+static int VerifyMinimax(u16 u16Own_, u16 u16Opponent_)
+{
+  int iBest = -2;
+  int iScore;
+
+  Verify_u32Nodes++;
+  if( VerifyHasLine(u16Opponent_) )
+  {
+    return(-1);
+  }
+
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    if( !((u16Own_ | u16Opponent_) & (1 << i)) )
+    {
+      iScore = -VerifyMinimax(u16Opponent_, (u16)(u16Own_ | (1 << i)));
+      if(iScore > iBest)
+      {
+        iBest = iScore;
+      }
+    }
+  }
+
+  /* Full board */
+  if(iBest == -2)
+  {
+    return(0);
+  }
+
+  return(iBest);
+
+} /* end VerifyMinimax() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: VerifyMarkReachable
+
+Description:
+Marks every position reachable from (u16Own_, u16Opponent_) in legal play.
+*/
+static void VerifyMarkReachable(u16 u16Own_, u16 u16Opponent_)
+{
+  u16 u16Key = AntttTableKey(u16Own_, u16Opponent_);
+
+  if(Verify_abReachable[u16Key])
+  {
+    return;
+  }
+  Verify_abReachable[u16Key] = true;
+
+  if( VerifyHasLine(u16Opponent_) )
+  {
+    return;
+  }
+
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    if( !((u16Own_ | u16Opponent_) & (1 << i)) )
+    {
+      VerifyMarkReachable(u16Opponent_, (u16)(u16Own_ | (1 << i)));
+    }
+  }
+
+} /* end VerifyMarkReachable() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: VerifySymmetry
+
+Description:
+Checks every transform: the cell maps are permutations, AntttSymUnmapCell() undoes AntttSymMapCell(), the mask
+tables agree with the cell maps for all 512 masks, and win lines map onto win lines.  Returns the error count.
+*/
+static u32 VerifySymmetry(void)
+{
+  u32 u32Errors = 0;
+  u16 u16Expected;
+  u16 u16Seen;
+  u8 u8Cell;
+
+  for(u8 t = 0; t < ANTTT_SYM_TRANSFORMS; t++)
+  {
+    u16Seen = 0;
+    for(u8 i = 0; i < ANTTT_CELLS; i++)
+    {
+      u8Cell = AntttSymMapCell(t, i);
+      u16Seen |= (u16)(1 << u8Cell);
+      if(AntttSymUnmapCell(t, u8Cell) != i)
+      {
+        printf("transform %u: cell %u does not map back\n", t, i);
+        u32Errors++;
+      }
+    }
+    if(u16Seen != ANTTT_BOARD_MASK)
+    {
+      printf("transform %u: cell map is not a permutation\n", t);
+      u32Errors++;
+    }
+
+    for(u16 u16Mask = 0; u16Mask <= ANTTT_BOARD_MASK; u16Mask++)
+    {
+      u16Expected = 0;
+      for(u8 i = 0; i < ANTTT_CELLS; i++)
+      {
+        if(u16Mask & (1 << i))
+        {
+          u16Expected |= (u16)(1 << AntttSymMapCell(t, i));
+        }
+      }
+      if(AntttSymTransformMask(t, u16Mask) != u16Expected)
+      {
+        printf("transform %u: mask 0x%03X gives 0x%03X, expected 0x%03X\n", t, u16Mask,
+               AntttSymTransformMask(t, u16Mask), u16Expected);
+        u32Errors++;
+      }
+      if( VerifyHasLine(u16Mask) != VerifyHasLine(u16Expected) )
+      {
+        printf("transform %u: mask 0x%03X does not keep its lines\n", t, u16Mask);
+        u32Errors++;
+      }
+    }
+  }
+
+  return(u32Errors);
+
+} /* end VerifySymmetry() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(void)
+{
+  u32 u32Reachable = 0;
+  u32 u32Errors = 0;
+  u32 u32Code;
+  u16 u16Own;
+  u16 u16Opponent;
+  u8 u8Entry;
+  u8 u8Expected;
+  u8 u8Cell;
+  u32 u32TableBytes;
+  int iValue;
+
+  u32Errors += VerifySymmetry();
+  VerifyMarkReachable(0, 0);
+
+  for(u32 u32Key = 0; u32Key < ANTTT_TABLE_SIZE; u32Key++)
+  {
+    /* Decode the key into masks and make sure AntttTableKey() maps back to it */
+    u32Code = u32Key;
+    u16Own = 0;
+    u16Opponent = 0;
+    for(u8 i = 0; i < ANTTT_CELLS; i++)
+    {
+      if(u32Code % 3 == 1)
+      {
+        u16Own |= (u16)(1 << i);
+      }
+      else if(u32Code % 3 == 2)
+      {
+        u16Opponent |= (u16)(1 << i);
+      }
+      u32Code /= 3;
+    }
+
+    if(AntttTableKey(u16Own, u16Opponent) != u32Key)
+    {
+      printf("key %u: AntttTableKey() mismatch\n", u32Key);
+      u32Errors++;
+      continue;
+    }
+
+    u8Entry = AntttTableLookup(u16Own, u16Opponent);
+    if( !Verify_abReachable[u32Key] )
+    {
+      if(ANTTT_TABLE_VALUE(u8Entry) != ANTTT_VALUE_INVALID)
+      {
+        printf("key %u: unreachable position not marked invalid\n", u32Key);
+        u32Errors++;
+      }
+      continue;
+    }
+
+    u32Reachable++;
+    iValue = VerifyMinimax(u16Own, u16Opponent);
+    u8Expected = (u8)(ANTTT_VALUE_DRAW + iValue);
+    if(ANTTT_TABLE_VALUE(u8Entry) != u8Expected)
+    {
+      printf("key %u: value %u, minimax %u\n", u32Key, ANTTT_TABLE_VALUE(u8Entry), u8Expected);
+      u32Errors++;
+      continue;
+    }
+
+    u8Cell = ANTTT_TABLE_CELL(u8Entry);
+    if( VerifyHasLine(u16Opponent) || ((u16Own | u16Opponent) == ANTTT_BOARD_MASK) )
+    {
+      if(u8Cell != ANTTT_TABLE_NO_CELL)
+      {
+        printf("key %u: game over but a move is stored\n", u32Key);
+        u32Errors++;
+      }
+      continue;
+    }
+
+    if( (u8Cell >= ANTTT_CELLS) || ((u16Own | u16Opponent) & (1 << u8Cell)) )
+    {
+      printf("key %u: illegal move %u\n", u32Key, u8Cell);
+      u32Errors++;
+      continue;
+    }
+
+    if(-VerifyMinimax(u16Opponent, (u16)(u16Own | (1 << u8Cell))) != iValue)
+    {
+      printf("key %u: move %u does not keep value %d\n", u32Key, u8Cell, iValue);
+      u32Errors++;
+    }
+  }
+
+  printf("reachable positions: %u of %u keys, minimax nodes searched: %u\n", u32Reachable, (u32)ANTTT_TABLE_SIZE,
+         Verify_u32Nodes);
+#ifdef ANTTT_TABLE_FULL
+  u32TableBytes = (u32)sizeof(G_au8AntttTable) + VERIFY_KEY_TABLE_BYTES;
+  printf("full table: %u bytes + %u bytes key tables = %.2f%% of %u bytes application flash (0x%05X-0x%05X)\n",
+         (u32)sizeof(G_au8AntttTable), VERIFY_KEY_TABLE_BYTES, 100.0 * (double)u32TableBytes / VERIFY_ROM_BYTES,
+         VERIFY_ROM_BYTES, VERIFY_ROM_START, VERIFY_ROM_END);
+#else
+  u32TableBytes = (u32)(sizeof(G_au16AntttCanonicalKeys) + sizeof(G_au8AntttCanonicalTable)) +
+                  VERIFY_KEY_TABLE_BYTES + VERIFY_SYM_TABLE_BYTES;
+  printf("canonical table: %u positions, %u bytes keys + %u bytes entries + %u bytes key tables + "
+         "%u bytes symmetry tables\n", (u32)ANTTT_CANONICAL_SIZE, (u32)sizeof(G_au16AntttCanonicalKeys),
+         (u32)sizeof(G_au8AntttCanonicalTable), VERIFY_KEY_TABLE_BYTES, VERIFY_SYM_TABLE_BYTES);
+  printf("total %u bytes = %.2f%% of %u bytes application flash (0x%05X-0x%05X)\n", u32TableBytes,
+         100.0 * (double)u32TableBytes / VERIFY_ROM_BYTES, VERIFY_ROM_BYTES, VERIFY_ROM_START, VERIFY_ROM_END);
+  printf("flash saved against the full table (%u bytes): %u bytes\n",
+         (u32)ANTTT_TABLE_SIZE + VERIFY_KEY_TABLE_BYTES, (u32)ANTTT_TABLE_SIZE + VERIFY_KEY_TABLE_BYTES - u32TableBytes);
+#endif /* ANTTT_TABLE_FULL */
+  printf("%s: %u errors\n", u32Errors ? "FAIL" : "PASS", u32Errors);
+
+  return(u32Errors ? 1 : 0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
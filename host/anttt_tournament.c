@@ -0,0 +1,691 @@
+/***********************************************************************************************************************
+File: anttt_tournament.c
+
+Description:
+Host self-play tournament for the on-board opponents.  The game core and opponents are the application sources
+built unchanged; each variant below is one way the board can choose a move.  Every variant plays every variant
+(itself included) from both sides, and the games are spread over forked worker processes, one per CPU by default.
+
+  classic:  RANDOM, EASY, MEDIUM, HARD (time-sliced search in anttt_search.c), PERFECT (table in anttt_table.c)
+  ultimate: RANDOM, ONE-PLY (AntttUltimateChooseMove()), MCTS-200 and MCTS-1000 (anttt_mcts.c, playouts per move)
+
+Reports, for each game type:
+  - games/sec and moves/sec over all workers
+  - a win/draw/loss matrix for the variant playing HOME (row, moves first) against AWAY (column)
+  - each variant's move latency percentiles (host time, all moves it chose)
+  - a digest of every game's moves and result
+
+Game k of the run gets its own seed from the run seed, which drives the RANDOM players, the search noise and the
+tree search playouts.  The searches are reinitialized at the start of each game (transposition table, tree and
+generators), so a game's moves depend only on its seed: the same seed gives the same matrices and digest with any
+number of workers.  A changed digest means a change in what the opponents play; latencies show changes in how fast
+they play it.
+
+Build and run from the repository root:
+  gcc -O2 -Ihost -Iapplication -Ibsp host/anttt_tournament.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_journal.c application/anttt_hash.c application/anttt_search.c \
+      application/anttt_table.c application/anttt_mnk.c application/anttt_mcts.c -o anttt_tournament
+  ./anttt_tournament [games_per_pairing] [workers] [seed] [ultimate_games_per_pairing]
+***********************************************************************************************************************/
+
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "configuration.h"
+
+#define TOUR_DEFAULT_GAMES      (u32)40000        /* Classic games per pairing: 25 pairings = 1M games */
+#define TOUR_DEFAULT_ULTIMATE   (u32)20           /* Ultimate games per pairing */
+#define TOUR_DEFAULT_SEED       (u32)1
+#define TOUR_BUDGET_US          ANTTT_SEARCH_MAX_BUDGET_US  /* Longest slice the searches accept */
+#define TOUR_MAX_VARIANTS       (u8)5
+#define TOUR_MAX_WORKERS        (u32)256
+
+/* Latency histogram: exact below 16ns, then 8 buckets per power of 2 (12.5% resolution) */
+#define TOUR_LINEAR_BUCKETS     (u32)16
+#define TOUR_SUB_BUCKETS        (u32)8
+#define TOUR_BUCKETS            (u32)(TOUR_LINEAR_BUCKETS + 60 * TOUR_SUB_BUCKETS)
+
+typedef struct
+{
+  AntttBoardType sBoard;                                  /* Classic position */
+  AntttUltimateBoardType sUltimate;                       /* Ultimate position */
+  u32 u32Random;                                          /* RANDOM players' generator for this game */
+} TourGameType;
+
+typedef struct
+{
+  const char* pcName;
+  u8 (*pfnMove)(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_);
+  u32 u32Param;                                           /* Level or playouts */
+} TourVariantType;
+
+typedef struct
+{
+  const char* pcName;
+  bool bUltimate;
+  const TourVariantType* psVariants;
+  u8 u8Variants;
+} TourEventType;
+
+/* Everything a worker sends back; added up by the parent */
+typedef struct
+{
+  uint64_t au64Results[TOUR_MAX_VARIANTS][TOUR_MAX_VARIANTS][4];  /* [HOME][AWAY][AntttGameStatusType] */
+  uint64_t au64Latency[TOUR_MAX_VARIANTS][TOUR_BUCKETS];          /* Move latency histogram per variant */
+  uint64_t au64WorstNs[TOUR_MAX_VARIANTS];
+  uint64_t u64Games;
+  uint64_t u64Moves;
+  uint64_t u64Digest;                                     /* Sum of per-game hashes: order independent */
+} TourResultsType;
+
+static u8 TourRandomMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_);
+static u8 TourSearchMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_);
+static u8 TourPerfectMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_);
+static u8 TourUltimateRandomMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_);
+static u8 TourOnePlyMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_);
+static u8 TourMctsMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_);
+
+static const TourVariantType Tour_asClassic[] =
+{
+  {"RANDOM",   TourRandomMove,  0},
+  {"EASY",     TourSearchMove,  ANTTT_LEVEL_EASY},
+  {"MEDIUM",   TourSearchMove,  ANTTT_LEVEL_MEDIUM},
+  {"HARD",     TourSearchMove,  ANTTT_LEVEL_HARD},
+  {"PERFECT",  TourPerfectMove, 0}
+};
+
+static const TourVariantType Tour_asUltimate[] =
+{
+  {"RANDOM",    TourUltimateRandomMove, 0},
+  {"ONE-PLY",   TourOnePlyMove,         0},
+  {"MCTS-200",  TourMctsMove,           200},
+  {"MCTS-1000", TourMctsMove,           1000}
+};
+
+static const TourEventType Tour_asEvents[] =
+{
+  {"classic",  false, Tour_asClassic,  sizeof(Tour_asClassic) / sizeof(Tour_asClassic[0])},
+  {"ultimate", true,  Tour_asUltimate, sizeof(Tour_asUltimate) / sizeof(Tour_asUltimate[0])}
+};
+
+extern const AntttMctsGameType G_sAntttMctsUltimate;
+
+static TourResultsType Tour_sResults;                      /* This process's games */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourSeconds
+*/
+static double TourSeconds(void)
+{
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (double)sNow.tv_sec + (double)sNow.tv_nsec * 1e-9 );
+
+} /* end TourSeconds() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourNanoseconds
+*/
+static uint64_t TourNanoseconds(void)
+{
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (uint64_t)sNow.tv_sec * 1000000000ull + (uint64_t)sNow.tv_nsec );
+
+} /* end TourNanoseconds() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourMix
+
+Description:
+splitmix64 finalizer: spreads the run seed and game number into independent per-game seeds.
+*/
+static uint64_t TourMix(uint64_t u64Value_)
+{
+  u64Value_ += 0x9E3779B97F4A7C15ull;
+  u64Value_ = (u64Value_ ^ (u64Value_ >> 30)) * 0xBF58476D1CE4E5B9ull;
+  u64Value_ = (u64Value_ ^ (u64Value_ >> 27)) * 0x94D049BB133111EBull;
+
+  return(u64Value_ ^ (u64Value_ >> 31));
+
+} /* end TourMix() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourRandom
+*/
+static u32 TourRandom(TourGameType* psGame_)
+{
+  psGame_->u32Random ^= psGame_->u32Random << 13;
+  psGame_->u32Random ^= psGame_->u32Random >> 17;
+  psGame_->u32Random ^= psGame_->u32Random << 5;
+
+  return(psGame_->u32Random);
+
+} /* end TourRandom() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourBucket
+
+Description:
+Histogram bucket of a latency.
+*/
+static u32 TourBucket(uint64_t u64Ns_)
+{
+  u32 u32Exponent = 0;
+
+  if(u64Ns_ < TOUR_LINEAR_BUCKETS)
+  {
+    return( (u32)u64Ns_ );
+  }
+
+  while( (u64Ns_ >> u32Exponent) > 1 )
+  {
+    u32Exponent++;
+  }
+
+  if(u32Exponent > 63)
+  {
+    u32Exponent = 63;
+  }
+
+  return( TOUR_LINEAR_BUCKETS + (u32Exponent - 4) * TOUR_SUB_BUCKETS +
+          (u32)((u64Ns_ >> (u32Exponent - 3)) & (TOUR_SUB_BUCKETS - 1)) );
+
+} /* end TourBucket() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourBucketTop
+
+Description:
+Largest latency that falls in a bucket.
+*/
+static uint64_t TourBucketTop(u32 u32Bucket_)
+{
+  u32 u32Exponent;
+  u32 u32Sub;
+
+  if(u32Bucket_ < TOUR_LINEAR_BUCKETS)
+  {
+    return(u32Bucket_);
+  }
+
+  u32Exponent = (u32Bucket_ - TOUR_LINEAR_BUCKETS) / TOUR_SUB_BUCKETS + 4;
+  u32Sub = (u32Bucket_ - TOUR_LINEAR_BUCKETS) % TOUR_SUB_BUCKETS;
+
+  return( (((uint64_t)TOUR_SUB_BUCKETS + u32Sub + 1) << (u32Exponent - 3)) - 1 );
+
+} /* end TourBucketTop() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Variants */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourRandomMove
+*/
+static u8 TourRandomMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_)
+{
+  u8 au8Cells[ANTTT_CELLS];
+  u8 u8Count = 0;
+
+  (void)eSide_;
+  (void)u32Param_;
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    if( AntttIsLegalMove(&psGame_->sBoard, i) )
+    {
+      au8Cells[u8Count++] = i;
+    }
+  }
+
+  return( au8Cells[TourRandom(psGame_) % u8Count] );
+
+} /* end TourRandomMove() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourSearchMove
+
+Description:
+The search run to completion in the longest slices it accepts, as AntttSM_ComputerMove() does over several passes
+on target.
+*/
+static u8 TourSearchMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_)
+{
+  AntttSearchStart(&psGame_->sBoard, eSide_, (AntttLevelType)u32Param_);
+  while( !AntttSearchRun(TOUR_BUDGET_US) );
+
+  return( AntttSearchResult() );
+
+} /* end TourSearchMove() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourPerfectMove
+*/
+static u8 TourPerfectMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_)
+{
+  (void)u32Param_;
+
+  return( AntttBestMove(&psGame_->sBoard, eSide_) );
+
+} /* end TourPerfectMove() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourUltimateRandomMove
+*/
+static u8 TourUltimateRandomMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_)
+{
+  u8 au8Moves[ANTTT_ULTIMATE_MOVES];
+  u8 u8Count = AntttUltimateLegalMoves(&psGame_->sUltimate, au8Moves);
+
+  (void)eSide_;
+  (void)u32Param_;
+
+  return( au8Moves[TourRandom(psGame_) % u8Count] );
+
+} /* end TourUltimateRandomMove() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourOnePlyMove
+*/
+static u8 TourOnePlyMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_)
+{
+  (void)u32Param_;
+
+  return( AntttUltimateChooseMove(&psGame_->sUltimate, eSide_) );
+
+} /* end TourOnePlyMove() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourMctsMove
+
+Description:
+A fixed number of playouts so the result does not depend on host speed.  The tree follows every move of the game
+(TourPlay()), so both sides share it when both are MCTS variants.
+*/
+static u8 TourMctsMove(TourGameType* psGame_, AntttSideType eSide_, u32 u32Param_)
+{
+  (void)psGame_;
+  (void)eSide_;
+
+  AntttMctsStart(u32Param_, 0);
+  while( !AntttMctsRun(TOUR_BUDGET_US) );
+
+  return( AntttMctsResult() );
+
+} /* end TourMctsMove() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* Tournament */
+/*--------------------------------------------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourPlay
+
+Description:
+Plays one game from its seed with u8Home_ moving first and adds it to Tour_sResults.  Returns false if a variant
+chose an illegal move.
+*/
+static bool TourPlay(const TourEventType* psEvent_, u8 u8Home_, u8 u8Away_, uint64_t u64Seed_)
+{
+  const TourVariantType* psVariant;
+  AntttMctsStateType sState;
+  TourGameType sGame;
+  AntttSideType eSide = ANTTT_HOME;
+  AntttGameStatusType eStatus = ANTTT_GAME_ACTIVE;
+  uint64_t u64Hash = TourMix(u64Seed_);
+  uint64_t u64Start;
+  uint64_t u64Ns;
+  u8 u8Variant;
+  u8 u8Move;
+
+  sGame.sBoard.u16Home = 0;
+  sGame.sBoard.u16Away = 0;
+  AntttUltimateClear(&sGame.sUltimate);
+  sGame.u32Random = (u32)u64Seed_ | 1;
+
+  /* Restart the searches so nothing carries over from the last game this worker played */
+  AntttSearchInitialize();
+  AntttSearchSeed( (u32)(u64Seed_ >> 32) );
+  AntttMctsInitialize();
+  AntttMctsSeed( (u32)(u64Seed_ >> 16) );
+  if(psEvent_->bUltimate)
+  {
+    sState.sUltimate = sGame.sUltimate;
+    AntttMctsNewGame(&G_sAntttMctsUltimate, &sState, ANTTT_HOME);
+  }
+
+  while(eStatus == ANTTT_GAME_ACTIVE)
+  {
+    u8Variant = (eSide == ANTTT_HOME) ? u8Home_ : u8Away_;
+    psVariant = &psEvent_->psVariants[u8Variant];
+
+    u64Start = TourNanoseconds();
+    u8Move = psVariant->pfnMove(&sGame, eSide, psVariant->u32Param);
+    u64Ns = TourNanoseconds() - u64Start;
+
+    Tour_sResults.au64Latency[u8Variant][TourBucket(u64Ns)]++;
+    if(u64Ns > Tour_sResults.au64WorstNs[u8Variant])
+    {
+      Tour_sResults.au64WorstNs[u8Variant] = u64Ns;
+    }
+
+    if(psEvent_->bUltimate)
+    {
+      if( !AntttUltimateMakeMove(&sGame.sUltimate, eSide, ANTTT_ULTIMATE_MOVE_BOARD(u8Move),
+                                 ANTTT_ULTIMATE_MOVE_CELL(u8Move)) )
+      {
+        printf("%s: %s chose illegal move 0x%02X\n", psEvent_->pcName, psVariant->pcName, u8Move);
+        return(false);
+      }
+      AntttMctsAdvance(u8Move);
+      eStatus = (AntttGameStatusType)sGame.sUltimate.u8Status;
+    }
+    else
+    {
+      if( !AntttMakeMove(&sGame.sBoard, eSide, u8Move) )
+      {
+        printf("%s: %s chose illegal cell %u\n", psEvent_->pcName, psVariant->pcName, u8Move);
+        return(false);
+      }
+      eStatus = AntttGameStatus(&sGame.sBoard);
+    }
+
+    u64Hash = TourMix(u64Hash ^ u8Move);
+    Tour_sResults.u64Moves++;
+    eSide = (AntttSideType)(eSide ^ ANTTT_AWAY);
+  }
+
+  Tour_sResults.au64Results[u8Home_][u8Away_][eStatus]++;
+  Tour_sResults.u64Games++;
+  Tour_sResults.u64Digest += TourMix(u64Hash ^ eStatus);
+
+  return(true);
+
+} /* end TourPlay() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourWorker
+
+Description:
+Plays every u32Workers_-th game of the event starting at u32Worker_.  Game k is pairing k / u32Games_.
+*/
+static bool TourWorker(const TourEventType* psEvent_, u32 u32Games_, u32 u32Seed_, u32 u32Worker_, u32 u32Workers_)
+{
+  uint64_t u64Total = (uint64_t)u32Games_ * psEvent_->u8Variants * psEvent_->u8Variants;
+  u32 u32Pairing;
+
+  AntttHashInitialize();
+  for(uint64_t k = u32Worker_; k < u64Total; k += u32Workers_)
+  {
+    u32Pairing = (u32)(k / u32Games_);
+    if( !TourPlay(psEvent_, (u8)(u32Pairing / psEvent_->u8Variants), (u8)(u32Pairing % psEvent_->u8Variants),
+                  TourMix(((uint64_t)u32Seed_ << 32) ^ k)) )
+    {
+      return(false);
+    }
+  }
+
+  return(true);
+
+} /* end TourWorker() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourTransfer
+
+Description:
+Moves the whole of a buffer through a pipe.  Returns false if the pipe closed early.
+*/
+static bool TourTransfer(int iFd_, void* pvData_, size_t zBytes_, bool bWrite_)
+{
+  u8* pu8Data = (u8*)pvData_;
+  ssize_t zDone;
+
+  while(zBytes_ > 0)
+  {
+    zDone = bWrite_ ? write(iFd_, pu8Data, zBytes_) : read(iFd_, pu8Data, zBytes_);
+    if(zDone <= 0)
+    {
+      return(false);
+    }
+    pu8Data += zDone;
+    zBytes_ -= (size_t)zDone;
+  }
+
+  return(true);
+
+} /* end TourTransfer() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourMerge
+
+Description:
+Adds one worker's results into the totals.
+*/
+static void TourMerge(TourResultsType* psTotal_, const TourResultsType* psPart_)
+{
+  for(u8 h = 0; h < TOUR_MAX_VARIANTS; h++)
+  {
+    for(u8 a = 0; a < TOUR_MAX_VARIANTS; a++)
+    {
+      for(u8 s = 0; s < 4; s++)
+      {
+        psTotal_->au64Results[h][a][s] += psPart_->au64Results[h][a][s];
+      }
+    }
+
+    for(u32 b = 0; b < TOUR_BUCKETS; b++)
+    {
+      psTotal_->au64Latency[h][b] += psPart_->au64Latency[h][b];
+    }
+
+    if(psPart_->au64WorstNs[h] > psTotal_->au64WorstNs[h])
+    {
+      psTotal_->au64WorstNs[h] = psPart_->au64WorstNs[h];
+    }
+  }
+
+  psTotal_->u64Games += psPart_->u64Games;
+  psTotal_->u64Moves += psPart_->u64Moves;
+  psTotal_->u64Digest += psPart_->u64Digest;
+
+} /* end TourMerge() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: TourRun
+
+Description:
+Forks the workers for one event, adds up their results and prints the report.  Returns the number of errors.
+*/
+static u32 TourRun(const TourEventType* psEvent_, u32 u32Games_, u32 u32Seed_, u32 u32Workers_)
+{
+  TourResultsType sTotal;
+  TourResultsType* psPart = &Tour_sResults;
+  int aiPipes[TOUR_MAX_WORKERS];
+  int aiFd[2];
+  int iStatus;
+  pid_t iPid;
+  u32 u32Errors = 0;
+  u32 u32Bucket;
+  uint64_t u64Moves;
+  uint64_t u64Count;
+  double dStart = TourSeconds();
+  double dTime;
+  double adPercentiles[] = {0.50, 0.90, 0.99, 0.999};
+
+  memset(&sTotal, 0, sizeof(sTotal));
+  for(u32 w = 0; w < u32Workers_; w++)
+  {
+    if( (pipe(aiFd) != 0) || ((iPid = fork()) < 0) )
+    {
+      perror("worker");
+      exit(2);
+    }
+
+    if(iPid == 0)
+    {
+      close(aiFd[0]);
+      memset(&Tour_sResults, 0, sizeof(Tour_sResults));
+      iStatus = TourWorker(psEvent_, u32Games_, u32Seed_, w, u32Workers_) ? 0 : 1;
+      TourTransfer(aiFd[1], &Tour_sResults, sizeof(Tour_sResults), true);
+      _exit(iStatus);
+    }
+
+    close(aiFd[1]);
+    aiPipes[w] = aiFd[0];
+  }
+
+  for(u32 w = 0; w < u32Workers_; w++)
+  {
+    if( !TourTransfer(aiPipes[w], psPart, sizeof(*psPart), false) )
+    {
+      printf("worker %u sent no results\n", w);
+      u32Errors++;
+      memset(psPart, 0, sizeof(*psPart));
+    }
+    close(aiPipes[w]);
+
+    TourMerge(&sTotal, psPart);
+  }
+
+  while(wait(&iStatus) > 0)
+  {
+    if( !WIFEXITED(iStatus) || (WEXITSTATUS(iStatus) != 0) )
+    {
+      u32Errors++;
+    }
+  }
+  dTime = TourSeconds() - dStart;
+
+  /* Report */
+  printf("\n%s: %llu games in %.2f s with %u workers, %.0f games/sec, %.0f moves/sec, digest %016llX\n",
+         psEvent_->pcName, (unsigned long long)sTotal.u64Games, dTime, u32Workers_, sTotal.u64Games / dTime,
+         sTotal.u64Moves / dTime, (unsigned long long)sTotal.u64Digest);
+
+  printf("HOME (row) win/draw/loss against AWAY (column), %u games each\n%-10s", u32Games_, "");
+  for(u8 a = 0; a < psEvent_->u8Variants; a++)
+  {
+    printf(" %17s", psEvent_->psVariants[a].pcName);
+  }
+  printf("\n");
+  for(u8 h = 0; h < psEvent_->u8Variants; h++)
+  {
+    printf("%-10s", psEvent_->psVariants[h].pcName);
+    for(u8 a = 0; a < psEvent_->u8Variants; a++)
+    {
+      printf(" %5llu/%5llu/%5llu", (unsigned long long)sTotal.au64Results[h][a][ANTTT_GAME_HOME_WIN],
+             (unsigned long long)sTotal.au64Results[h][a][ANTTT_GAME_DRAW],
+             (unsigned long long)sTotal.au64Results[h][a][ANTTT_GAME_AWAY_WIN]);
+    }
+    printf("\n");
+  }
+
+  printf("move latency (us)  %10s %10s %10s %10s %10s %10s\n", "moves", "p50", "p90", "p99", "p99.9", "max");
+  for(u8 v = 0; v < psEvent_->u8Variants; v++)
+  {
+    u64Moves = 0;
+    for(u32Bucket = 0; u32Bucket < TOUR_BUCKETS; u32Bucket++)
+    {
+      u64Moves += sTotal.au64Latency[v][u32Bucket];
+    }
+
+    printf("%-18s %10llu", psEvent_->psVariants[v].pcName, (unsigned long long)u64Moves);
+    for(u8 p = 0; p < sizeof(adPercentiles) / sizeof(adPercentiles[0]); p++)
+    {
+      u64Count = 0;
+      for(u32Bucket = 0; u32Bucket < TOUR_BUCKETS; u32Bucket++)
+      {
+        u64Count += sTotal.au64Latency[v][u32Bucket];
+        if(u64Count >= (uint64_t)(adPercentiles[p] * u64Moves))
+        {
+          break;
+        }
+      }
+      u64Count = TourBucketTop(u32Bucket);
+      if(u64Count > sTotal.au64WorstNs[v])
+      {
+        u64Count = sTotal.au64WorstNs[v];
+      }
+      printf(" %10.2f", u64Count / 1000.0);
+    }
+    printf(" %10.2f\n", sTotal.au64WorstNs[v] / 1000.0);
+  }
+
+  return(u32Errors);
+
+} /* end TourRun() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(int argc, char* argv[])
+{
+  u32 u32Games = TOUR_DEFAULT_GAMES;
+  u32 u32UltimateGames = TOUR_DEFAULT_ULTIMATE;
+  u32 u32Workers = (u32)sysconf(_SC_NPROCESSORS_ONLN);
+  u32 u32Seed = TOUR_DEFAULT_SEED;
+  u32 u32Errors = 0;
+
+  if(argc > 1)
+  {
+    u32Games = (u32)strtoul(argv[1], NULL, 0);
+  }
+  if(argc > 2)
+  {
+    u32Workers = (u32)strtoul(argv[2], NULL, 0);
+  }
+  if(argc > 3)
+  {
+    u32Seed = (u32)strtoul(argv[3], NULL, 0);
+  }
+  if(argc > 4)
+  {
+    u32UltimateGames = (u32)strtoul(argv[4], NULL, 0);
+  }
+
+  if( (u32Workers == 0) || (u32Workers > TOUR_MAX_WORKERS) )
+  {
+    u32Workers = 1;
+  }
+
+  printf("seed %u, %u workers\n", u32Seed, u32Workers);
+  fflush(stdout);
+  if(u32Games)
+  {
+    u32Errors += TourRun(&Tour_asEvents[0], u32Games, u32Seed, u32Workers);
+  }
+  if(u32UltimateGames)
+  {
+    u32Errors += TourRun(&Tour_asEvents[1], u32UltimateGames, u32Seed, u32Workers);
+  }
+
+  printf("\n%s: %u errors\n", u32Errors ? "FAIL" : "PASS", u32Errors);
+
+  return(u32Errors ? 1 : 0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,208 @@
+/***********************************************************************************************************************
+File: anttt_ultimate_bench.c
+
+Description:
+Host benchmark for ultimate tic-tac-toe in anttt.c.  Plays full games with uniformly random legal moves and
+reports games/sec and moves/sec, then plays the on-board opponent (AntttUltimateChooseMove()) against random moves
+and reports its results.  A check pass first rebuilds the won/closed summaries and the game status from the
+sub-boards after every move and compares them with the incremental values kept by AntttUltimateMakeMove().
+
+Build and run from the repository root:
+  gcc -O2 -Ihost -Iapplication -Ibsp host/anttt_ultimate_bench.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_hash.c application/anttt_search.c application/anttt_table.c \
+      application/anttt_journal.c application/anttt_mnk.c application/anttt_mcts.c -o anttt_ultimate_bench
+  ./anttt_ultimate_bench [games]
+***********************************************************************************************************************/
+
+#include <time.h>
+
+#include "configuration.h"
+
+#define BENCH_DEFAULT_GAMES     (u32)200000
+#define BENCH_CHECK_GAMES       (u32)20000
+
+
+static u32 Bench_u32Random = 0x2545F491;
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchSeconds
+*/
+static double BenchSeconds(void)
+{
+  struct timespec sNow;
+
+  clock_gettime(CLOCK_MONOTONIC, &sNow);
+  return( (double)sNow.tv_sec + (double)sNow.tv_nsec * 1e-9 );
+
+} /* end BenchSeconds() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchRandom
+*/
+static u32 BenchRandom(void)
+{
+  Bench_u32Random ^= Bench_u32Random << 13;
+  Bench_u32Random ^= Bench_u32Random >> 17;
+  Bench_u32Random ^= Bench_u32Random << 5;
+
+  return(Bench_u32Random);
+
+} /* end BenchRandom() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchRandomMove
+*/
+static u8 BenchRandomMove(const AntttUltimateBoardType* psBoard_)
+{
+  u8 au8Moves[ANTTT_ULTIMATE_MOVES];
+  u8 u8Count = AntttUltimateLegalMoves(psBoard_, au8Moves);
+
+  return( au8Moves[BenchRandom() % u8Count] );
+
+} /* end BenchRandomMove() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: BenchCheckSummary
+
+Description:
+Rebuilds the summaries from scratch and compares them with the incremental ones.  Returns true if they match.
+*/
+static bool BenchCheckSummary(const AntttUltimateBoardType* psBoard_)
+{
+  u16 u16HomeWon = 0;
+  u16 u16AwayWon = 0;
+  u16 u16Closed = 0;
+  u8 u8Status = ANTTT_GAME_ACTIVE;
+
+  for(u8 i = 0; i < ANTTT_CELLS; i++)
+  {
+    if( AntttWinningLine(psBoard_->au16Home[i]) )
+    {
+      u16HomeWon |= (u16)(1 << i);
+    }
+    else if( AntttWinningLine(psBoard_->au16Away[i]) )
+    {
+      u16AwayWon |= (u16)(1 << i);
+    }
+
+    if( ((u16HomeWon | u16AwayWon) & (1 << i)) ||
+        ((psBoard_->au16Home[i] | psBoard_->au16Away[i]) == ANTTT_BOARD_MASK) )
+    {
+      u16Closed |= (u16)(1 << i);
+    }
+  }
+
+  if( AntttWinningLine(u16HomeWon) )
+  {
+    u8Status = ANTTT_GAME_HOME_WIN;
+  }
+  else if( AntttWinningLine(u16AwayWon) )
+  {
+    u8Status = ANTTT_GAME_AWAY_WIN;
+  }
+  else if(u16Closed == ANTTT_BOARD_MASK)
+  {
+    u8Status = ANTTT_GAME_DRAW;
+  }
+
+  return( (u16HomeWon == psBoard_->u16HomeWon) && (u16AwayWon == psBoard_->u16AwayWon) &&
+          (u16Closed == psBoard_->u16Closed) && (u8Status == psBoard_->u8Status) );
+
+} /* end BenchCheckSummary() */
+
+
+/*----------------------------------------------------------------------------------------------------------------------
+Function: main
+*/
+int main(int argc, char* argv[])
+{
+  u32 u32Games = BENCH_DEFAULT_GAMES;
+  u32 u32Moves = 0;
+  u32 u32Errors = 0;
+  u32 au32Results[4] = {0};
+  u32 au32Computer[4] = {0};
+  u32 u32ComputerGames;
+  double dStart;
+  double dRandomTime;
+  double dComputerTime;
+  AntttUltimateBoardType sBoard;
+  AntttSideType eSide;
+  u8 u8Move;
+
+  if(argc > 1)
+  {
+    u32Games = (u32)strtoul(argv[1], NULL, 0);
+  }
+
+  /* Check pass */
+  for(u32 g = 0; g < BENCH_CHECK_GAMES; g++)
+  {
+    AntttUltimateClear(&sBoard);
+    for(eSide = ANTTT_HOME; sBoard.u8Status == ANTTT_GAME_ACTIVE; eSide = (AntttSideType)(eSide ^ ANTTT_AWAY))
+    {
+      u8Move = BenchRandomMove(&sBoard);
+      if( !AntttUltimateMakeMove(&sBoard, eSide, ANTTT_ULTIMATE_MOVE_BOARD(u8Move), ANTTT_ULTIMATE_MOVE_CELL(u8Move)) )
+      {
+        u32Errors++;
+        break;
+      }
+      if( !BenchCheckSummary(&sBoard) )
+      {
+        u32Errors++;
+        break;
+      }
+    }
+  }
+
+  /* Random against random */
+  dStart = BenchSeconds();
+  for(u32 g = 0; g < u32Games; g++)
+  {
+    AntttUltimateClear(&sBoard);
+    for(eSide = ANTTT_HOME; sBoard.u8Status == ANTTT_GAME_ACTIVE; eSide = (AntttSideType)(eSide ^ ANTTT_AWAY))
+    {
+      u8Move = BenchRandomMove(&sBoard);
+      AntttUltimateMakeMove(&sBoard, eSide, ANTTT_ULTIMATE_MOVE_BOARD(u8Move), ANTTT_ULTIMATE_MOVE_CELL(u8Move));
+      u32Moves++;
+    }
+    au32Results[sBoard.u8Status]++;
+  }
+  dRandomTime = BenchSeconds() - dStart;
+
+  /* On-board opponent as AWAY against random HOME */
+  u32ComputerGames = u32Games / 10;
+  dStart = BenchSeconds();
+  for(u32 g = 0; g < u32ComputerGames; g++)
+  {
+    AntttUltimateClear(&sBoard);
+    for(eSide = ANTTT_HOME; sBoard.u8Status == ANTTT_GAME_ACTIVE; eSide = (AntttSideType)(eSide ^ ANTTT_AWAY))
+    {
+      u8Move = (eSide == ANTTT_AWAY) ? AntttUltimateChooseMove(&sBoard, eSide) : BenchRandomMove(&sBoard);
+      AntttUltimateMakeMove(&sBoard, eSide, ANTTT_ULTIMATE_MOVE_BOARD(u8Move), ANTTT_ULTIMATE_MOVE_CELL(u8Move));
+    }
+    au32Computer[sBoard.u8Status]++;
+  }
+  dComputerTime = BenchSeconds() - dStart;
+
+  printf("random games: %u (HOME wins %u, AWAY wins %u, draws %u), %.1f moves/game\n", u32Games,
+         au32Results[ANTTT_GAME_HOME_WIN], au32Results[ANTTT_GAME_AWAY_WIN], au32Results[ANTTT_GAME_DRAW],
+         (double)u32Moves / u32Games);
+  printf("full-game simulations: %.0f games/sec, %.0f moves/sec\n", u32Games / dRandomTime, u32Moves / dRandomTime);
+  printf("on-board opponent (AWAY) against random: %u wins, %u losses, %u draws, %.0f games/sec\n",
+         au32Computer[ANTTT_GAME_AWAY_WIN], au32Computer[ANTTT_GAME_HOME_WIN], au32Computer[ANTTT_GAME_DRAW],
+         u32ComputerGames / dComputerTime);
+  printf("board: %u bytes\n", (u32)sizeof(AntttUltimateBoardType));
+  printf("%s: %u errors in %u checked games\n", u32Errors ? "FAIL" : "PASS", u32Errors, BENCH_CHECK_GAMES);
+
+  return(u32Errors ? 1 : 0);
+
+} /* end main() */
+
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/
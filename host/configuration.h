@@ -0,0 +1,66 @@
+/**********************************************************************************************************************
+File: configuration.h (host)
+
+Description:
+Replacement for bsp/configuration.h when application sources are compiled on a Linux host for benchmarks and
+tools.  Put this directory first on the include path so application files pick it up unchanged:
+
+  gcc -O2 -Ihost -Iapplication -Ibsp <tool>.c host/anttt-host.c application/anttt.c \
+      application/anttt_symmetry.c application/anttt_hash.c application/anttt_search.c application/anttt_table.c \
+      application/anttt_journal.c application/anttt_mnk.c application/anttt_mcts.c application/anttt_load.c
+
+The include guard matches bsp/configuration.h so a driver header that includes "configuration.h" from the
+bsp directory does not pull in the nRF51 SDK.  Board functions used by the application are provided by
+anttt-host.c.
+***********************************************************************************************************************/
+
+#ifndef __CONFIG_H
+#define __CONFIG_H
+
+/**********************************************************************************************************************
+Runtime Switches
+***********************************************************************************************************************/
+#define ANTTT_HOST                                    /* Application sources are being built for the host */
+#ifndef ANTTT_HASH_TABLE_BYTES
+#define ANTTT_HASH_TABLE_BYTES        1024            /* Same as the target; override with -D to try other sizes */
+#endif
+
+
+/**********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+/* Standard C headers */
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* MPG nRF51422 implementation headers */
+#include "typedefs.h"
+#include "main.h"
+#include "utilities.h"
+
+/* Board values used by the application, and the board description that LedNumberType comes from.  Nothing here
+touches the nRF51 SDK unless a GPIO setup macro is expanded. */
+#include "anttt-ehdw-04.h"
+
+/* Driver header files */
+#include "leds_anttt.h"
+
+/* Application header files */
+#include "anttt.h"
+#include "anttt_symmetry.h"
+#include "anttt_journal.h"
+#include "anttt_hash.h"
+#include "anttt_search.h"
+#include "anttt_mnk.h"
+#include "anttt_mcts.h"
+#include "anttt_load.h"
+
+
+#endif /* __CONFIG_H */
+
+/*--------------------------------------------------------------------------------------------------------------------*/
+/* End of File */
+/*--------------------------------------------------------------------------------------------------------------------*/